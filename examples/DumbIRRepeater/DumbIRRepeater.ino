@@ -115,18 +115,15 @@ void loop() {
   if (irrecv.decode(&results)) {  // We have captured something.
     // The capture has stopped at this point.
 
-    // Convert the results into an array suitable for sendRaw().
-    // resultToRawArray() allocates the memory we need for the array.
-    uint16_t *raw_array = resultToRawArray(&results);
-    // Find out how many elements are in the array.
+    // Find out how many elements a sendRaw() array of it would have.
     uint16_t length = getCorrectedRawLength(&results);
-    // Send it out via the IR LED circuit.
-    irsend.sendRaw(raw_array, length, kFrequency);
+    // Send it out via the IR LED circuit, straight from the capture buffer.
+    // i.e. No array is allocated, so the heap doesn't fragment over time.
+    irsend.sendRawTicks(results.rawbuf + kStartOffset,
+                        results.rawlen - kStartOffset, kFrequency, kRawTick);
     // Resume capturing IR messages. It was not restarted until after we sent
     // the message so we didn't capture our own message.
     irrecv.resume();
-    // Deallocate the memory allocated by resultToRawArray().
-    delete [] raw_array;
 
     // Display a crude timestamp & notification.
     uint32_t now = millis();
@@ -308,7 +308,8 @@ const uint8_t kPasswordLength = 20;
 // -------------------------- Json Settings ------------------------------------
 
 const uint16_t kJsonConfigMaxSize = 512;    // Bytes
-const uint16_t kJsonAcStateMaxSize = 1024;  // Bytes
+// The longest JSON A/C state is approx 370 bytes (en-AU).
+const uint16_t kJsonAcStateMaxSize = 512;   // Bytes
 
 // -------------------------- Debug Settings -----------------------------------
 // Debug output is disabled if any of the IR pins are on the TX (D1) pin.
@@ -326,6 +327,9 @@ const uint16_t kJsonAcStateMaxSize = 1024;  // Bytes
 const uint8_t kRebootTime = 15;  // Seconds
 const uint8_t kQuickDisplayTime = 2;  // Seconds
 
+// The largest A/C state (in bytes) we can be asked to send. This is not
+// kStateSizeMax, which only covers the protocols we can decode.
+const uint16_t kSendStateSizeMax = kHitachiAc2StateLength;
 // Common bit sizes for the simple protocols.
 const uint8_t kCommonBitSizes[] = {
     12, 13, 15, 16, 20, 24, 28, 32, 35, 36, 42, 48, 56, 64};
@@ -400,6 +400,7 @@
 #include <IRtimer.h>
 #include <IRutils.h>
 #include <IRac.h>
+#include <IRjson.h>
 #if MQTT_ENABLE
 #include <PubSubClient.h>
 #endif  // MQTT_ENABLE
@@ -814,9 +815,9 @@ void handleRoot(void) {
   html += F(
       " State " D_STR_CODE ": 0x"
       "<input type='text' name='" KEY_CODE "' size='");
-  html += String(kStateSizeMax * 2);
+  html += String(kSendStateSizeMax * 2);
   html += F("' maxlength='");
-  html += String(kStateSizeMax * 2);
+  html += String(kSendStateSizeMax * 2);
   html += F("'"
           " value='"
 #if EXAMPLES_ENABLE
@@ -1621,7 +1622,7 @@ void handleReboot() {
 bool parseStringAndSendAirCon(IRsend *irsend, const decode_type_t irType,
                               const String str) {
   uint8_t strOffset = 0;
-  uint8_t state[kStateSizeMax] = {0};  // All array elements are set to 0.
+  uint8_t state[kSendStateSizeMax] = {0};  // All array elements are set to 0.
   uint16_t stateSize = 0;
 
   if (str.startsWith(PSTR("0x")) || str.startsWith(PSTR("0X")))
@@ -1693,7 +1694,7 @@ bool parseStringAndSendAirCon(IRsend *irsend, const decode_type_t irType,
       // Use at least the minimum size.
       stateSize = std::max(stateSize, (uint16_t) 3);
       // Cap the maximum size.
-      stateSize = std::min(stateSize, kStateSizeMax);
+      stateSize = std::min(stateSize, kSendStateSizeMax);
       break;
     case SAMSUNG_AC:
       // Samsung has two distinct & different size states, so make a best guess
@@ -1719,6 +1720,10 @@ bool parseStringAndSendAirCon(IRsend *irsend, const decode_type_t irType,
         return false;
       }
   }
+  if (stateSize > kSendStateSizeMax) {
+    debug("AirCon state is larger than we can send. Ignoring.");
+    return false;
+  }
   if (inputLength > stateSize * 2) {
     debug("AirCon code to large for the given protocol.");
     return false;
@@ -3142,100 +3147,21 @@ bool sendFloat(const String topic, const float_t temp, const bool retain) {
 #if MQTT_CLIMATE_JSON
 void sendJsonState(const stdAc::state_t state, const String topic,
                    const bool retain, const bool ha_mode) {
-  DynamicJsonDocument json(kJsonAcStateMaxSize);
-  json[KEY_PROTOCOL] = typeToString(state.protocol);
-  json[KEY_MODEL] = state.model;
-  json[KEY_COMMAND] = IRac::commandToString(state.command);
-  json[KEY_POWER] = IRac::boolToString(state.power);
-  json[KEY_MODE] = IRac::opmodeToString(state.mode, ha_mode);
-  // Home Assistant wants mode to be off if power is also off & vice-versa.
-  if (ha_mode && (state.mode == stdAc::opmode_t::kOff || !state.power)) {
-    json[KEY_MODE] = IRac::opmodeToString(stdAc::opmode_t::kOff, ha_mode);
-    json[KEY_POWER] = IRac::boolToString(false);
-  }
-  json[KEY_CELSIUS] = IRac::boolToString(state.celsius);
-  json[KEY_TEMP] = state.degrees;
-  json[KEY_SENSORTEMP] = state.sensorTemperature;
-  json[KEY_FANSPEED] = IRac::fanspeedToString(state.fanspeed);
-  json[KEY_SWINGV] = IRac::swingvToString(state.swingv);
-  json[KEY_SWINGH] = IRac::swinghToString(state.swingh);
-  json[KEY_QUIET] = IRac::boolToString(state.quiet);
-  json[KEY_IFEEL] = IRac::boolToString(state.iFeel);
-  json[KEY_TURBO] = IRac::boolToString(state.turbo);
-  json[KEY_ECONO] = IRac::boolToString(state.econo);
-  json[KEY_LIGHT] = IRac::boolToString(state.light);
-  json[KEY_FILTER] = IRac::boolToString(state.filter);
-  json[KEY_CLEAN] = IRac::boolToString(state.clean);
-  json[KEY_BEEP] = IRac::boolToString(state.beep);
-  json[KEY_SLEEP] = state.sleep;
-
-  String payload = "";
-  payload.reserve(200);
-  serializeJson(json, payload);
+  // Static, so it's not on the (small) stack. Only the main loop calls this.
+  static char payload[kJsonAcStateMaxSize];
+  IRtextSink out(payload, sizeof(payload));
+  irjson::stateToJson(&out, state, ha_mode);
+  if (out.overflowed()) {  // Never publish a truncated (invalid) JSON state.
+    debug("JSON A/C state is too big for the buffer. Not sending it!");
+    return;
+  }
   sendString(topic, payload, retain);
 }
 
-bool validJsonStr(DynamicJsonDocument doc, const char* key) {
-  return doc.containsKey(key) && doc[key].is<char*>();
-}
-
-bool validJsonInt(DynamicJsonDocument doc, const char* key) {
-  return doc.containsKey(key) && doc[key].is<signed int>();
-}
-
 stdAc::state_t jsonToState(const stdAc::state_t current, const char *str) {
-  DynamicJsonDocument json(kJsonAcStateMaxSize);
-  if (deserializeJson(json, str, kJsonAcStateMaxSize)) {
-    debug("json MQTT message did not parse. Skipping!");
-    return current;
-  }
   stdAc::state_t result = current;
-  if (validJsonStr(json, KEY_PROTOCOL))
-    result.protocol = strToDecodeType(json[KEY_PROTOCOL]);
-  else if (validJsonInt(json, KEY_PROTOCOL))
-    result.protocol = (decode_type_t)json[KEY_PROTOCOL].as<signed int>();
-  if (validJsonStr(json, KEY_MODEL))
-    result.model = IRac::strToModel(json[KEY_MODEL].as<char*>());
-  else if (validJsonInt(json, KEY_MODEL))
-    result.model = json[KEY_MODEL];
-  if (validJsonStr(json, KEY_COMMAND))
-    result.command = IRac::strToCommand(json[KEY_COMMAND].as<char*>());
-  else if (validJsonInt(json, KEY_COMMAND))
-    result.command = json[KEY_COMMAND];
-  if (validJsonStr(json, KEY_MODE))
-    result.mode = IRac::strToOpmode(json[KEY_MODE]);
-  if (validJsonStr(json, KEY_FANSPEED))
-    result.fanspeed = IRac::strToFanspeed(json[KEY_FANSPEED]);
-  if (validJsonStr(json, KEY_SWINGV))
-    result.swingv = IRac::strToSwingV(json[KEY_SWINGV]);
-  if (validJsonStr(json, KEY_SWINGH))
-    result.swingh = IRac::strToSwingH(json[KEY_SWINGH]);
-  if (json.containsKey(KEY_TEMP))
-    result.degrees = json[KEY_TEMP];
-  if (json.containsKey(KEY_SENSORTEMP))
-    result.sensorTemperature = json[KEY_SENSORTEMP];
-  if (validJsonInt(json, KEY_SLEEP))
-    result.sleep = json[KEY_SLEEP];
-  if (validJsonStr(json, KEY_POWER))
-    result.power = IRac::strToBool(json[KEY_POWER]);
-  if (validJsonStr(json, KEY_IFEEL))
-    result.iFeel = IRac::strToBool(json[KEY_IFEEL]);
-  if (validJsonStr(json, KEY_QUIET))
-    result.quiet = IRac::strToBool(json[KEY_QUIET]);
-  if (validJsonStr(json, KEY_TURBO))
-    result.turbo = IRac::strToBool(json[KEY_TURBO]);
-  if (validJsonStr(json, KEY_ECONO))
-    result.econo = IRac::strToBool(json[KEY_ECONO]);
-  if (validJsonStr(json, KEY_LIGHT))
-    result.light = IRac::strToBool(json[KEY_LIGHT]);
-  if (validJsonStr(json, KEY_CLEAN))
-    result.clean = IRac::strToBool(json[KEY_CLEAN]);
-  if (validJsonStr(json, KEY_FILTER))
-    result.filter = IRac::strToBool(json[KEY_FILTER]);
-  if (validJsonStr(json, KEY_BEEP))
-    result.beep = IRac::strToBool(json[KEY_BEEP]);
-  if (validJsonStr(json, KEY_CELSIUS))
-    result.celsius = IRac::strToBool(json[KEY_CELSIUS]);
+  if (!irjson::jsonToState(str, strlen(str), &result))
+    debug("json MQTT message did not parse. Skipping!");
   return result;
 }
 #endif  // MQTT_CLIMATE_JSON
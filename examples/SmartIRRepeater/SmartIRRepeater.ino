@@ -121,17 +121,14 @@ void loop() {
     bool success = true;
     // Is it a protocol we don't understand?
     if (protocol == decode_type_t::UNKNOWN) {  // Yes.
-      // Convert the results into an array suitable for sendRaw().
-      // resultToRawArray() allocates the memory we need for the array.
-      uint16_t *raw_array = resultToRawArray(&results);
-      // Find out how many elements are in the array.
+      // Find out how many elements a sendRaw() array of it would have.
       size = getCorrectedRawLength(&results);
 #if SEND_RAW
-      // Send it out via the IR LED circuit.
-      irsend.sendRaw(raw_array, size, kFrequency);
+      // Send it out via the IR LED circuit, straight from the capture buffer.
+      // i.e. No array is allocated, so the heap doesn't fragment over time.
+      irsend.sendRawTicks(results.rawbuf + kStartOffset,
+                          results.rawlen - kStartOffset, kFrequency, kRawTick);
 #endif  // SEND_RAW
-      // Deallocate the memory allocated by resultToRawArray().
-      delete [] raw_array;
     } else if (hasACState(protocol)) {  // Does the message require a state[]?
       // It does, so send with bytes instead.
       success = irsend.send(protocol, results.state, size / 8);
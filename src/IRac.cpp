@@ -25,16 +25,21 @@
 #include "ir_LG.h"
 #include "ir_Rhoss.h"
 
-// On the ESP8266 platform we need to use a special version of string handling
-// functions to handle the strings stored in the flash address space.
-#ifndef STRCASECMP
-#if defined(ESP8266)
-#define STRCASECMP(LHS, RHS) \
-    strcasecmp_P(LHS, reinterpret_cast<const char*>(RHS))
-#else  // ESP8266
-#define STRCASECMP(LHS, RHS) strcasecmp(LHS, RHS)
-#endif  // ESP8266
-#endif  // STRCASECMP
+#ifndef PROGMEM
+#define PROGMEM  // Pretend we have the PROGMEM macro even if we really don't.
+#endif
+
+/// Make an entry for a text to value look up table. (See IRtextValue)
+/// @param[in] NAME The IRtext string. e.g. kAutoStr
+/// @param[in] TEXT The locale's text for that string. e.g. D_STR_AUTO
+/// @param[in] VALUE What the text converts to.
+#if _IR_LOCALE_POOL_
+#define IRAC_TEXT(NAME, TEXT, VALUE) {NAME##Id, (int16_t)(VALUE)}
+#else  // _IR_LOCALE_POOL_
+#define IRAC_TEXT(NAME, TEXT, VALUE) {irtextHash(TEXT), &NAME, (int16_t)(VALUE)}
+#endif  // _IR_LOCALE_POOL_
+/// The nr. of entries in a text to value look up table.
+#define IRAC_TEXT_COUNT(TABLE) (sizeof(TABLE) / sizeof(TABLE[0]))
 
 #ifndef UNIT_TEST
 #define OUTPUT_DECODE_RESULTS_FOR_UT(ac)
@@ -74,9 +79,184 @@ IRac::IRac(const uint16_t pin, const bool inverted, const bool use_modulation) {
   _pin = pin;
   _inverted = inverted;
   _modulation = use_modulation;
+  _poolBudget = kIrAcPoolBudget;
+  _poolClock = 0;
+  for (uint8_t i = 0; i < kIrAcPoolSize; i++) {
+    _pool[i].protocol = decode_type_t::UNKNOWN;
+    _pool[i].ac = NULL;
+  }
   this->markAsSent();
 }
 
+/// Copy constructor.
+/// @param[in] other The IRac object to copy.
+/// @note The A/C objects kept for reuse are not copied.
+IRac::IRac(const IRac &other) : IRac(other._pin) { *this = other; }
+
+/// Assignment operator.
+/// @param[in] other The IRac object to copy.
+/// @return A reference to this object.
+/// @note The A/C objects kept for reuse are not copied.
+IRac &IRac::operator=(const IRac &other) {
+  if (this == &other) return *this;
+  clearPool();
+  next = other.next;
+  _pin = other._pin;
+  _inverted = other._inverted;
+  _modulation = other._modulation;
+  _prev = other._prev;
+  _poolBudget = other._poolBudget;
+#ifdef UNIT_TEST
+  _utReceiver = other._utReceiver;
+#endif  // UNIT_TEST
+  return *this;
+}
+
+/// Class destructor
+IRac::~IRac(void) { clearPool(); }
+
+/// Set the max. nr. of bytes of A/C objects we may keep for reuse.
+/// Objects that were used least recently are freed until we are within it.
+/// @param[in] bytes The budget in bytes. 0 disables keeping objects.
+void IRac::setPoolBudget(const uint32_t bytes) {
+  _poolBudget = bytes;
+  while (getPoolFootprint() > _poolBudget) _poolFree(_poolOldest());
+}
+
+/// Get the max. nr. of bytes of A/C objects we may keep for reuse.
+/// @return The budget in bytes.
+uint32_t IRac::getPoolBudget(void) const { return _poolBudget; }
+
+/// Get the nr. of bytes used by A/C objects we are keeping for reuse.
+/// @return The footprint in bytes.
+uint32_t IRac::getPoolFootprint(void) const {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < kIrAcPoolSize; i++)
+    if (_pool[i].ac != NULL) total += _pool[i].size;
+  return total;
+}
+
+/// Free all the A/C objects we are keeping for reuse.
+void IRac::clearPool(void) {
+  for (uint8_t i = 0; i < kIrAcPoolSize; i++) _poolFree(&_pool[i]);
+}
+
+/// Find, or create, a reusable A/C object for a given protocol & model.
+/// @param[in] protocol The protocol of the A/C object.
+/// @param[in] model The model of the A/C object.
+/// @param[in] size The nr. of bytes the A/C object uses.
+/// @return A Ptr to the pool entry holding a ready to use object, or NULL if
+///   it won't fit in the budget.
+IRacPoolEntry *IRac::_poolGet(const decode_type_t protocol,
+                              const int16_t model, const uint32_t size) {
+  _poolClock++;
+  for (uint8_t i = 0; i < kIrAcPoolSize; i++)
+    if (_pool[i].ac != NULL && _pool[i].protocol == protocol &&
+        _pool[i].model == model) {
+      _pool[i].lastUsed = _poolClock;
+      return &_pool[i];
+    }
+  if (size > _poolBudget) return NULL;
+  // Make room, by dropping the least recently used objects.
+  IRacPoolEntry *result = NULL;
+  while (result == NULL) {
+    for (uint8_t i = 0; i < kIrAcPoolSize; i++)
+      if (_pool[i].ac == NULL) result = &_pool[i];
+    if (result == NULL || getPoolFootprint() + size > _poolBudget) {
+      _poolFree(_poolOldest());
+      result = NULL;
+    }
+  }
+  result->protocol = protocol;
+  result->model = model;
+  result->size = size;
+  result->lastUsed = _poolClock;
+  result->primed = false;
+  switch (protocol) {
+#if SEND_LG
+    case decode_type_t::LG:
+    case decode_type_t::LG2:
+      result->ac = new IRLgAc(_pin, _inverted, _modulation);
+      if (result->ac != NULL) static_cast<IRLgAc *>(result->ac)->begin();
+      break;
+#endif  // SEND_LG
+#if SEND_RHOSS
+    case decode_type_t::RHOSS:
+      result->ac = new IRRhossAc(_pin, _inverted, _modulation);
+      if (result->ac != NULL) static_cast<IRRhossAc *>(result->ac)->begin();
+      break;
+#endif  // SEND_RHOSS
+    default:
+      break;
+  }
+  if (result->ac == NULL) {  // Unsupported, or out of memory.
+    result->protocol = decode_type_t::UNKNOWN;
+    return NULL;
+  }
+  return result;
+}
+
+/// Find the pooled A/C object that was used the longest time ago.
+/// @return A Ptr to the pool entry, or NULL if there are none.
+IRacPoolEntry *IRac::_poolOldest(void) {
+  IRacPoolEntry *oldest = NULL;
+  for (uint8_t i = 0; i < kIrAcPoolSize; i++)
+    if (_pool[i].ac != NULL &&
+        (oldest == NULL || _pool[i].lastUsed < oldest->lastUsed))
+      oldest = &_pool[i];
+  return oldest;
+}
+
+/// Free the A/C object held in a pool entry (if any).
+/// @param[in, out] entry A Ptr to the pool entry.
+void IRac::_poolFree(IRacPoolEntry *entry) {
+  if (entry == NULL || entry->ac == NULL) return;
+  switch (entry->protocol) {
+#if SEND_LG
+    case decode_type_t::LG:
+    case decode_type_t::LG2:
+      delete static_cast<IRLgAc *>(entry->ac);
+      break;
+#endif  // SEND_LG
+#if SEND_RHOSS
+    case decode_type_t::RHOSS:
+      delete static_cast<IRRhossAc *>(entry->ac);
+      break;
+#endif  // SEND_RHOSS
+    default:
+      break;
+  }
+  entry->ac = NULL;
+  entry->protocol = decode_type_t::UNKNOWN;
+}
+
+/// Is a pooled A/C object already set up for the given state?
+/// i.e. Can it simply be sent again without calling all the setters.
+/// @param[in] entry A Ptr to the pool entry.
+/// @param[in] state The state we want to send.
+/// @param[in] swingv_prev The previous vertical swing setting.
+/// @return true, if it can be resent as-is. Otherwise, false.
+bool IRac::_poolIsCurrent(const IRacPoolEntry *entry,
+                          const stdAc::state_t state,
+                          const stdAc::swingv_t swingv_prev) {
+  if (!entry->primed || entry->lastSwingvPrev != swingv_prev) return false;
+  const stdAc::packed_state_t packed = packState(state);
+  for (uint8_t i = 0; i < 4; i++)  // Including the clock.
+    if (entry->last.raw[i] != packed.raw[i]) return false;
+  return true;
+}
+
+/// Record what state a pooled A/C object has been set up for.
+/// @param[in, out] entry A Ptr to the pool entry.
+/// @param[in] state The state the object was set up for.
+/// @param[in] swingv_prev The previous vertical swing setting it was given.
+void IRac::_poolSetCurrent(IRacPoolEntry *entry, const stdAc::state_t state,
+                           const stdAc::swingv_t swingv_prev) {
+  entry->last = packState(state);
+  entry->lastSwingvPrev = swingv_prev;
+  entry->primed = true;
+}
+
 /// Initialise the given state with the supplied settings.
 /// @param[out] state A Ptr to where the settings will be stored.
 /// @param[in] vendor The vendor/protocol type.
@@ -358,12 +538,14 @@ bool IRac::isProtocolSupported(const decode_type_t protocol) {
 /// @param[in] swingv_prev The previous vertical swing setting.
 /// @param[in] swingh The horizontal swing setting.
 /// @param[in] light Turn on the LED/Display mode.
+/// @param[in] init Set up the hardware first. Not needed for a reused object.
 void IRac::lg(IRLgAc *ac, const lg_ac_remote_model_t model,
               const bool on, const stdAc::opmode_t mode,
               const float degrees, const stdAc::fanspeed_t fan,
               const stdAc::swingv_t swingv, const stdAc::swingv_t swingv_prev,
-              const stdAc::swingh_t swingh, const bool light) {
-  ac->begin();
+              const stdAc::swingh_t swingh, const bool light,
+              const bool init) {
+  if (init) ac->begin();
   ac->setModel(model);
   ac->setPower(on);
   ac->setMode(ac->convertMode(mode));
@@ -402,10 +584,12 @@ void IRac::lg(IRLgAc *ac, const lg_ac_remote_model_t model,
 /// @param[in] degrees The temperature setting in degrees.
 /// @param[in] fan The speed setting for the fan.
 /// @param[in] swing The swing setting.
+/// @param[in] init Set up the hardware first. Not needed for a reused object.
 void IRac::rhoss(IRRhossAc *ac,
                 const bool on, const stdAc::opmode_t mode, const float degrees,
-                const stdAc::fanspeed_t fan, const stdAc::swingv_t swing) {
-  ac->begin();
+                const stdAc::fanspeed_t fan, const stdAc::swingv_t swing,
+                const bool init) {
+  if (init) ac->begin();
   ac->setPower(on);
   ac->setMode(ac->convertMode(mode));
   ac->setSwing(swing != stdAc::swingv_t::kOff);
@@ -609,18 +793,71 @@ bool IRac::sendAc(const stdAc::state_t desired, const stdAc::state_t *prev) {
     case LG:
     case LG2:
     {
-      IRLgAc ac(_pin, _inverted, _modulation);
-      lg(&ac, (lg_ac_remote_model_t)send.model, send.power, send.mode,
+      IRacPoolEntry *entry = _poolGet(send.protocol, send.model,
+                                      sizeof(IRLgAc));
+      if (entry == NULL) {  // Not allowed to keep one, so use a temporary.
+        uint32_t code;
+        decode_type_t protocol;
+        // Most states are a single message we can work out directly, which
+        // saves setting up a whole IRLgAc object just to send it.
+        if (IRLgAc::encode(send, prev_swingv, &code, &protocol)) {
+#ifndef UNIT_TEST
+          IRsend irsend(_pin, _inverted, _modulation);
+#else  // UNIT_TEST
+          IRsendTest irsend(_pin, _inverted, _modulation);
+#endif  // UNIT_TEST
+          irsend.begin();
+          irsend.send(protocol, code, kLgBits, kLgDefaultRepeat);
+          break;
+        }
+        IRLgAc ac(_pin, _inverted, _modulation);
+        lg(&ac, (lg_ac_remote_model_t)send.model, send.power, send.mode,
+           send.degrees, send.fanspeed, send.swingv, prev_swingv, send.swingh,
+           send.light);
+        break;
+      }
+      IRLgAc *ac = static_cast<IRLgAc *>(entry->ac);
+      if (_poolIsCurrent(entry, send, prev_swingv)) {
+        ac->send();
+        break;
+      }
+      ac->stateReset();
+      lg(ac, (lg_ac_remote_model_t)send.model, send.power, send.mode,
          send.degrees, send.fanspeed, send.swingv, prev_swingv, send.swingh,
-         send.light);
+         send.light, false);
+      _poolSetCurrent(entry, send, prev_swingv);
+      // These models send extra messages based on what was sent before, so
+      // they always need the setters to be re-run.
+      switch (send.model) {
+        case lg_ac_remote_model_t::LG6711A20083V:
+        case lg_ac_remote_model_t::AKB74955603:
+        case lg_ac_remote_model_t::AKB73757604:
+          entry->primed = false;
+          break;
+        default:
+          break;
+      }
       break;
     }
 #endif  // SEND_LG
 #if SEND_RHOSS
     case RHOSS:
     {
-      IRRhossAc ac(_pin, _inverted, _modulation);
-      rhoss(&ac, send.power, send.mode, degC, send.fanspeed, send.swingv);
+      IRacPoolEntry *entry = _poolGet(send.protocol, send.model,
+                                      sizeof(IRRhossAc));
+      if (entry == NULL) {  // Not allowed to keep one, so use a temporary.
+        IRRhossAc ac(_pin, _inverted, _modulation);
+        rhoss(&ac, send.power, send.mode, degC, send.fanspeed, send.swingv);
+        break;
+      }
+      IRRhossAc *ac = static_cast<IRRhossAc *>(entry->ac);
+      if (_poolIsCurrent(entry, send, stdAc::swingv_t::kOff)) {
+        ac->send();
+        break;
+      }
+      ac->stateReset();
+      rhoss(ac, send.power, send.mode, degC, send.fanspeed, send.swingv, false);
+      _poolSetCurrent(entry, send, stdAc::swingv_t::kOff);
       break;
     }
 #endif  // SEND_RHOSS
@@ -643,6 +880,166 @@ bool IRac::sendAc(void) {
   return success;
 }
 
+/// Class constructor for resending an IRac object's current state.
+/// @param[in] ac A ptr to the IRac object to send with.
+IRacJob::IRacJob(IRac *ac) : IRschedulerJob(), ac(ac), resend(true) {
+  IRac::initState(&state);
+}
+
+/// Class constructor for sending a given state.
+/// @param[in] ac A ptr to the IRac object to send with.
+/// @param[in] state The desired state to send when the job runs.
+IRacJob::IRacJob(IRac *ac, const stdAc::state_t state)
+    : IRschedulerJob(), ac(ac), state(state), resend(false) {}
+
+/// Send the A/C state via the IRac object.
+void IRacJob::run(void) {
+  if (ac == NULL) return;
+  if (!resend) ac->next = state;
+  ac->sendAc();
+}
+
+/// Class constructor.
+/// @param[in, out] zones An array to use as storage for the zones.
+/// @param[in] count The nr. of zones in the array.
+IRacZones::IRacZones(IRacZone zones[], const uint16_t count)
+    : _zones(zones), _count(zones != NULL ? count : 0), _pending(0) {
+  for (uint8_t p = 0; p < kIrAcZonePriorities; p++)
+    _head[p] = _tail[p] = kIrAcZoneNone;
+  stdAc::state_t state;
+  IRac::initState(&state);
+  const stdAc::packed_state_t packed = IRac::packState(state);
+  for (uint16_t i = 0; i < _count; i++) {
+    _zones[i].next = packed;
+    _zones[i].prev = packed;
+    _zones[i].ac = NULL;
+    _zones[i].link = kIrAcZoneNone;
+    _zones[i].priority = kIrAcZoneDefaultPriority;
+    _zones[i].queued = false;
+    _zones[i].force = false;
+  }
+}
+
+/// Get the nr. of zones we are managing.
+/// @return The nr. of zones.
+uint16_t IRacZones::size(void) const { return _count; }
+
+/// Set what to send a zone's messages with, and how important it is.
+/// @param[in] zone The index of the zone.
+/// @param[in] ac A Ptr to the IRac object to send with. It can be shared.
+/// @param[in] priority Lower values are sent first. 0 is the highest.
+/// @return true, if successful. false, if not. e.g. an invalid zone.
+/// @note A change of priority takes effect the next time the zone changes.
+bool IRacZones::setup(const uint16_t zone, IRac *ac, const uint8_t priority) {
+  if (zone >= _count) return false;
+  _zones[zone].ac = ac;
+  _zones[zone].priority = (priority < kIrAcZonePriorities)
+      ? priority : kIrAcZonePriorities - 1;
+  return true;
+}
+
+/// Set the state we want a zone to be in. It will be sent by apply() if it
+/// has changed.
+/// @param[in] zone The index of the zone.
+/// @param[in] state The desired state.
+/// @return true, if successful. false, if not. e.g. an invalid zone.
+bool IRacZones::setState(const uint16_t zone, const stdAc::state_t state) {
+  if (zone >= _count) return false;
+  _zones[zone].next = IRac::packState(state);
+  if (hasStateChanged(zone)) _queue(zone);
+  return true;
+}
+
+/// Get the state we want a zone to be in.
+/// @param[in] zone The index of the zone.
+/// @return The desired state.
+stdAc::state_t IRacZones::getState(const uint16_t zone) const {
+  stdAc::state_t result;
+  if (zone < _count) result = IRac::unpackState(_zones[zone].next);
+  return result;
+}
+
+/// Get the state we expect a zone to be in. i.e. What we last sent.
+/// @param[in] zone The index of the zone.
+/// @return The previous state.
+stdAc::state_t IRacZones::getStatePrev(const uint16_t zone) const {
+  stdAc::state_t result;
+  if (zone < _count) result = IRac::unpackState(_zones[zone].prev);
+  return result;
+}
+
+/// Check if the desired state of a zone has changed from what was sent.
+/// @note The comparison excludes the clock. Same as IRac::hasStateChanged().
+/// @param[in] zone The index of the zone.
+/// @return True if it has changed, False if not.
+bool IRacZones::hasStateChanged(const uint16_t zone) const {
+  if (zone >= _count) return false;
+  return IRac::cmpStates(_zones[zone].next, _zones[zone].prev);
+}
+
+/// Send a zone's desired state again, even if it hasn't changed.
+/// e.g. For units that forget their state.
+/// @param[in] zone The index of the zone.
+/// @return true, if successful. false, if not. e.g. an invalid zone.
+bool IRacZones::resend(const uint16_t zone) {
+  if (zone >= _count) return false;
+  _zones[zone].force = true;
+  _queue(zone);
+  return true;
+}
+
+/// How many zones are waiting to be sent?
+/// @return The nr. of zones.
+uint16_t IRacZones::pending(void) const { return _pending; }
+
+/// Send the zones that have changed, highest priority first. Zones of the
+/// same priority are sent in the order they changed.
+/// @param[in] limit The max. nr. of zones to send. e.g. To limit how long a
+///   single call can take.
+/// @return The nr. of zones that were sent.
+/// @note Zones without an IRac object, or with a protocol it can't send, are
+///   dropped.
+uint16_t IRacZones::apply(const uint16_t limit) {
+  uint16_t sent = 0;
+  for (uint8_t p = 0; p < kIrAcZonePriorities && sent < limit; p++) {
+    while (_head[p] != kIrAcZoneNone && sent < limit) {
+      IRacZone *zone = &_zones[_head[p]];
+      _head[p] = zone->link;
+      if (_head[p] == kIrAcZoneNone) _tail[p] = kIrAcZoneNone;
+      zone->link = kIrAcZoneNone;
+      zone->queued = false;
+      _pending--;
+      // It may have been changed back since it was queued.
+      if (!zone->force && !IRac::cmpStates(zone->next, zone->prev)) continue;
+      zone->force = false;
+      if (zone->ac == NULL) continue;
+      const stdAc::state_t prev = IRac::unpackState(zone->prev);
+      if (zone->ac->sendAc(IRac::unpackState(zone->next), &prev)) {
+        zone->prev = zone->next;
+        sent++;
+      }
+    }
+  }
+  return sent;
+}
+
+/// Add a zone to the end of the queue for its priority, if it isn't already
+/// waiting.
+/// @param[in] zone The index of the zone.
+void IRacZones::_queue(const uint16_t zone) {
+  IRacZone *entry = &_zones[zone];
+  if (entry->queued) return;
+  const uint8_t p = entry->priority;
+  entry->queued = true;
+  entry->link = kIrAcZoneNone;
+  if (_tail[p] == kIrAcZoneNone)
+    _head[p] = zone;
+  else
+    _zones[_tail[p]].link = zone;
+  _tail[p] = zone;
+  _pending++;
+}
+
 /// Compare two AirCon states.
 /// @note The comparison excludes the clock.
 /// @param a A state_t to be compared.
@@ -659,316 +1056,446 @@ bool IRac::cmpStates(const stdAc::state_t a, const stdAc::state_t b) {
       a.iFeel != b.iFeel;
 }
 
+/// Compare two packed AirCon states.
+/// @note The comparison excludes the clock.
+/// @param a A packed_state_t to be compared.
+/// @param b A packed_state_t to be compared.
+/// @return True if they differ, False if they don't.
+bool IRac::cmpStates(const stdAc::packed_state_t a,
+                     const stdAc::packed_state_t b) {
+  // The clock is the only thing in the last word.
+  return a.raw[0] != b.raw[0] || a.raw[1] != b.raw[1] || a.raw[2] != b.raw[2];
+}
+
+/// Convert a temperature to 1/100ths of a degree, as used in packed_state_t.
+/// @param[in] degrees The temperature.
+/// @return The temperature in 1/100ths of a degree, limited to what fits.
+static int16_t packTemp(const float degrees) {
+  const float hundredths = roundf(degrees * 100);
+  if (!(hundredths > INT16_MIN)) return INT16_MIN;  // Includes NaN.
+  if (hundredths > INT16_MAX) return INT16_MAX;
+  return hundredths;
+}
+
+/// Convert a state_t into its packed, canonical form.
+/// @param[in] state The state_t to convert.
+/// @return The equivalent packed_state_t.
+stdAc::packed_state_t IRac::packState(const stdAc::state_t state) {
+  stdAc::packed_state_t result;
+  for (uint8_t i = 0; i < 4; i++) result.raw[i] = 0;
+  result.protocol = state.protocol + 1;
+  result.mode = (int8_t)state.mode + 1;
+  result.fanspeed = (int8_t)state.fanspeed;
+  result.swingv = (int8_t)state.swingv + 1;
+  result.swingh = (int8_t)state.swingh + 1;
+  result.command = (int8_t)state.command;
+  result.power = state.power;
+  result.celsius = state.celsius;
+  result.quiet = state.quiet;
+  result.turbo = state.turbo;
+  result.econo = state.econo;
+  result.light = state.light;
+  result.filter = state.filter;
+  result.clean = state.clean;
+  result.beep = state.beep;
+  result.iFeel = state.iFeel;
+  result.model = state.model;
+  result.sleep = state.sleep;
+  result.degrees = packTemp(state.degrees);
+  result.sensorTemperature = packTemp(state.sensorTemperature);
+  result.clock = state.clock;
+  return result;
+}
+
+/// Convert a packed state back into a state_t.
+/// @param[in] packed The packed_state_t to convert.
+/// @return The equivalent state_t.
+stdAc::state_t IRac::unpackState(const stdAc::packed_state_t packed) {
+  stdAc::state_t result;
+  result.protocol = (decode_type_t)((int16_t)packed.protocol - 1);
+  result.model = packed.model;
+  result.power = packed.power;
+  result.mode = (stdAc::opmode_t)((int8_t)packed.mode - 1);
+  result.degrees = packed.degrees / 100.0f;
+  result.celsius = packed.celsius;
+  result.fanspeed = (stdAc::fanspeed_t)packed.fanspeed;
+  result.swingv = (stdAc::swingv_t)((int8_t)packed.swingv - 1);
+  result.swingh = (stdAc::swingh_t)((int8_t)packed.swingh - 1);
+  result.quiet = packed.quiet;
+  result.turbo = packed.turbo;
+  result.econo = packed.econo;
+  result.light = packed.light;
+  result.filter = packed.filter;
+  result.clean = packed.clean;
+  result.beep = packed.beep;
+  result.sleep = packed.sleep;
+  result.clock = packed.clock;
+  result.command = (stdAc::ac_command_t)packed.command;
+  result.iFeel = packed.iFeel;
+  result.sensorTemperature = packed.sensorTemperature / 100.0f;
+  return result;
+}
+
+/// Calculate a hash of a packed state. e.g. For use in a hash table.
+/// @note Like cmpStates(), it excludes the clock. So states that are the
+///   same, as far as cmpStates() is concerned, have the same hash.
+/// @param[in] state The packed_state_t to hash.
+/// @return A 32-bit hash value.
+uint32_t IRac::hashState(const stdAc::packed_state_t state) {
+  // FNV-1a, a word at a time, with a final mix so every bit counts.
+  uint32_t hash = 2166136261UL;
+  for (uint8_t i = 0; i < 3; i++) {
+    hash ^= state.raw[i];
+    hash *= 16777619UL;
+  }
+  hash ^= hash >> 15;
+  return hash;
+}
+
 /// Check if the internal state has changed from what was previously sent.
 /// @note The comparison excludes the clock.
 /// @return True if it has changed, False if not.
 bool IRac::hasStateChanged(void) { return cmpStates(next, _prev); }
 
+/// Text to stdAc::ac_command_t conversions, in order of precedence.
+static const IRtextValue kCommandTypeTexts[] PROGMEM = {
+    IRAC_TEXT(kControlCommandStr, D_STR_CONTROL,
+              stdAc::ac_command_t::kControlCommand),
+    IRAC_TEXT(kIFeelReportStr, D_STR_IFEELREPORT,
+              stdAc::ac_command_t::kSensorTempReport),
+    IRAC_TEXT(kIFeelStr, D_STR_IFEEL, stdAc::ac_command_t::kSensorTempReport),
+    IRAC_TEXT(kSetTimerCommandStr, D_STR_SET_TIMER,
+              stdAc::ac_command_t::kTimerCommand),
+    IRAC_TEXT(kTimerStr, D_STR_TIMER, stdAc::ac_command_t::kTimerCommand),
+    IRAC_TEXT(kConfigCommandStr, D_STR_CONFIG,
+              stdAc::ac_command_t::kConfigCommand),
+};
+
 /// Convert the supplied str into the appropriate enum.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
 stdAc::ac_command_t IRac::strToCommandType(const char *str,
                                            const stdAc::ac_command_t def) {
-  if (!STRCASECMP(str, kControlCommandStr))
-    return stdAc::ac_command_t::kControlCommand;
-  else if (!STRCASECMP(str, kIFeelReportStr) ||
-           !STRCASECMP(str, kIFeelStr))
-    return stdAc::ac_command_t::kSensorTempReport;
-  else if (!STRCASECMP(str, kSetTimerCommandStr) ||
-           !STRCASECMP(str, kTimerStr))
-    return stdAc::ac_command_t::kTimerCommand;
-  else if (!STRCASECMP(str, kConfigCommandStr))
-    return stdAc::ac_command_t::kConfigCommand;
-  else
-    return def;
+  return (stdAc::ac_command_t)irutils::textToValue(
+      str, kCommandTypeTexts, IRAC_TEXT_COUNT(kCommandTypeTexts), (int16_t)def);
 }
 
+/// Text to stdAc::opmode_t conversions, in order of precedence.
+static const IRtextValue kOpmodeTexts[] PROGMEM = {
+    IRAC_TEXT(kAutoStr, D_STR_AUTO, stdAc::opmode_t::kAuto),
+    IRAC_TEXT(kAutomaticStr, D_STR_AUTOMATIC, stdAc::opmode_t::kAuto),
+    IRAC_TEXT(kOffStr, D_STR_OFF, stdAc::opmode_t::kOff),
+    IRAC_TEXT(kStopStr, D_STR_STOP, stdAc::opmode_t::kOff),
+    IRAC_TEXT(kCoolStr, D_STR_COOL, stdAc::opmode_t::kCool),
+    IRAC_TEXT(kCoolingStr, D_STR_COOLING, stdAc::opmode_t::kCool),
+    IRAC_TEXT(kHeatStr, D_STR_HEAT, stdAc::opmode_t::kHeat),
+    IRAC_TEXT(kHeatingStr, D_STR_HEATING, stdAc::opmode_t::kHeat),
+    IRAC_TEXT(kDryStr, D_STR_DRY, stdAc::opmode_t::kDry),
+    IRAC_TEXT(kDryingStr, D_STR_DRYING, stdAc::opmode_t::kDry),
+    IRAC_TEXT(kDehumidifyStr, D_STR_DEHUMIDIFY, stdAc::opmode_t::kDry),
+    IRAC_TEXT(kFanStr, D_STR_FAN, stdAc::opmode_t::kFan),
+    // The following Fans strings with "only" are required to help with
+    // HomeAssistant & Google Home Climate integration.
+    // For compatibility only.
+    // Ref: https://www.home-assistant.io/integrations/google_assistant/#climate-operation-modes
+    IRAC_TEXT(kFanOnlyStr, D_STR_FANONLY, stdAc::opmode_t::kFan),
+    IRAC_TEXT(kFan_OnlyStr, D_STR_FAN_ONLY, stdAc::opmode_t::kFan),
+    IRAC_TEXT(kFanOnlyWithSpaceStr, D_STR_FANSPACEONLY, stdAc::opmode_t::kFan),
+    IRAC_TEXT(kFanOnlyNoSpaceStr, D_STR_FANONLYNOSPACE, stdAc::opmode_t::kFan),
+};
+
 /// Convert the supplied str into the appropriate enum.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
 stdAc::opmode_t IRac::strToOpmode(const char *str,
                                   const stdAc::opmode_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr))
-    return stdAc::opmode_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::opmode_t::kOff;
-  else if (!STRCASECMP(str, kCoolStr) ||
-           !STRCASECMP(str, kCoolingStr))
-    return stdAc::opmode_t::kCool;
-  else if (!STRCASECMP(str, kHeatStr) ||
-           !STRCASECMP(str, kHeatingStr))
-    return stdAc::opmode_t::kHeat;
-  else if (!STRCASECMP(str, kDryStr) ||
-           !STRCASECMP(str, kDryingStr) ||
-           !STRCASECMP(str, kDehumidifyStr))
-    return stdAc::opmode_t::kDry;
-  else if (!STRCASECMP(str, kFanStr) ||
-          // The following Fans strings with "only" are required to help with
-          // HomeAssistant & Google Home Climate integration.
-          // For compatibility only.
-          // Ref: https://www.home-assistant.io/integrations/google_assistant/#climate-operation-modes
-           !STRCASECMP(str, kFanOnlyStr) ||
-           !STRCASECMP(str, kFan_OnlyStr) ||
-           !STRCASECMP(str, kFanOnlyWithSpaceStr) ||
-           !STRCASECMP(str, kFanOnlyNoSpaceStr))
-    return stdAc::opmode_t::kFan;
-  else
-    return def;
+  return (stdAc::opmode_t)irutils::textToValue(
+      str, kOpmodeTexts, IRAC_TEXT_COUNT(kOpmodeTexts), (int16_t)def);
 }
 
+/// Text to stdAc::fanspeed_t conversions, in order of precedence.
+static const IRtextValue kFanspeedTexts[] PROGMEM = {
+    IRAC_TEXT(kAutoStr, D_STR_AUTO, stdAc::fanspeed_t::kAuto),
+    IRAC_TEXT(kAutomaticStr, D_STR_AUTOMATIC, stdAc::fanspeed_t::kAuto),
+    IRAC_TEXT(kMinStr, D_STR_MIN, stdAc::fanspeed_t::kMin),
+    IRAC_TEXT(kMinimumStr, D_STR_MINIMUM, stdAc::fanspeed_t::kMin),
+    IRAC_TEXT(kLowestStr, D_STR_LOWEST, stdAc::fanspeed_t::kMin),
+    IRAC_TEXT(kLowStr, D_STR_LOW, stdAc::fanspeed_t::kLow),
+    IRAC_TEXT(kLoStr, D_STR_LO, stdAc::fanspeed_t::kLow),
+    IRAC_TEXT(kMedStr, D_STR_MED, stdAc::fanspeed_t::kMedium),
+    IRAC_TEXT(kMediumStr, D_STR_MEDIUM, stdAc::fanspeed_t::kMedium),
+    IRAC_TEXT(kMidStr, D_STR_MID, stdAc::fanspeed_t::kMedium),
+    IRAC_TEXT(kHighStr, D_STR_HIGH, stdAc::fanspeed_t::kHigh),
+    IRAC_TEXT(kHiStr, D_STR_HI, stdAc::fanspeed_t::kHigh),
+    IRAC_TEXT(kMaxStr, D_STR_MAX, stdAc::fanspeed_t::kMax),
+    IRAC_TEXT(kMaximumStr, D_STR_MAXIMUM, stdAc::fanspeed_t::kMax),
+    IRAC_TEXT(kHighestStr, D_STR_HIGHEST, stdAc::fanspeed_t::kMax),
+    IRAC_TEXT(kMedHighStr, D_STR_MED_HIGH, stdAc::fanspeed_t::kMediumHigh),
+};
+
 /// Convert the supplied str into the appropriate enum.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
 stdAc::fanspeed_t IRac::strToFanspeed(const char *str,
                                       const stdAc::fanspeed_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr))
-    return stdAc::fanspeed_t::kAuto;
-  else if (!STRCASECMP(str, kMinStr) ||
-           !STRCASECMP(str, kMinimumStr) ||
-           !STRCASECMP(str, kLowestStr))
-    return stdAc::fanspeed_t::kMin;
-  else if (!STRCASECMP(str, kLowStr) ||
-           !STRCASECMP(str, kLoStr))
-    return stdAc::fanspeed_t::kLow;
-  else if (!STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kMidStr))
-    return stdAc::fanspeed_t::kMedium;
-  else if (!STRCASECMP(str, kHighStr) ||
-           !STRCASECMP(str, kHiStr))
-    return stdAc::fanspeed_t::kHigh;
-  else if (!STRCASECMP(str, kMaxStr) ||
-           !STRCASECMP(str, kMaximumStr) ||
-           !STRCASECMP(str, kHighestStr))
-    return stdAc::fanspeed_t::kMax;
-  else if (!STRCASECMP(str, kMedHighStr))
-    return stdAc::fanspeed_t::kMediumHigh;
-  else
-    return def;
+  return (stdAc::fanspeed_t)irutils::textToValue(
+      str, kFanspeedTexts, IRAC_TEXT_COUNT(kFanspeedTexts), (int16_t)def);
 }
 
+/// Text to stdAc::swingv_t conversions, in order of precedence.
+static const IRtextValue kSwingVTexts[] PROGMEM = {
+    IRAC_TEXT(kAutoStr, D_STR_AUTO, stdAc::swingv_t::kAuto),
+    IRAC_TEXT(kAutomaticStr, D_STR_AUTOMATIC, stdAc::swingv_t::kAuto),
+    IRAC_TEXT(kOnStr, D_STR_ON, stdAc::swingv_t::kAuto),
+    IRAC_TEXT(kSwingStr, D_STR_SWING, stdAc::swingv_t::kAuto),
+    IRAC_TEXT(kOffStr, D_STR_OFF, stdAc::swingv_t::kOff),
+    IRAC_TEXT(kStopStr, D_STR_STOP, stdAc::swingv_t::kOff),
+    IRAC_TEXT(kMinStr, D_STR_MIN, stdAc::swingv_t::kLowest),
+    IRAC_TEXT(kMinimumStr, D_STR_MINIMUM, stdAc::swingv_t::kLowest),
+    IRAC_TEXT(kLowestStr, D_STR_LOWEST, stdAc::swingv_t::kLowest),
+    IRAC_TEXT(kBottomStr, D_STR_BOTTOM, stdAc::swingv_t::kLowest),
+    IRAC_TEXT(kDownStr, D_STR_DOWN, stdAc::swingv_t::kLowest),
+    IRAC_TEXT(kLowStr, D_STR_LOW, stdAc::swingv_t::kLow),
+    IRAC_TEXT(kMidStr, D_STR_MID, stdAc::swingv_t::kMiddle),
+    IRAC_TEXT(kMiddleStr, D_STR_MIDDLE, stdAc::swingv_t::kMiddle),
+    IRAC_TEXT(kMedStr, D_STR_MED, stdAc::swingv_t::kMiddle),
+    IRAC_TEXT(kMediumStr, D_STR_MEDIUM, stdAc::swingv_t::kMiddle),
+    IRAC_TEXT(kCentreStr, D_STR_CENTRE, stdAc::swingv_t::kMiddle),
+    IRAC_TEXT(kUpperMiddleStr, D_STR_UPPER_MIDDLE,
+              stdAc::swingv_t::kUpperMiddle),
+    IRAC_TEXT(kHighStr, D_STR_HIGH, stdAc::swingv_t::kHigh),
+    IRAC_TEXT(kHiStr, D_STR_HI, stdAc::swingv_t::kHigh),
+    IRAC_TEXT(kHighestStr, D_STR_HIGHEST, stdAc::swingv_t::kHighest),
+    IRAC_TEXT(kMaxStr, D_STR_MAX, stdAc::swingv_t::kHighest),
+    IRAC_TEXT(kMaximumStr, D_STR_MAXIMUM, stdAc::swingv_t::kHighest),
+    IRAC_TEXT(kTopStr, D_STR_TOP, stdAc::swingv_t::kHighest),
+    IRAC_TEXT(kUpStr, D_STR_UP, stdAc::swingv_t::kHighest),
+};
+
 /// Convert the supplied str into the appropriate enum.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
 stdAc::swingv_t IRac::strToSwingV(const char *str,
                                   const stdAc::swingv_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr) ||
-      !STRCASECMP(str, kOnStr) ||
-      !STRCASECMP(str, kSwingStr))
-    return stdAc::swingv_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::swingv_t::kOff;
-  else if (!STRCASECMP(str, kMinStr) ||
-           !STRCASECMP(str, kMinimumStr) ||
-           !STRCASECMP(str, kLowestStr) ||
-           !STRCASECMP(str, kBottomStr) ||
-           !STRCASECMP(str, kDownStr))
-    return stdAc::swingv_t::kLowest;
-  else if (!STRCASECMP(str, kLowStr))
-    return stdAc::swingv_t::kLow;
-  else if (!STRCASECMP(str, kMidStr) ||
-           !STRCASECMP(str, kMiddleStr) ||
-           !STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kCentreStr))
-    return stdAc::swingv_t::kMiddle;
-  else if (!STRCASECMP(str, kUpperMiddleStr))
-    return stdAc::swingv_t::kUpperMiddle;
-  else if (!STRCASECMP(str, kHighStr) ||
-           !STRCASECMP(str, kHiStr))
-    return stdAc::swingv_t::kHigh;
-  else if (!STRCASECMP(str, kHighestStr) ||
-           !STRCASECMP(str, kMaxStr) ||
-           !STRCASECMP(str, kMaximumStr) ||
-           !STRCASECMP(str, kTopStr) ||
-           !STRCASECMP(str, kUpStr))
-    return stdAc::swingv_t::kHighest;
-  else
-    return def;
+  return (stdAc::swingv_t)irutils::textToValue(
+      str, kSwingVTexts, IRAC_TEXT_COUNT(kSwingVTexts), (int16_t)def);
 }
 
+/// Text to stdAc::swingh_t conversions, in order of precedence.
+static const IRtextValue kSwingHTexts[] PROGMEM = {
+    IRAC_TEXT(kAutoStr, D_STR_AUTO, stdAc::swingh_t::kAuto),
+    IRAC_TEXT(kAutomaticStr, D_STR_AUTOMATIC, stdAc::swingh_t::kAuto),
+    IRAC_TEXT(kOnStr, D_STR_ON, stdAc::swingh_t::kAuto),
+    IRAC_TEXT(kSwingStr, D_STR_SWING, stdAc::swingh_t::kAuto),
+    IRAC_TEXT(kOffStr, D_STR_OFF, stdAc::swingh_t::kOff),
+    IRAC_TEXT(kStopStr, D_STR_STOP, stdAc::swingh_t::kOff),
+    IRAC_TEXT(kLeftMaxNoSpaceStr, D_STR_LEFTMAX_NOSPACE,
+              stdAc::swingh_t::kLeftMax),
+    IRAC_TEXT(kLeftMaxStr, D_STR_LEFTMAX, stdAc::swingh_t::kLeftMax),
+    IRAC_TEXT(kMaxLeftNoSpaceStr, D_STR_MAXLEFT_NOSPACE,
+              stdAc::swingh_t::kLeftMax),
+    IRAC_TEXT(kMaxLeftStr, D_STR_MAXLEFT, stdAc::swingh_t::kLeftMax),
+    IRAC_TEXT(kLeftStr, D_STR_LEFT, stdAc::swingh_t::kLeft),
+    IRAC_TEXT(kMidStr, D_STR_MID, stdAc::swingh_t::kMiddle),
+    IRAC_TEXT(kMiddleStr, D_STR_MIDDLE, stdAc::swingh_t::kMiddle),
+    IRAC_TEXT(kMedStr, D_STR_MED, stdAc::swingh_t::kMiddle),
+    IRAC_TEXT(kMediumStr, D_STR_MEDIUM, stdAc::swingh_t::kMiddle),
+    IRAC_TEXT(kCentreStr, D_STR_CENTRE, stdAc::swingh_t::kMiddle),
+    IRAC_TEXT(kRightStr, D_STR_RIGHT, stdAc::swingh_t::kRight),
+    IRAC_TEXT(kRightMaxNoSpaceStr, D_STR_RIGHTMAX_NOSPACE,
+              stdAc::swingh_t::kRightMax),
+    IRAC_TEXT(kRightMaxStr, D_STR_RIGHTMAX, stdAc::swingh_t::kRightMax),
+    IRAC_TEXT(kMaxRightNoSpaceStr, D_STR_MAXRIGHT_NOSPACE,
+              stdAc::swingh_t::kRightMax),
+    IRAC_TEXT(kMaxRightStr, D_STR_MAXRIGHT, stdAc::swingh_t::kRightMax),
+    IRAC_TEXT(kWideStr, D_STR_WIDE, stdAc::swingh_t::kWide),
+};
+
 /// Convert the supplied str into the appropriate enum.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
 stdAc::swingh_t IRac::strToSwingH(const char *str,
                                   const stdAc::swingh_t def) {
-  if (!STRCASECMP(str, kAutoStr) ||
-      !STRCASECMP(str, kAutomaticStr) ||
-      !STRCASECMP(str, kOnStr) || !STRCASECMP(str, kSwingStr))
-    return stdAc::swingh_t::kAuto;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, kStopStr))
-    return stdAc::swingh_t::kOff;
-  else if (!STRCASECMP(str, kLeftMaxNoSpaceStr) ||              // "LeftMax"
-           !STRCASECMP(str, kLeftMaxStr) ||                     // "Left Max"
-           !STRCASECMP(str, kMaxLeftNoSpaceStr) ||              // "MaxLeft"
-           !STRCASECMP(str, kMaxLeftStr))                       // "Max Left"
-    return stdAc::swingh_t::kLeftMax;
-  else if (!STRCASECMP(str, kLeftStr))
-    return stdAc::swingh_t::kLeft;
-  else if (!STRCASECMP(str, kMidStr) ||
-           !STRCASECMP(str, kMiddleStr) ||
-           !STRCASECMP(str, kMedStr) ||
-           !STRCASECMP(str, kMediumStr) ||
-           !STRCASECMP(str, kCentreStr))
-    return stdAc::swingh_t::kMiddle;
-  else if (!STRCASECMP(str, kRightStr))
-    return stdAc::swingh_t::kRight;
-  else if (!STRCASECMP(str, kRightMaxNoSpaceStr) ||              // "RightMax"
-           !STRCASECMP(str, kRightMaxStr) ||                     // "Right Max"
-           !STRCASECMP(str, kMaxRightNoSpaceStr) ||              // "MaxRight"
-           !STRCASECMP(str, kMaxRightStr))                       // "Max Right"
-    return stdAc::swingh_t::kRightMax;
-  else if (!STRCASECMP(str, kWideStr))
-    return stdAc::swingh_t::kWide;
-  else
-    return def;
+  return (stdAc::swingh_t)irutils::textToValue(
+      str, kSwingHTexts, IRAC_TEXT_COUNT(kSwingHTexts), (int16_t)def);
 }
 
+/// Text to A/C model conversions, in order of precedence.
+static const IRtextValue kModelTexts[] PROGMEM = {
+    // Gree A/C models
+    IRAC_TEXT(kYaw1fStr, D_STR_YAW1F, gree_ac_remote_model_t::YAW1F),
+    IRAC_TEXT(kYbofbStr, D_STR_YBOFB, gree_ac_remote_model_t::YBOFB),
+    IRAC_TEXT(kYx1fsfStr, D_STR_YX1FSF, gree_ac_remote_model_t::YX1FSF),
+    // Haier A/C models
+    IRAC_TEXT(kV9014557AStr, D_STR_V9014557_A,
+              haier_ac176_remote_model_t::V9014557_A),
+    IRAC_TEXT(kV9014557BStr, D_STR_V9014557_B,
+              haier_ac176_remote_model_t::V9014557_B),
+    // HitachiAc1 models
+    IRAC_TEXT(kRlt0541htaaStr, D_STR_RLT0541HTA_A,
+              hitachi_ac1_remote_model_t::R_LT0541_HTA_A),
+    IRAC_TEXT(kRlt0541htabStr, D_STR_RLT0541HTA_B,
+              hitachi_ac1_remote_model_t::R_LT0541_HTA_B),
+    // Fujitsu A/C models
+    IRAC_TEXT(kArrah2eStr, D_STR_ARRAH2E, fujitsu_ac_remote_model_t::ARRAH2E),
+    IRAC_TEXT(kArdb1Str, D_STR_ARDB1, fujitsu_ac_remote_model_t::ARDB1),
+    IRAC_TEXT(kArreb1eStr, D_STR_ARREB1E, fujitsu_ac_remote_model_t::ARREB1E),
+    IRAC_TEXT(kArjw2Str, D_STR_ARJW2, fujitsu_ac_remote_model_t::ARJW2),
+    IRAC_TEXT(kArry4Str, D_STR_ARRY4, fujitsu_ac_remote_model_t::ARRY4),
+    IRAC_TEXT(kArrew4eStr, D_STR_ARREW4E, fujitsu_ac_remote_model_t::ARREW4E),
+    // LG A/C models
+    IRAC_TEXT(kGe6711ar2853mStr, D_STR_GE6711AR2853M,
+              lg_ac_remote_model_t::GE6711AR2853M),
+    IRAC_TEXT(kAkb75215403Str, D_STR_AKB75215403,
+              lg_ac_remote_model_t::AKB75215403),
+    IRAC_TEXT(kAkb74955603Str, D_STR_AKB74955603,
+              lg_ac_remote_model_t::AKB74955603),
+    IRAC_TEXT(kAkb73757604Str, D_STR_AKB73757604,
+              lg_ac_remote_model_t::AKB73757604),
+    IRAC_TEXT(kLg6711a20083vStr, D_STR_LG6711A20083V,
+              lg_ac_remote_model_t::LG6711A20083V),
+    // Panasonic A/C families
+    IRAC_TEXT(kLkeStr, D_STR_LKE, panasonic_ac_remote_model_t::kPanasonicLke),
+    IRAC_TEXT(kPanasonicLkeStr, D_STR_PANASONICLKE,
+              panasonic_ac_remote_model_t::kPanasonicLke),
+    IRAC_TEXT(kNkeStr, D_STR_NKE, panasonic_ac_remote_model_t::kPanasonicNke),
+    IRAC_TEXT(kPanasonicNkeStr, D_STR_PANASONICNKE,
+              panasonic_ac_remote_model_t::kPanasonicNke),
+    IRAC_TEXT(kDkeStr, D_STR_DKE, panasonic_ac_remote_model_t::kPanasonicDke),
+    IRAC_TEXT(kPanasonicDkeStr, D_STR_PANASONICDKE,
+              panasonic_ac_remote_model_t::kPanasonicDke),
+    IRAC_TEXT(kPkrStr, D_STR_PKR, panasonic_ac_remote_model_t::kPanasonicDke),
+    IRAC_TEXT(kPanasonicPkrStr, D_STR_PANASONICPKR,
+              panasonic_ac_remote_model_t::kPanasonicDke),
+    IRAC_TEXT(kJkeStr, D_STR_JKE, panasonic_ac_remote_model_t::kPanasonicJke),
+    IRAC_TEXT(kPanasonicJkeStr, D_STR_PANASONICJKE,
+              panasonic_ac_remote_model_t::kPanasonicJke),
+    IRAC_TEXT(kCkpStr, D_STR_CKP, panasonic_ac_remote_model_t::kPanasonicCkp),
+    IRAC_TEXT(kPanasonicCkpStr, D_STR_PANASONICCKP,
+              panasonic_ac_remote_model_t::kPanasonicCkp),
+    IRAC_TEXT(kRkrStr, D_STR_RKR, panasonic_ac_remote_model_t::kPanasonicRkr),
+    IRAC_TEXT(kPanasonicRkrStr, D_STR_PANASONICRKR,
+              panasonic_ac_remote_model_t::kPanasonicRkr),
+    // Sharp A/C models
+    IRAC_TEXT(kA907Str, D_STR_A907, sharp_ac_remote_model_t::A907),
+    IRAC_TEXT(kA705Str, D_STR_A705, sharp_ac_remote_model_t::A705),
+    IRAC_TEXT(kA903Str, D_STR_A903, sharp_ac_remote_model_t::A903),
+    // TCL A/C models
+    IRAC_TEXT(kTac09chsdStr, D_STR_TAC09CHSD, tcl_ac_remote_model_t::TAC09CHSD),
+    IRAC_TEXT(kGz055be1Str, D_STR_GZ055BE1, tcl_ac_remote_model_t::GZ055BE1),
+    // Voltas A/C models
+    IRAC_TEXT(k122lzfStr, D_STR_122LZF,
+              voltas_ac_remote_model_t::kVoltas122LZF),
+    // Whirlpool A/C models
+    IRAC_TEXT(kDg11j13aStr, D_STR_DG11J13A,
+              whirlpool_ac_remote_model_t::DG11J13A),
+    IRAC_TEXT(kDg11j104Str, D_STR_DG11J104,
+              whirlpool_ac_remote_model_t::DG11J13A),
+    IRAC_TEXT(kDg11j191Str, D_STR_DG11J191,
+              whirlpool_ac_remote_model_t::DG11J191),
+    // Argo A/C models
+    IRAC_TEXT(kArgoWrem2Str, D_STR_ARGO_WREM2,
+              argo_ac_remote_model_t::SAC_WREM2),
+    IRAC_TEXT(kArgoWrem3Str, D_STR_ARGO_WREM3,
+              argo_ac_remote_model_t::SAC_WREM3),
+};
+
 /// Convert the supplied str into the appropriate enum.
 /// @note Assumes str is the model code or an integer >= 1.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The enum to return if no conversion was possible.
 /// @return The equivalent enum.
-/// @note After adding a new model you should update modelToStr() too.
+/// @note After adding a new model you should update kModelTexts[] and
+///   modelToStr() too.
 int16_t IRac::strToModel(const char *str, const int16_t def) {
-  // Gree
-  if (!STRCASECMP(str, kYaw1fStr)) {
-    return gree_ac_remote_model_t::YAW1F;
-  } else if (!STRCASECMP(str, kYbofbStr)) {
-    return gree_ac_remote_model_t::YBOFB;
-  } else if (!STRCASECMP(str, kYx1fsfStr)) {
-    return gree_ac_remote_model_t::YX1FSF;
-  // Haier models
-  } else if (!STRCASECMP(str, kV9014557AStr)) {
-    return haier_ac176_remote_model_t::V9014557_A;
-  } else if (!STRCASECMP(str, kV9014557BStr)) {
-    return haier_ac176_remote_model_t::V9014557_B;
-  // HitachiAc1 models
-  } else if (!STRCASECMP(str, kRlt0541htaaStr)) {
-    return hitachi_ac1_remote_model_t::R_LT0541_HTA_A;
-  } else if (!STRCASECMP(str, kRlt0541htabStr)) {
-    return hitachi_ac1_remote_model_t::R_LT0541_HTA_B;
-  // Fujitsu A/C models
-  } else if (!STRCASECMP(str, kArrah2eStr)) {
-    return fujitsu_ac_remote_model_t::ARRAH2E;
-  } else if (!STRCASECMP(str, kArdb1Str)) {
-    return fujitsu_ac_remote_model_t::ARDB1;
-  } else if (!STRCASECMP(str, kArreb1eStr)) {
-    return fujitsu_ac_remote_model_t::ARREB1E;
-  } else if (!STRCASECMP(str, kArjw2Str)) {
-    return fujitsu_ac_remote_model_t::ARJW2;
-  } else if (!STRCASECMP(str, kArry4Str)) {
-    return fujitsu_ac_remote_model_t::ARRY4;
-  } else if (!STRCASECMP(str, kArrew4eStr)) {
-    return fujitsu_ac_remote_model_t::ARREW4E;
-  // LG A/C models
-  } else if (!STRCASECMP(str, kGe6711ar2853mStr)) {
-    return lg_ac_remote_model_t::GE6711AR2853M;
-  } else if (!STRCASECMP(str, kAkb75215403Str)) {
-    return lg_ac_remote_model_t::AKB75215403;
-  } else if (!STRCASECMP(str, kAkb74955603Str)) {
-    return lg_ac_remote_model_t::AKB74955603;
-  } else if (!STRCASECMP(str, kAkb73757604Str)) {
-    return lg_ac_remote_model_t::AKB73757604;
-  } else if (!STRCASECMP(str, kLg6711a20083vStr)) {
-    return lg_ac_remote_model_t::LG6711A20083V;
-  // Panasonic A/C families
-  } else if (!STRCASECMP(str, kLkeStr) ||
-             !STRCASECMP(str, kPanasonicLkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicLke;
-  } else if (!STRCASECMP(str, kNkeStr) ||
-             !STRCASECMP(str, kPanasonicNkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicNke;
-  } else if (!STRCASECMP(str, kDkeStr) ||
-             !STRCASECMP(str, kPanasonicDkeStr) ||
-             !STRCASECMP(str, kPkrStr) ||
-             !STRCASECMP(str, kPanasonicPkrStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicDke;
-  } else if (!STRCASECMP(str, kJkeStr) ||
-             !STRCASECMP(str, kPanasonicJkeStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicJke;
-  } else if (!STRCASECMP(str, kCkpStr) ||
-             !STRCASECMP(str, kPanasonicCkpStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicCkp;
-  } else if (!STRCASECMP(str, kRkrStr) ||
-             !STRCASECMP(str, kPanasonicRkrStr)) {
-    return panasonic_ac_remote_model_t::kPanasonicRkr;
-  // Sharp A/C Models
-  } else if (!STRCASECMP(str, kA907Str)) {
-    return sharp_ac_remote_model_t::A907;
-  } else if (!STRCASECMP(str, kA705Str)) {
-    return sharp_ac_remote_model_t::A705;
-  } else if (!STRCASECMP(str, kA903Str)) {
-    return sharp_ac_remote_model_t::A903;
-  // TCL A/C Models
-  } else if (!STRCASECMP(str, kTac09chsdStr)) {
-    return tcl_ac_remote_model_t::TAC09CHSD;
-  } else if (!STRCASECMP(str, kGz055be1Str)) {
-    return tcl_ac_remote_model_t::GZ055BE1;
-  // Voltas A/C models
-  } else if (!STRCASECMP(str, k122lzfStr)) {
-    return voltas_ac_remote_model_t::kVoltas122LZF;
-  // Whirlpool A/C models
-  } else if (!STRCASECMP(str, kDg11j13aStr) ||
-             !STRCASECMP(str, kDg11j104Str)) {
-    return whirlpool_ac_remote_model_t::DG11J13A;
-  } else if (!STRCASECMP(str, kDg11j191Str)) {
-    return whirlpool_ac_remote_model_t::DG11J191;
-  // Argo A/C models
-  } else if (!STRCASECMP(str, kArgoWrem2Str)) {
-    return argo_ac_remote_model_t::SAC_WREM2;
-  } else if (!STRCASECMP(str, kArgoWrem3Str)) {
-    return argo_ac_remote_model_t::SAC_WREM3;
-  } else {
-    int16_t number = atoi(str);
-    if (number > 0)
-      return number;
-    else
-      return def;
-  }
+  const int16_t model = irutils::textToValue(str, kModelTexts,
+                                              IRAC_TEXT_COUNT(kModelTexts), -1);
+  if (model >= 0) return model;
+  int16_t number = atoi(str);
+  if (number > 0)
+    return number;
+  else
+    return def;
 }
 
+/// Text to boolean value conversions, in order of precedence.
+static const IRtextValue kBoolTexts[] PROGMEM = {
+    IRAC_TEXT(kOnStr, D_STR_ON, true),
+    IRAC_TEXT(k1Str, D_STR_1, true),
+    IRAC_TEXT(kYesStr, D_STR_YES, true),
+    IRAC_TEXT(kTrueStr, D_STR_TRUE, true),
+    IRAC_TEXT(kOffStr, D_STR_OFF, false),
+    IRAC_TEXT(k0Str, D_STR_0, false),
+    IRAC_TEXT(kNoStr, D_STR_NO, false),
+    IRAC_TEXT(kFalseStr, D_STR_FALSE, false),
+};
+
 /// Convert the supplied str into the appropriate boolean value.
 /// @param[in] str A Ptr to a C-style string to be converted.
 /// @param[in] def The boolean value to return if no conversion was possible.
 /// @return The equivalent boolean value.
 bool IRac::strToBool(const char *str, const bool def) {
-  if (!STRCASECMP(str, kOnStr) ||
-      !STRCASECMP(str, k1Str) ||
-      !STRCASECMP(str, kYesStr) ||
-      !STRCASECMP(str, kTrueStr))
-    return true;
-  else if (!STRCASECMP(str, kOffStr) ||
-           !STRCASECMP(str, k0Str) ||
-           !STRCASECMP(str, kNoStr) ||
-           !STRCASECMP(str, kFalseStr))
-    return false;
-  else
-    return def;
+  return irutils::textToValue(str, kBoolTexts, IRAC_TEXT_COUNT(kBoolTexts),
+                              def);
 }
 
 /// Convert the supplied boolean into the appropriate String.
 /// @param[in] value The boolean value to be converted.
 /// @return The equivalent String for the locale.
-String IRac::boolToString(const bool value) {
-  return value ? kOnStr : kOffStr;
-}
+String IRac::boolToString(const bool value) { return boolToText(value); }
 
 /// Convert the supplied operation mode into the appropriate String.
 /// @param[in] cmdType The enum to be converted.
 /// @return The equivalent String for the locale.
 String IRac::commandTypeToString(const stdAc::ac_command_t cmdType) {
+  return commandTypeToText(cmdType);
+}
+
+/// Convert the supplied operation mode into the appropriate String.
+/// @param[in] mode The enum to be converted.
+/// @param[in] ha A flag to indicate we want GoogleHome/HomeAssistant output.
+/// @return The equivalent String for the locale.
+String IRac::opmodeToString(const stdAc::opmode_t mode, const bool ha) {
+  return opmodeToText(mode, ha);
+}
+
+/// Convert the supplied fan speed enum into the appropriate String.
+/// @param[in] speed The enum to be converted.
+/// @return The equivalent String for the locale.
+String IRac::fanspeedToString(const stdAc::fanspeed_t speed) {
+  return fanspeedToText(speed);
+}
+
+/// Convert the supplied enum into the appropriate String.
+/// @param[in] swingv The enum to be converted.
+/// @return The equivalent String for the locale.
+String IRac::swingvToString(const stdAc::swingv_t swingv) {
+  return swingvToText(swingv);
+}
+
+/// Convert the supplied enum into the appropriate String.
+/// @param[in] swingh The enum to be converted.
+/// @return The equivalent String for the locale.
+String IRac::swinghToString(const stdAc::swingh_t swingh) {
+  return swinghToText(swingh);
+}
+
+/// Convert the supplied boolean into the appropriate text.
+/// @param[in] value The boolean value to be converted.
+/// @return A Ptr to the equivalent IRtext string for the locale.
+irtext_ptr_t IRac::boolToText(const bool value) {
+  return value ? kOnStr : kOffStr;
+}
+
+/// Convert the supplied operation mode into the appropriate text.
+/// @param[in] cmdType The enum to be converted.
+/// @return A Ptr to the equivalent IRtext string for the locale.
+irtext_ptr_t IRac::commandTypeToText(const stdAc::ac_command_t cmdType) {
   switch (cmdType) {
     case stdAc::ac_command_t::kControlCommand:    return kControlCommandStr;
     case stdAc::ac_command_t::kSensorTempReport: return kIFeelReportStr;
@@ -978,11 +1505,11 @@ String IRac::commandTypeToString(const stdAc::ac_command_t cmdType) {
   }
 }
 
-/// Convert the supplied operation mode into the appropriate String.
+/// Convert the supplied operation mode into the appropriate text.
 /// @param[in] mode The enum to be converted.
 /// @param[in] ha A flag to indicate we want GoogleHome/HomeAssistant output.
-/// @return The equivalent String for the locale.
-String IRac::opmodeToString(const stdAc::opmode_t mode, const bool ha) {
+/// @return A Ptr to the equivalent IRtext string for the locale.
+irtext_ptr_t IRac::opmodeToText(const stdAc::opmode_t mode, const bool ha) {
   switch (mode) {
     case stdAc::opmode_t::kOff:  return kOffStr;
     case stdAc::opmode_t::kAuto: return kAutoStr;
@@ -994,10 +1521,10 @@ String IRac::opmodeToString(const stdAc::opmode_t mode, const bool ha) {
   }
 }
 
-/// Convert the supplied fan speed enum into the appropriate String.
+/// Convert the supplied fan speed enum into the appropriate text.
 /// @param[in] speed The enum to be converted.
-/// @return The equivalent String for the locale.
-String IRac::fanspeedToString(const stdAc::fanspeed_t speed) {
+/// @return A Ptr to the equivalent IRtext string for the locale.
+irtext_ptr_t IRac::fanspeedToText(const stdAc::fanspeed_t speed) {
   switch (speed) {
     case stdAc::fanspeed_t::kAuto:       return kAutoStr;
     case stdAc::fanspeed_t::kMax:        return kMaxStr;
@@ -1010,10 +1537,10 @@ String IRac::fanspeedToString(const stdAc::fanspeed_t speed) {
   }
 }
 
-/// Convert the supplied enum into the appropriate String.
+/// Convert the supplied enum into the appropriate text.
 /// @param[in] swingv The enum to be converted.
-/// @return The equivalent String for the locale.
-String IRac::swingvToString(const stdAc::swingv_t swingv) {
+/// @return A Ptr to the equivalent IRtext string for the locale.
+irtext_ptr_t IRac::swingvToText(const stdAc::swingv_t swingv) {
   switch (swingv) {
     case stdAc::swingv_t::kOff:          return kOffStr;
     case stdAc::swingv_t::kAuto:         return kAutoStr;
@@ -1027,10 +1554,10 @@ String IRac::swingvToString(const stdAc::swingv_t swingv) {
   }
 }
 
-/// Convert the supplied enum into the appropriate String.
+/// Convert the supplied enum into the appropriate text.
 /// @param[in] swingh The enum to be converted.
-/// @return The equivalent String for the locale.
-String IRac::swinghToString(const stdAc::swingh_t swingh) {
+/// @return A Ptr to the equivalent IRtext string for the locale.
+irtext_ptr_t IRac::swinghToText(const stdAc::swingh_t swingh) {
   switch (swingh) {
     case stdAc::swingh_t::kOff:      return kOffStr;
     case stdAc::swingh_t::kAuto:     return kAutoStr;
@@ -1051,24 +1578,42 @@ namespace IRAcUtils {
   /// @return A string with the human description of the A/C message.
   ///   An empty string if we can't.
   String resultAcToString(const decode_results * const result) {
+    String text = "";
+    IRtextSink out(&text);
+    resultAcToString(&out, result);
+    return text;
+  }
+
+  /// Add the human readable state of an A/C message, if we can, to a text
+  /// sink. e.g. A fixed size char buffer, or a Print object.
+  /// Nothing is allocated.
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] result A Ptr to the captured `decode_results` that contains an
+  ///   A/C mesg.
+  /// @return true, if we added a description. false, if we can't describe it.
+  bool resultAcToString(IRtextSink *out,
+                        const decode_results * const result) {
     switch (result->decode_type) {
 #if DECODE_LG
       case decode_type_t::LG:
       case decode_type_t::LG2: {
         IRLgAc ac(kGpioUnused);
         ac.setRaw(result->value, result->decode_type);  // Use value, not state.
-        return ac.isValidLgAc() ? ac.toString() : "";
+        if (!ac.isValidLgAc()) return false;
+        ac.toString(out);
+        return true;
       }
 #endif  // DECODE_LG
 #if DECODE_RHOSS
     case decode_type_t::RHOSS: {
       IRRhossAc ac(kGpioUnused);
       ac.setRaw(result->state);
-      return ac.toString();
+      ac.toString(out);
+      return true;
     }
 #endif  // DECODE_RHOSS
       default:
-        return "";
+        return false;
     }
   }
 
@@ -9,11 +9,30 @@
 #include <memory>
 #endif
 #include "IRremoteESP8266.h"
+#include "IRscheduler.h"
 #include "ir_LG.h"
 #include "ir_Rhoss.h"
 
 // Constants
 const int8_t kGpioUnused = -1;  ///< A placeholder for not using an actual GPIO.
+const uint8_t kIrAcPoolSize = 4;  ///< Max. nr. of A/C objects IRac will keep.
+/// Default max. nr. of bytes of A/C objects IRac may keep for reuse.
+const uint32_t kIrAcPoolBudget = 256;
+const uint8_t kIrAcZonePriorities = 8;  ///< Nr. of zone priority levels.
+const uint8_t kIrAcZoneDefaultPriority = kIrAcZonePriorities / 2;
+const uint16_t kIrAcZoneNone = UINT16_MAX;  ///< Not a valid zone index.
+
+/// A reusable A/C protocol object kept by IRac, & what it was last set up for.
+struct IRacPoolEntry {
+  decode_type_t protocol;  ///< Protocol of the object. UNKNOWN if unused.
+  int16_t model;  ///< The model the object was created for.
+  void *ac;  ///< Ptr to the protocol object. e.g. An IRLgAc.
+  uint32_t size;  ///< Nr. of bytes the object uses.
+  uint32_t lastUsed;  ///< When it was last used, for evicting old objects.
+  bool primed;  ///< Can the object be resent as-is if `last` matches?
+  stdAc::packed_state_t last;  ///< The state it was last set up for.
+  stdAc::swingv_t lastSwingvPrev;  ///< The previous swingv it was set up with.
+};
 
 // Class
 /// A universal/common/generic interface for controling supported A/Cs.
@@ -21,6 +40,9 @@ class IRac {
  public:
   explicit IRac(const uint16_t pin, const bool inverted = false,
                 const bool use_modulation = true);
+  IRac(const IRac &other);
+  IRac &operator=(const IRac &other);
+  ~IRac(void);
   static bool isProtocolSupported(const decode_type_t protocol);
   static void initState(stdAc::state_t *state,
                         const decode_type_t vendor, const int16_t model,
@@ -46,6 +68,11 @@ class IRac {
               const bool beep, const int16_t sleep = -1,
               const int16_t clock = -1);
   static bool cmpStates(const stdAc::state_t a, const stdAc::state_t b);
+  static bool cmpStates(const stdAc::packed_state_t a,
+                        const stdAc::packed_state_t b);
+  static stdAc::packed_state_t packState(const stdAc::state_t state);
+  static stdAc::state_t unpackState(const stdAc::packed_state_t packed);
+  static uint32_t hashState(const stdAc::packed_state_t state);
   static bool strToBool(const char *str, const bool def = false);
   static int16_t strToModel(const char *str, const int16_t def = -1);
   static stdAc::ac_command_t strToCommandType(const char *str,
@@ -66,9 +93,20 @@ class IRac {
   static String fanspeedToString(const stdAc::fanspeed_t speed);
   static String swingvToString(const stdAc::swingv_t swingv);
   static String swinghToString(const stdAc::swingh_t swingh);
+  static irtext_ptr_t boolToText(const bool value);
+  static irtext_ptr_t commandTypeToText(const stdAc::ac_command_t cmdType);
+  static irtext_ptr_t opmodeToText(const stdAc::opmode_t mode,
+                                   const bool ha = false);
+  static irtext_ptr_t fanspeedToText(const stdAc::fanspeed_t speed);
+  static irtext_ptr_t swingvToText(const stdAc::swingv_t swingv);
+  static irtext_ptr_t swinghToText(const stdAc::swingh_t swingh);
   stdAc::state_t getState(void);
   stdAc::state_t getStatePrev(void);
   bool hasStateChanged(void);
+  void setPoolBudget(const uint32_t bytes);
+  uint32_t getPoolBudget(void) const;
+  uint32_t getPoolFootprint(void) const;
+  void clearPool(void);
   stdAc::state_t next;  ///< The state we want the device to be in after we send
 #ifdef UNIT_TEST
   /// @cond IGNORE
@@ -85,26 +123,99 @@ class IRac {
   bool _inverted;  ///< IR LED is lit when GPIO is LOW (true) or HIGH (false)?
   bool _modulation;  ///< Is frequency modulation to be used?
   stdAc::state_t _prev;  ///< The state we expect the device to currently be in.
+  IRacPoolEntry _pool[kIrAcPoolSize];  ///< A/C objects kept for reuse.
+  uint32_t _poolBudget;  ///< Max. nr. of bytes the pooled objects may use.
+  uint32_t _poolClock;  ///< Counter used to find the least recently used.
+  IRacPoolEntry *_poolGet(const decode_type_t protocol, const int16_t model,
+                          const uint32_t size);
+  IRacPoolEntry *_poolOldest(void);
+  void _poolFree(IRacPoolEntry *entry);
+  static bool _poolIsCurrent(const IRacPoolEntry *entry,
+                             const stdAc::state_t state,
+                             const stdAc::swingv_t swingv_prev);
+  static void _poolSetCurrent(IRacPoolEntry *entry,
+                              const stdAc::state_t state,
+                              const stdAc::swingv_t swingv_prev);
 #if SEND_LG
   void lg(IRLgAc *ac, const lg_ac_remote_model_t model,
           const bool on, const stdAc::opmode_t mode,
           const float degrees, const stdAc::fanspeed_t fan,
           const stdAc::swingv_t swingv, const stdAc::swingv_t swingv_prev,
-          const stdAc::swingh_t swingh, const bool light);
+          const stdAc::swingh_t swingh, const bool light,
+          const bool init = true);
 #endif  // SEND_LG
 #if SEND_RHOSS
   void rhoss(IRRhossAc *ac,
                 const bool on, const stdAc::opmode_t mode, const float degrees,
-                const stdAc::fanspeed_t fan, const stdAc::swingv_t swing);
+                const stdAc::fanspeed_t fan, const stdAc::swingv_t swing,
+                const bool init = true);
 #endif  // SEND_RHOSS
 static stdAc::state_t cleanState(const stdAc::state_t state);
 static stdAc::state_t handleToggles(const stdAc::state_t desired,
                                     const stdAc::state_t *prev = NULL);
 };  // IRac class
 
+/// A job that sends an A/C state via an IRac object when it runs.
+/// e.g. An "off timer", or a periodic resend of the current state for units
+/// that forget it.
+/// @note Use with an IRscheduler.
+class IRacJob : public IRschedulerJob {
+ public:
+  explicit IRacJob(IRac *ac);
+  IRacJob(IRac *ac, const stdAc::state_t state);
+  void run(void);
+  IRac *ac;  ///< The object to send the state with.
+  stdAc::state_t state;  ///< The state to send. Ignored if `resend` is set.
+  bool resend;  ///< Resend whatever the IRac object's `next` state is.
+};
+
+/// The storage for a single A/C zone managed by an IRacZones object.
+/// @note Use the IRacZones methods, rather than changing these directly.
+struct IRacZone {
+  stdAc::packed_state_t next;  ///< The state we want the zone to be in.
+  stdAc::packed_state_t prev;  ///< The state we expect the zone to be in.
+  IRac *ac;  ///< What to send with. Often shared with other zones.
+  uint16_t link;  ///< The next zone waiting to be sent at the same priority.
+  uint8_t priority;  ///< Lower values are sent first.
+  bool queued;  ///< Is it waiting to be sent?
+  bool force;  ///< Send it, even if it hasn't changed.
+};
+
+/// Manage the states of lots of A/C zones, and only send the ones that have
+/// changed.
+/// e.g. 40+ indoor units, each with its own protocol, model, & previous
+/// state, sharing a handful of IR LEDs (IRac objects).
+/// @note Storage is supplied by the caller, so there is no memory allocation.
+///   Work done by apply() is proportional to the nr. of changed zones, not
+///   the total nr. of zones.
+class IRacZones {
+ public:
+  IRacZones(IRacZone zones[], const uint16_t count);
+  uint16_t size(void) const;
+  bool setup(const uint16_t zone, IRac *ac,
+             const uint8_t priority = kIrAcZoneDefaultPriority);
+  bool setState(const uint16_t zone, const stdAc::state_t state);
+  stdAc::state_t getState(const uint16_t zone) const;
+  stdAc::state_t getStatePrev(const uint16_t zone) const;
+  bool hasStateChanged(const uint16_t zone) const;
+  bool resend(const uint16_t zone);
+  uint16_t pending(void) const;
+  uint16_t apply(const uint16_t limit = UINT16_MAX);
+
+ private:
+  IRacZone *_zones;  ///< Ptr to the caller supplied zone storage.
+  uint16_t _count;  ///< Nr. of zones in the storage.
+  uint16_t _pending;  ///< Nr. of zones waiting to be sent.
+  uint16_t _head[kIrAcZonePriorities];  ///< First waiting zone per priority.
+  uint16_t _tail[kIrAcZonePriorities];  ///< Last waiting zone per priority.
+  void _queue(const uint16_t zone);
+};
+
 /// Common functions for use with all A/Cs supported by the IRac class.
 namespace IRAcUtils {
   String resultAcToString(const decode_results * const results);
+  bool resultAcToString(IRtextSink *out,
+                        const decode_results * const results);
   bool decodeToState(const decode_results *decode, stdAc::state_t *result,
                      const stdAc::state_t *prev = NULL);
 }  // namespace IRAcUtils
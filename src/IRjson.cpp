@@ -0,0 +1,595 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+/// @file
+/// @brief An allocation-free JSON writer & reader for `stdAc::state_t` and
+///   `decode_results`. See IRjson.h for the format.
+
+#include "IRjson.h"
+#include <stdlib.h>
+#include <string.h>
+#include "IRac.h"
+#include "IRtext.h"
+
+/// Add a key (in flash on the ESP8266) to a JSON object that already has one.
+#define IRJSON_ADD_KEY(OUT, KEY) (OUT)->add(F(",\"" KEY "\":"))
+/// Does `key` match KEY? `hash` must be the `irutils::textHash()` of `key`.
+/// `irtextHash()` is constexpr, so only `hash` is calculated at runtime.
+#define IRJSON_KEY_IS(KEY) (hash == irtextHash(KEY) && !strcmp(key, KEY))
+
+/// Reads JSON tokens from a bounded buffer, keeping track of whether they were
+/// valid. Strings are unescaped into caller supplied buffers.
+class IRjsonReader {
+ public:
+  /// The kinds of values value() can read.
+  enum type_t {
+    kNull = 0,
+    kBool,  ///< The text is "true" or "false".
+    kNumber,  ///< The text is a number that strtod() can read.
+    kString,  ///< The text is the unescaped string.
+    kOther,  ///< An object, array, or a string or number too long to keep.
+  };
+
+  IRjsonReader(const char *json, const size_t length)
+      : _ptr(json), _end(json != NULL ? json + length : json),
+        _ok(json != NULL) {}
+
+  bool ok(void) const { return _ok; }
+
+  /// Skip any whitespace, then consume `c` if it is next.
+  /// @return true, if it was next. Otherwise, false.
+  bool next(const char c) {
+    skipSpace();
+    if (_ptr < _end && *_ptr == c) {
+      _ptr++;
+      return true;
+    }
+    return false;
+  }
+
+  /// `c` must be next.
+  void expect(const char c) { if (!next(c)) _ok = false; }
+
+  /// Is there nothing left but whitespace? A NUL also ends the text.
+  bool atEnd(void) {
+    skipSpace();
+    return _ptr == _end || *_ptr == '\0';
+  }
+
+  /// Read a string. It is truncated if it doesn't fit, & always NUL terminated.
+  /// @param[out] buffer Where to put the unescaped string. May be NULL.
+  /// @param[in] size The size of the buffer.
+  /// @return true, if it was valid & fitted. Otherwise, false.
+  bool string(char *buffer, const size_t size) {
+    size_t length = 0;
+    bool fits = (buffer != NULL && size > 0);
+    expect('"');
+    while (_ok) {
+      if (_ptr >= _end) {
+        _ok = false;
+        break;
+      }
+      uint32_t c = (uint8_t)*_ptr++;
+      if (c == '"') break;
+      if (c < 0x20) {  // Control chars must be escaped.
+        _ok = false;
+        break;
+      }
+      if (c == '\\') {
+        if (_ptr >= _end) {
+          _ok = false;
+          break;
+        }
+        switch (*_ptr++) {
+          case '"':  c = '"'; break;
+          case '\\': c = '\\'; break;
+          case '/':  c = '/'; break;
+          case 'b':  c = '\b'; break;
+          case 'f':  c = '\f'; break;
+          case 'n':  c = '\n'; break;
+          case 'r':  c = '\r'; break;
+          case 't':  c = '\t'; break;
+          case 'u':  c = hex4(); break;
+          default:   _ok = false;
+        }
+        if (c >= 0x800) {  // Encode it as UTF-8.
+          put(buffer, size, &length, &fits, 0xE0 | (c >> 12));
+          put(buffer, size, &length, &fits, 0x80 | ((c >> 6) & 0x3F));
+          c = 0x80 | (c & 0x3F);
+        } else if (c >= 0x80) {
+          put(buffer, size, &length, &fits, 0xC0 | (c >> 6));
+          c = 0x80 | (c & 0x3F);
+        }
+      }
+      put(buffer, size, &length, &fits, c);
+    }
+    if (buffer != NULL && size > 0) buffer[length] = 0;  // put() left room.
+    return _ok && fits;
+  }
+
+  /// Read a value, skipping over any objects & arrays.
+  /// @param[out] buffer Where to put the text of the value. May be NULL.
+  /// @param[in] size The size of the buffer.
+  /// @return What kind of value it was.
+  type_t value(char *buffer, const size_t size) {
+    return value(buffer, size, 0);
+  }
+
+ private:
+  const char *_ptr;  ///< The next char to read.
+  const char *_end;  ///< Just past the last char we may read.
+  bool _ok;  ///< Has everything been valid so far?
+
+  void skipSpace(void) {
+    while (_ptr < _end &&
+           (*_ptr == ' ' || *_ptr == '\t' || *_ptr == '\n' || *_ptr == '\r'))
+      _ptr++;
+  }
+
+  static void put(char *buffer, const size_t size, size_t *length, bool *fits,
+                  const uint8_t c) {
+    if (*length + 1 < size)
+      buffer[(*length)++] = c;
+    else
+      *fits = false;
+  }
+
+  /// Read the 4 hex digits of a \\u escape.
+  uint16_t hex4(void) {
+    uint16_t result = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+      const char c = (_ptr < _end) ? *_ptr++ : 0;
+      result <<= 4;
+      if (c >= '0' && c <= '9') result |= c - '0';
+      else if (c >= 'a' && c <= 'f') result |= c - 'a' + 10;
+      else if (c >= 'A' && c <= 'F') result |= c - 'A' + 10;
+      else
+        _ok = false;
+    }
+    return result;
+  }
+
+  /// Consume a literal. e.g. true
+  type_t literal(const char *word, const type_t type, char *buffer,
+                 const size_t size) {
+    const size_t length = strlen(word);
+    if ((size_t)(_end - _ptr) < length || strncmp(_ptr, word, length)) {
+      _ok = false;
+      return kOther;
+    }
+    _ptr += length;
+    if (buffer != NULL && size > length) memcpy(buffer, word, length + 1);
+    return type;
+  }
+
+  type_t number(char *buffer, const size_t size) {
+    const char *start = _ptr;
+    while (_ptr < _end && ((*_ptr >= '0' && *_ptr <= '9') || *_ptr == '-' ||
+                           *_ptr == '+' || *_ptr == '.' || *_ptr == 'e' ||
+                           *_ptr == 'E'))
+      _ptr++;
+    const size_t length = _ptr - start;
+    char text[32];  // Plenty for any number we'd want to keep.
+    if (length == 0 || length >= sizeof(text)) {
+      _ok = (length > 0);
+      return kOther;
+    }
+    memcpy(text, start, length);
+    text[length] = 0;
+    char *end;
+    strtod(text, &end);
+    if (end != text + length) {
+      _ok = false;
+      return kOther;
+    }
+    if (buffer == NULL || size <= length) return kOther;
+    memcpy(buffer, text, length + 1);
+    return kNumber;
+  }
+
+  type_t value(char *buffer, const size_t size, const uint8_t depth) {
+    skipSpace();
+    if (!_ok || _ptr >= _end) {
+      _ok = false;
+      return kOther;
+    }
+    switch (*_ptr) {
+      case '"': return string(buffer, size) ? kString : kOther;
+      case 't': return literal("true", kBool, buffer, size);
+      case 'f': return literal("false", kBool, buffer, size);
+      case 'n': return literal("null", kNull, buffer, size);
+      case '{':
+      case '[':
+        skip(depth);
+        return kOther;
+      default: return number(buffer, size);
+    }
+  }
+
+  /// Skip over an object or an array.
+  void skip(const uint8_t depth) {
+    if (depth >= kIrJsonDepthMax) {
+      _ok = false;
+      return;
+    }
+    const bool object = next('{');
+    if (!object) expect('[');
+    if (next(object ? '}' : ']')) return;
+    while (_ok) {
+      if (object) {
+        string(NULL, 0);
+        expect(':');
+      }
+      value(NULL, 0, depth + 1);
+      if (!next(',')) break;
+    }
+    expect(object ? '}' : ']');
+  }
+};
+
+/// Read a JSON object, passing each value to a handler.
+/// @param[in] json The JSON text.
+/// @param[in] length The nr. of chars in the text.
+/// @param[in] handler A function that reads the value of a key.
+/// @param[in,out] data Passed to the handler.
+/// @return true, if it was a valid JSON object. Otherwise, false.
+static bool readObject(const char *json, const size_t length,
+                       void (*handler)(IRjsonReader *in, const char *key,
+                                       void *data),
+                       void *data) {
+  IRjsonReader in(json, length);
+  in.expect('{');
+  if (!in.next('}')) {
+    while (in.ok()) {
+      char key[16];  // Longer than any key we know.
+      if (!in.string(key, sizeof(key))) key[0] = 0;  // Too long, so unknown.
+      in.expect(':');
+      if (in.ok()) handler(&in, key, data);
+      if (!in.next(',')) break;
+    }
+    in.expect('}');
+  }
+  return in.ok() && in.atEnd();
+}
+
+/// Convert a JSON value to a bool, the way IRac::strToBool() does.
+/// @param[in] type The kind of value.
+/// @param[in] text The text of the value.
+/// @param[in] def The value to return if it can't be converted.
+/// @return The equivalent boolean value.
+static bool toBool(const IRjsonReader::type_t type, const char *text,
+                   const bool def) {
+  switch (type) {
+    case IRjsonReader::kBool:   return text[0] == 't';
+    case IRjsonReader::kString: return IRac::strToBool(text, def);
+    case IRjsonReader::kNumber: return strtod(text, NULL) != 0;
+    default:                    return def;
+  }
+}
+
+/// Convert a JSON number to an integer, if it is within a range.
+/// @param[in] type The kind of value.
+/// @param[in] text The text of the value.
+/// @param[in] min The smallest value allowed.
+/// @param[in] max The largest value allowed.
+/// @param[in] def The value to return if it can't be converted.
+/// @return The integer value.
+static int32_t toInt(const IRjsonReader::type_t type, const char *text,
+                     const int32_t min, const int32_t max, const int32_t def) {
+  if (type != IRjsonReader::kNumber) return def;
+  const double value = strtod(text, NULL);
+  return (value >= min && value <= max) ? (int32_t)value : def;
+}
+
+/// Convert a JSON number to an unsigned 32-bit integer, if it fits.
+/// @param[in] type The kind of value.
+/// @param[in] text The text of the value.
+/// @param[in] def The value to return if it can't be converted.
+/// @return The integer value.
+static uint32_t toUint(const IRjsonReader::type_t type, const char *text,
+                       const uint32_t def) {
+  if (type != IRjsonReader::kNumber) return def;
+  const double value = strtod(text, NULL);
+  return (value >= 0 && value <= UINT32_MAX) ? (uint32_t)value : def;
+}
+
+/// Update a state_t with the value of a key. Unknown keys are ignored.
+static void readStateValue(IRjsonReader *in, const char *key, void *data) {
+  stdAc::state_t *state = static_cast<stdAc::state_t *>(data);
+  char text[kIrJsonValueMax];
+  const IRjsonReader::type_t type = in->value(text, sizeof(text));
+  const bool isText = (type == IRjsonReader::kString);
+  const uint32_t hash = irutils::textHash(key);
+  if (IRJSON_KEY_IS(IRJSON_KEY_PROTOCOL)) {
+    if (isText)
+      state->protocol = strToDecodeType(text);
+    else
+      state->protocol = (decode_type_t)toInt(type, text, decode_type_t::UNKNOWN,
+                                             kLastDecodeType, state->protocol);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_MODEL)) {
+    if (isText)
+      state->model = IRac::strToModel(text, state->model);
+    else
+      state->model = toInt(type, text, INT16_MIN, INT16_MAX, state->model);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_COMMAND)) {
+    if (isText)
+      state->command = IRac::strToCommandType(text, state->command);
+    else
+      state->command = (stdAc::ac_command_t)toInt(
+          type, text, 0, (int32_t)stdAc::ac_command_t::kLastAcCommandEnum,
+          (int32_t)state->command);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_MODE)) {
+    if (isText) state->mode = IRac::strToOpmode(text, state->mode);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_FANSPEED)) {
+    if (isText) state->fanspeed = IRac::strToFanspeed(text, state->fanspeed);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_SWINGV)) {
+    if (isText) state->swingv = IRac::strToSwingV(text, state->swingv);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_SWINGH)) {
+    if (isText) state->swingh = IRac::strToSwingH(text, state->swingh);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_TEMP)) {
+    if (type == IRjsonReader::kNumber) state->degrees = strtod(text, NULL);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_SENSORTEMP)) {
+    if (type == IRjsonReader::kNumber)
+      state->sensorTemperature = strtod(text, NULL);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_SLEEP)) {
+    state->sleep = toInt(type, text, INT16_MIN, INT16_MAX, state->sleep);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_CLOCK)) {
+    state->clock = toInt(type, text, INT16_MIN, INT16_MAX, state->clock);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_POWER)) {
+    state->power = toBool(type, text, state->power);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_CELSIUS)) {
+    state->celsius = toBool(type, text, state->celsius);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_QUIET)) {
+    state->quiet = toBool(type, text, state->quiet);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_IFEEL)) {
+    state->iFeel = toBool(type, text, state->iFeel);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_TURBO)) {
+    state->turbo = toBool(type, text, state->turbo);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_ECONO)) {
+    state->econo = toBool(type, text, state->econo);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_LIGHT)) {
+    state->light = toBool(type, text, state->light);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_FILTER)) {
+    state->filter = toBool(type, text, state->filter);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_CLEAN)) {
+    state->clean = toBool(type, text, state->clean);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_BEEP)) {
+    state->beep = toBool(type, text, state->beep);
+  }
+}
+
+/// What we've read of a decode_results so far.
+struct IRjsonResults {
+  bool ok;  ///< Was everything we needed valid?
+  bool hasType;  ///< Have we seen the protocol?
+  decode_type_t decode_type;  ///< The protocol.
+  int32_t bits;  ///< Nr. of bits. -1 if we haven't seen it.
+  uint16_t codeLength;  ///< Nr. of bytes in `code`. 0 if we haven't seen it.
+  uint8_t code[kStateSizeMax];  ///< The value/state[], most significant first.
+  uint32_t address;  ///< The address.
+  uint32_t command;  ///< The command.
+  bool repeat;  ///< Is it a repeat?
+};
+
+/// Convert a hexadecimal string into bytes, most significant first.
+/// @param[in] text The text. e.g. "0x1A2B3C"
+/// @param[out] code Where to put the bytes.
+/// @param[in] size The max. nr. of bytes that fit in `code`.
+/// @return The nr. of bytes, or 0 if it wasn't valid or didn't fit.
+static uint16_t hexToBytes(const char *text, uint8_t *code,
+                           const uint16_t size) {
+  if (text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) text += 2;
+  const size_t digits = strlen(text);
+  if (digits == 0 || digits > (size_t)size * 2) return 0;
+  const uint16_t length = (digits + 1) / 2;
+  memset(code, 0, length);
+  // An odd nr. of digits means the first byte only has a low nibble.
+  for (size_t i = 0, nibble = length * 2 - digits; i < digits; i++, nibble++) {
+    const char c = text[i];
+    uint8_t value;
+    if (c >= '0' && c <= '9') value = c - '0';
+    else if (c >= 'a' && c <= 'f') value = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') value = c - 'A' + 10;
+    else
+      return 0;
+    code[nibble / 2] |= (nibble % 2) ? value : value << 4;
+  }
+  return length;
+}
+
+/// Update an IRjsonResults with the value of a key. Unknown keys are ignored.
+static void readResultsValue(IRjsonReader *in, const char *key, void *data) {
+  IRjsonResults *results = static_cast<IRjsonResults *>(data);
+  char text[kIrJsonValueMax];
+  const IRjsonReader::type_t type = in->value(text, sizeof(text));
+  const uint32_t hash = irutils::textHash(key);
+  if (IRJSON_KEY_IS(IRJSON_KEY_TYPE) || IRJSON_KEY_IS(IRJSON_KEY_PROTOCOL)) {
+    results->hasType = true;
+    if (type == IRjsonReader::kString)
+      results->decode_type = strToDecodeType(text);
+    else
+      results->decode_type = (decode_type_t)toInt(
+          type, text, decode_type_t::UNKNOWN, kLastDecodeType,
+          decode_type_t::UNKNOWN);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_CODE)) {
+    results->codeLength = (type == IRjsonReader::kString) ?
+        hexToBytes(text, results->code, sizeof(results->code)) : 0;
+    if (!results->codeLength) results->ok = false;
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_BITS)) {
+    results->bits = toInt(type, text, 0, UINT16_MAX, -1);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_ADDRESS)) {
+    results->address = toUint(type, text, 0);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_COMMAND)) {
+    results->command = toUint(type, text, 0);
+  } else if (IRJSON_KEY_IS(IRJSON_KEY_REPEAT)) {
+    results->repeat = toBool(type, text, false);
+  }
+}
+
+/// Add some text, in quotes.
+static void addText(IRtextSink *out, const irtext_ptr_t text) {
+  out->add('"');
+  out->add(text);
+  out->add('"');
+}
+
+/// Add a temperature, with up to 2 decimal places. e.g. 21.5
+/// Anything we can't represent is added as null.
+static void addTemp(IRtextSink *out, const float degrees) {
+  if (!(degrees > -1e7 && degrees < 1e7)) {  // Includes NaN.
+    out->add(F("null"));
+    return;
+  }
+  const int32_t hundredths = degrees * 100 + (degrees < 0 ? -0.5f : 0.5f);
+  if (hundredths < 0) out->add('-');
+  const uint32_t value = (hundredths < 0) ? -hundredths : hundredths;
+  out->addUint(value / 100);
+  const uint8_t fraction = value % 100;
+  if (fraction) {
+    out->add('.');
+    out->add((char)('0' + fraction / 10));
+    if (fraction % 10) out->add((char)('0' + fraction % 10));
+  }
+}
+
+namespace irjson {
+  /// Add a JSON object of an A/C state to a text sink. The keys are the same
+  /// as the IRMQTTServer example uses.
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] state The state to add.
+  /// @param[in] ha A flag to indicate we want GoogleHome/HomeAssistant output.
+  ///   i.e. The mode is off when the power is off & vice-versa.
+  void stateToJson(IRtextSink *out, const stdAc::state_t &state,
+                   const bool ha) {
+    const bool off = ha && (state.mode == stdAc::opmode_t::kOff ||
+                            !state.power);
+    out->add(F("{\"" IRJSON_KEY_PROTOCOL "\":\""));
+    typeToString(out, state.protocol);
+    out->add('"');
+    IRJSON_ADD_KEY(out, IRJSON_KEY_MODEL);
+    out->addInt(state.model);
+    IRJSON_ADD_KEY(out, IRJSON_KEY_COMMAND);
+    addText(out, IRac::commandTypeToText(state.command));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_POWER);
+    addText(out, IRac::boolToText(state.power && !off));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_MODE);
+    addText(out, IRac::opmodeToText(off ? stdAc::opmode_t::kOff : state.mode,
+                                    ha));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_CELSIUS);
+    addText(out, IRac::boolToText(state.celsius));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_TEMP);
+    addTemp(out, state.degrees);
+    IRJSON_ADD_KEY(out, IRJSON_KEY_SENSORTEMP);
+    addTemp(out, state.sensorTemperature);
+    IRJSON_ADD_KEY(out, IRJSON_KEY_FANSPEED);
+    addText(out, IRac::fanspeedToText(state.fanspeed));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_SWINGV);
+    addText(out, IRac::swingvToText(state.swingv));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_SWINGH);
+    addText(out, IRac::swinghToText(state.swingh));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_QUIET);
+    addText(out, IRac::boolToText(state.quiet));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_IFEEL);
+    addText(out, IRac::boolToText(state.iFeel));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_TURBO);
+    addText(out, IRac::boolToText(state.turbo));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_ECONO);
+    addText(out, IRac::boolToText(state.econo));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_LIGHT);
+    addText(out, IRac::boolToText(state.light));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_FILTER);
+    addText(out, IRac::boolToText(state.filter));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_CLEAN);
+    addText(out, IRac::boolToText(state.clean));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_BEEP);
+    addText(out, IRac::boolToText(state.beep));
+    IRJSON_ADD_KEY(out, IRJSON_KEY_SLEEP);
+    out->addInt(state.sleep);
+    IRJSON_ADD_KEY(out, IRJSON_KEY_CLOCK);
+    out->addInt(state.clock);
+    out->add('}');
+  }
+
+  /// Update an A/C state from a JSON object. Only the keys that are present
+  /// are changed, & unknown keys are ignored.
+  /// Text values are converted like `IRac::strTo*()` does. Those that can't be
+  /// converted leave that part of the state as it was.
+  /// @param[in] json The JSON text. It doesn't need to be NUL terminated.
+  /// @param[in] length The nr. of chars in the JSON text.
+  /// @param[in,out] state The state to update.
+  /// @return true, if it was a valid JSON object. Otherwise, false, and the
+  ///   state is unchanged.
+  bool jsonToState(const char *json, const size_t length,
+                   stdAc::state_t *state) {
+    stdAc::state_t result = *state;
+    if (!readObject(json, length, readStateValue, &result)) return false;
+    *state = result;
+    return true;
+  }
+
+  /// Add a JSON object of a decode_results to a text sink.
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] results A Ptr to the decode_results to add.
+  void resultsToJson(IRtextSink *out, const decode_results * const results) {
+    out->add(F("{\"" IRJSON_KEY_TYPE "\":\""));
+    typeToString(out, results->decode_type);
+    out->add('"');
+    IRJSON_ADD_KEY(out, IRJSON_KEY_BITS);
+    out->addUint(results->bits);
+    IRJSON_ADD_KEY(out, IRJSON_KEY_CODE);
+    out->add('"');
+    resultToHexidecimal(out, results);
+    out->add('"');
+    if (!hasACState(results->decode_type)) {
+      IRJSON_ADD_KEY(out, IRJSON_KEY_ADDRESS);
+      out->addUint(results->address);
+      IRJSON_ADD_KEY(out, IRJSON_KEY_COMMAND);
+      out->addUint(results->command);
+    }
+    IRJSON_ADD_KEY(out, IRJSON_KEY_REPEAT);
+    out->add(results->repeat ? F("true") : F("false"));
+    out->add('}');
+  }
+
+  /// Read a decode_results from a JSON object. It must have a protocol
+  /// ("type" or "protocol") & a hexadecimal "code". Unknown keys are ignored.
+  /// @note The raw timings aren't included. `rawbuf` is left as it was.
+  /// @param[in] json The JSON text. It doesn't need to be NUL terminated.
+  /// @param[in] length The nr. of chars in the JSON text.
+  /// @param[out] results A Ptr to the decode_results to fill in.
+  /// @return true, if it was valid. Otherwise, false, and the results are
+  ///   unchanged.
+  bool jsonToResults(const char *json, const size_t length,
+                     decode_results *results) {
+    IRjsonResults read;
+    read.ok = true;
+    read.hasType = false;
+    read.decode_type = decode_type_t::UNKNOWN;
+    read.bits = -1;
+    read.codeLength = 0;
+    read.address = 0;
+    read.command = 0;
+    read.repeat = false;
+    if (!readObject(json, length, readResultsValue, &read) || !read.ok ||
+        !read.hasType || !read.codeLength)
+      return false;
+    const bool state = hasACState(read.decode_type);
+    if (!state && read.codeLength > sizeof(results->value)) return false;
+    results->decode_type = read.decode_type;
+    results->bits = (read.bits >= 0) ? read.bits : read.codeLength * 8;
+    if (state) {
+      memcpy(results->state, read.code, read.codeLength);
+      memset(results->state + read.codeLength, 0,
+             kStateSizeMax - read.codeLength);
+    } else {
+      results->value = 0;
+      for (uint16_t i = 0; i < read.codeLength; i++)
+        results->value = (results->value << 8) | read.code[i];
+      results->address = read.address;
+      results->command = read.command;
+    }
+    results->repeat = read.repeat;
+    results->overflow = false;
+    results->rawlen = 0;
+    return true;
+  }
+}  // namespace irjson
@@ -0,0 +1,70 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+/// @file
+/// @brief An allocation-free JSON writer & reader for `stdAc::state_t` and
+///   `decode_results`. e.g. For MQTT or a web interface.
+/// JSON is written to an IRtextSink (a char buffer, a String, or a Print
+/// object), and read from a caller supplied char buffer which needn't be NUL
+/// terminated. Neither allocates any memory, and the text values are converted
+/// with the same look up tables as the `IRac::strTo*()` functions.
+///
+/// `stdAc::state_t` objects use the same keys as the IRMQTTServer example.
+/// e.g. {"protocol":"LG","model":1,"power":"On","mode":"Cool","temp":21.5,...}
+/// `decode_results` objects look like:
+///   {"type":"NEC","bits":32,"code":"0x4BB640BF","address":...,"repeat":false}
+/// where "code" is the `value`, or the `state[]` bytes for A/C protocols.
+
+#ifndef IRJSON_H_
+#define IRJSON_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRutils.h"
+
+// Keys
+#define IRJSON_KEY_PROTOCOL "protocol"
+#define IRJSON_KEY_MODEL "model"
+#define IRJSON_KEY_COMMAND "command"
+#define IRJSON_KEY_POWER "power"
+#define IRJSON_KEY_MODE "mode"
+#define IRJSON_KEY_CELSIUS "use_celsius"
+#define IRJSON_KEY_TEMP "temp"
+#define IRJSON_KEY_SENSORTEMP "sensortemp"
+#define IRJSON_KEY_FANSPEED "fanspeed"
+#define IRJSON_KEY_SWINGV "swingv"
+#define IRJSON_KEY_SWINGH "swingh"
+#define IRJSON_KEY_QUIET "quiet"
+#define IRJSON_KEY_IFEEL "ifeel"
+#define IRJSON_KEY_TURBO "turbo"
+#define IRJSON_KEY_ECONO "econo"
+#define IRJSON_KEY_LIGHT "light"
+#define IRJSON_KEY_FILTER "filter"
+#define IRJSON_KEY_CLEAN "clean"
+#define IRJSON_KEY_BEEP "beep"
+#define IRJSON_KEY_SLEEP "sleep"
+#define IRJSON_KEY_CLOCK "clock"
+#define IRJSON_KEY_TYPE "type"
+#define IRJSON_KEY_BITS "bits"
+#define IRJSON_KEY_CODE "code"
+#define IRJSON_KEY_ADDRESS "address"
+#define IRJSON_KEY_REPEAT "repeat"
+
+// Constants
+const uint8_t kIrJsonDepthMax = 8;  ///< Max. nesting of skipped values.
+/// Largest value we keep, in chars. e.g. A hex state[] with "0x" & a NUL.
+const uint16_t kIrJsonValueMax = kStateSizeMax * 2 + 3;
+
+/// Functions for writing & reading JSON without allocating memory.
+namespace irjson {
+  void stateToJson(IRtextSink *out, const stdAc::state_t &state,
+                   const bool ha = false);
+  bool jsonToState(const char *json, const size_t length,
+                   stdAc::state_t *state);
+  void resultsToJson(IRtextSink *out, const decode_results * const results);
+  bool jsonToResults(const char *json, const size_t length,
+                     decode_results *results);
+}  // namespace irjson
+#endif  // IRJSON_H_
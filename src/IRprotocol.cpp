@@ -0,0 +1,44 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+/// @file
+/// @brief The default protocol registry.
+
+#include "IRprotocol.h"
+
+/// The default list of protocols. i.e. Every enabled one.
+/// The order matters for decoding. More specific protocols need to be tried
+/// before the ones they could be mistaken for. e.g. LG32 before Samsung, and
+/// non-strict NEC after everything else that is NEC-like.
+/// @note Weak, so a sketch can replace it. See IRprotocol.h
+extern const irprotocol_t * const kIrProtocols[] __attribute__((weak)) = {
+#if DECODE_NEC || SEND_NEC
+    &IRprotocols::kNec,
+#endif  // DECODE_NEC || SEND_NEC
+#if DECODE_LG || SEND_LG
+    &IRprotocols::kLg,
+    &IRprotocols::kLg32,
+    &IRprotocols::kLg2,
+#endif  // DECODE_LG || SEND_LG
+#if DECODE_NEC || SEND_NEC
+    &IRprotocols::kNecLike,
+#endif  // DECODE_NEC || SEND_NEC
+#if DECODE_RHOSS || SEND_RHOSS
+    &IRprotocols::kRhoss,
+#endif  // DECODE_RHOSS || SEND_RHOSS
+#if DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY
+    &IRprotocols::kBluestarHeavy,
+#endif  // DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY
+    NULL};
+
+/// Find the registry entry that sends a given protocol.
+/// @param[in] type The protocol to look for.
+/// @return A ptr to the first entry of that type with a sender, or NULL if
+///   there isn't one.
+const irprotocol_t *irprotocolFind(const decode_type_t type) {
+  for (const irprotocol_t * const *entry = kIrProtocols; *entry != NULL;
+       entry++)
+    if ((*entry)->type == type &&
+        ((*entry)->send != NULL || (*entry)->sendState != NULL))
+      return *entry;
+  return NULL;
+}
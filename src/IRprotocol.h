@@ -0,0 +1,70 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+/// @file
+/// @brief The protocol registry. What IRrecv::decode() & IRsend::send() use to
+///   find the decoders & senders in the build, instead of #if/switch chains.
+/// @note Each protocol's ir_*.cpp file defines its own entries, and
+///   `kIrProtocols[]` lists them. The default list (IRprotocol.cpp) is weak, so
+///   a sketch can supply its own list of just the protocols it wants. e.g.
+/// @code
+///   extern const irprotocol_t * const kIrProtocols[] = {
+///       &IRprotocols::kNec, &IRprotocols::kRhoss, NULL};
+/// @endcode
+///   Then, with the usual `-ffunction-sections` & `--gc-sections`, only those
+///   protocols' code is linked into the firmware.
+
+#ifndef IRPROTOCOL_H_
+#define IRPROTOCOL_H_
+
+#define __STDC_LIMIT_MACROS
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+
+/// A protocol's entry in the registry.
+typedef struct {
+  decode_type_t type;  ///< The protocol reported by/sent for this entry.
+  /// The decoder to try, or NULL if this entry doesn't decode.
+  bool (IRrecv::*decode)(decode_results *results, uint16_t offset,
+                         const uint16_t nbits, const bool strict);
+  uint16_t nbits;  ///< Nr. of bits to ask the decoder for.
+  /// Ask the decoder for strict matching.
+  /// @note A non-strict match is reported as `type`. e.g. NEC_LIKE
+  bool strict;
+  /// The sender for simple (up to 64 bit) messages, or NULL.
+  void (IRsend::*send)(uint64_t data, uint16_t nbits, uint16_t repeat);
+  /// The sender for complex (state[]) messages, or NULL.
+  void (IRsend::*sendState)(const uint8_t data[], const uint16_t nbytes,
+                            const uint16_t repeat);
+  uint16_t repeat;  ///< Nr. of repeats for `sendState`.
+} irprotocol_t;
+
+/// The registry entries of every protocol in the library.
+/// @note Only the entries of the enabled (DECODE_ or SEND_) protocols exist.
+class IRprotocols {
+ public:
+#if DECODE_NEC || SEND_NEC
+  static const irprotocol_t kNec;
+  static const irprotocol_t kNecLike;
+#endif  // DECODE_NEC || SEND_NEC
+#if DECODE_LG || SEND_LG
+  static const irprotocol_t kLg;
+  static const irprotocol_t kLg32;
+  static const irprotocol_t kLg2;
+#endif  // DECODE_LG || SEND_LG
+#if DECODE_RHOSS || SEND_RHOSS
+  static const irprotocol_t kRhoss;
+#endif  // DECODE_RHOSS || SEND_RHOSS
+#if DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY
+  static const irprotocol_t kBluestarHeavy;
+#endif  // DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY
+};
+
+/// The protocols in the build, in the order IRrecv::decode() tries them.
+/// Terminated by a NULL.
+extern const irprotocol_t * const kIrProtocols[];
+
+const irprotocol_t *irprotocolFind(const decode_type_t type);
+
+#endif  // IRPROTOCOL_H_
@@ -18,6 +18,7 @@ extern "C" {
 #ifdef UNIT_TEST
 #include <cassert>
 #endif  // UNIT_TEST
+#include "IRprotocol.h"
 #include "IRremoteESP8266.h"
 #include "IRutils.h"
 
@@ -152,6 +153,14 @@ portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
 #endif  // ESP32
 atomic_irparams_t params;
 irparams_t *params_save;  // A copy of the interrupt state while decoding.
+#if ENABLE_COMPACT_CAPTURE
+uint8_t *compact;  // Where the interrupt handler stores the captured data.
+uint16_t expanded;  // Nr. of entries expanded in place. (0 if not yet)
+#endif  // ENABLE_COMPACT_CAPTURE
+#if ENABLE_MATCH_TRACE
+irtrace_event_t trace[kMatchTraceSize];  // The match trace ring buffer.
+uint32_t traced;  // Nr. of match trace events since it was last cleared.
+#endif  // ENABLE_MATCH_TRACE
 }  // namespace _IRrecv
 
 #if defined(ESP32)
@@ -159,6 +168,51 @@ using _IRrecv::mux;
 #endif  // ESP32
 using _IRrecv::params;
 using _IRrecv::params_save;
+#if ENABLE_COMPACT_CAPTURE
+using _IRrecv::compact;
+using _IRrecv::expanded;
+#endif  // ENABLE_COMPACT_CAPTURE
+#if ENABLE_MATCH_TRACE
+using _IRrecv::trace;
+using _IRrecv::traced;
+
+/// Cap a period so it fits in a match trace event.
+/// @param[in] usecs Nr. of uSeconds.
+/// @return The period, or UINT16_MAX if it is longer than that.
+static inline uint16_t traceCap(const uint32_t usecs) {
+  return (usecs > UINT16_MAX) ? UINT16_MAX : usecs;
+}
+
+/// Record an event in the match trace ring buffer.
+/// @param[in] type What happened.
+/// @param[in] result Did it match?
+/// @param[in] value The measured period (uSecs), or which part failed.
+/// @param[in] low The shortest period accepted. (uSecs)
+/// @param[in] high The longest period accepted. (uSecs)
+static inline void traceEvent(const irtrace_type_t type, const bool result,
+                              const uint32_t value, const uint32_t low,
+                              const uint32_t high) {
+  irtrace_event_t *event = &trace[traced++ & (kMatchTraceSize - 1)];
+  event->type = type;
+  event->result = result;
+  event->value = traceCap(value);
+  event->low = traceCap(low);
+  event->high = traceCap(high);
+}
+
+/// Change what the most recently recorded match trace event was.
+/// @param[in] type What it was.
+static inline void traceRetype(const irtrace_type_t type) {
+  if (traced) trace[(traced - 1) & (kMatchTraceSize - 1)].type = type;
+}
+
+#define IRTRACE(type, result, value, low, high) \
+    traceEvent(type, result, value, low, high)
+#define IRTRACE_RETYPE(type) traceRetype(type)
+#else  // ENABLE_MATCH_TRACE
+#define IRTRACE(type, result, value, low, high)
+#define IRTRACE_RETYPE(type)
+#endif  // ENABLE_MATCH_TRACE
 
 #ifndef UNIT_TEST
 #if defined(ESP8266)
@@ -205,13 +259,36 @@ static void USE_IRAM_ATTR gpio_intr() {
   // N.B. It saves about 13 bytes of IRAM.
   uint16_t rawlen = params.rawlen;
 
+#if ENABLE_COMPACT_CAPTURE
+  // `rawlen` is in bytes, so leave room for the longest encoding.
+  if (rawlen + kCompactMaxBytes > params.bufsize) {
+#else  // ENABLE_COMPACT_CAPTURE
   if (rawlen >= params.bufsize) {
+#endif  // ENABLE_COMPACT_CAPTURE
     params.overflow = true;
     params.rcvstate = kStopState;
   }
 
   if (params.rcvstate == kStopState) return;
 
+#if ENABLE_COMPACT_CAPTURE
+  uint16_t ticks = 1;
+  if (params.rcvstate == kIdleState)
+    params.rcvstate = kMarkState;
+  else if (now < start)
+    ticks = (UINT32_MAX - start + now) / kRawTick;
+  else
+    ticks = (now - start) / kRawTick;
+  const uint16_t units = (ticks + kCompactTick / 2) / kCompactTick;
+  if (units < kCompactEscape) {
+    compact[rawlen++] = units;
+  } else {  // Too long for a byte, so store it exactly.
+    compact[rawlen++] = kCompactEscape;
+    compact[rawlen++] = ticks >> 8;
+    compact[rawlen++] = ticks;
+  }
+  params.rawlen = rawlen;
+#else  // ENABLE_COMPACT_CAPTURE
   if (params.rcvstate == kIdleState) {
     params.rcvstate = kMarkState;
     params.rawbuf[rawlen] = 1;
@@ -222,6 +299,7 @@ static void USE_IRAM_ATTR gpio_intr() {
       params.rawbuf[rawlen] = (now - start) / kRawTick;
   }
   params.rawlen = params.rawlen + 1;  // C++20 fix
+#endif  // ENABLE_COMPACT_CAPTURE
 
   start = now;
 
@@ -311,8 +389,18 @@ IRrecv::IRrecv(const uint16_t recvpin, const uint16_t bufsize,
   // Ensure we are going to be able to store all possible values in the
   // capture buffer.
   params.timeout = std::min(timeout, (uint8_t)kMaxTimeoutMs);
+#if ENABLE_COMPACT_CAPTURE
+  // With a save buffer, the capture buffer only needs to hold the compact
+  // data. Otherwise, capture into the top half of a normal buffer, and
+  // `decode()` expands it in place.
+  params.rawbuf = save_buffer ? NULL : new uint16_t[bufsize];
+  compact = save_buffer ? new uint8_t[bufsize]
+                        : reinterpret_cast<uint8_t *>(params.rawbuf) + bufsize;
+  if (compact == NULL || (!save_buffer && params.rawbuf == NULL)) {
+#else  // ENABLE_COMPACT_CAPTURE
   params.rawbuf = new uint16_t[bufsize];
   if (params.rawbuf == NULL) {
+#endif  // ENABLE_COMPACT_CAPTURE
     DPRINTLN(
         "Could not allocate memory for the primary IR buffer.\n"
         "Try a smaller size for CAPTURE_BUFFER_SIZE.\nRebooting!");
@@ -348,6 +436,9 @@ IRrecv::IRrecv(const uint16_t recvpin, const uint16_t bufsize,
 /// timers or interrupts used.
 IRrecv::~IRrecv(void) {
   disableIRIn();
+#if ENABLE_COMPACT_CAPTURE
+  if (params.rawbuf == NULL) delete[] compact;
+#endif  // ENABLE_COMPACT_CAPTURE
   delete[] params.rawbuf;
   if (params_save != NULL) {
     delete[] params_save->rawbuf;
@@ -450,6 +541,9 @@ void IRrecv::pause(void) {
   params.rcvstate = kStopState;
   params.rawlen = 0;
   params.overflow = false;
+#if ENABLE_COMPACT_CAPTURE
+  expanded = 0;
+#endif  // ENABLE_COMPACT_CAPTURE
 #if defined(ESP32)
   gpio_intr_disable((gpio_num_t)params.recvpin);
 #endif  // ESP32
@@ -463,6 +557,9 @@ void IRrecv::resume(void) {
   params.rcvstate = kIdleState;
   params.rawlen = 0;
   params.overflow = false;
+#if ENABLE_COMPACT_CAPTURE
+  expanded = 0;
+#endif  // ENABLE_COMPACT_CAPTURE
 #if defined(ESP32)
 #if ESP_IDF_VERSION_MAJOR >= 5
   timerEnd(timer);
@@ -500,10 +597,85 @@ void IRrecv::copyIrParams(atomic_irparams_t *src, irparams_t *dst) {
   // Restore the buffer pointer
   dst->rawbuf = dst_rawbuf_ptr;
 
+#if ENABLE_COMPACT_CAPTURE
+  // Expand the compact capture data into the rawbuf.
+  dst->rawlen = expandCapture(src->rawlen, dst->rawbuf, dst->bufsize);
+#else  // ENABLE_COMPACT_CAPTURE
   // Copy the rawbuf
   for (uint16_t i = 0; i < dst->bufsize; i++) dst->rawbuf[i] = src->rawbuf[i];
+#endif  // ENABLE_COMPACT_CAPTURE
 }
 
+#if ENABLE_COMPACT_CAPTURE
+/// Expand the compact capture data into a normal capture buffer.
+/// @note It is safe to expand into `params.rawbuf` (in place), as the compact
+///   data is in its top half, and each entry is never written before the
+///   compact data it covers has been read.
+/// @param[in] length Nr. of bytes of compact capture data.
+/// @param[out] dst Where to put the intervals. (in kRawTicks)
+/// @param[in] size Nr. of entries `dst` can hold.
+/// @return Nr. of intervals written to `dst`.
+uint16_t IRrecv::expandCapture(const uint16_t length, volatile uint16_t *dst,
+                               const uint16_t size) {
+  IRcompactIterator iter(compact, length);
+  uint16_t entries = 0;
+  while (entries < size && !iter.done()) dst[entries++] = iter.next();
+  if (entries < size) dst[entries] = 0;  // The same end marker as `decode()`.
+  return entries;
+}
+#endif  // ENABLE_COMPACT_CAPTURE
+
+/// Class constructor
+/// @param[in] buf The compact capture data.
+/// @param[in] length Nr. of bytes of compact capture data.
+IRcompactIterator::IRcompactIterator(const uint8_t *buf, const uint16_t length)
+    : _buf(buf), _length(length), _pos(0) {}
+
+/// Are there any intervals left?
+/// @return true, if there are no more intervals. Otherwise, false.
+bool IRcompactIterator::done(void) const {
+  if (_pos >= _length) return true;
+  // An escaped interval needs all three of its bytes.
+  return _buf[_pos] == kCompactEscape && _pos + kCompactMaxBytes > _length;
+}
+
+/// Get the next interval.
+/// @return The interval in kRawTicks, or 0 if there are none left.
+uint16_t IRcompactIterator::next(void) {
+  if (done()) return 0;
+  const uint8_t units = _buf[_pos++];
+  if (units != kCompactEscape) return units * kCompactTick;
+  const uint16_t ticks = (_buf[_pos] << 8) | _buf[_pos + 1];
+  _pos += 2;
+  return ticks;
+}
+
+#if ENABLE_MATCH_TRACE
+namespace irtrace {
+/// Copy the match trace events out of the ring buffer, oldest first.
+/// @param[out] events Where to copy the events to.
+/// @param[in] size Nr. of events `events` can hold.
+/// @return Nr. of events copied. The most recent ones, if they don't all fit.
+uint16_t read(irtrace_event_t *events, const uint16_t size) {
+  const uint16_t kept = std::min(traced, (uint32_t)kMatchTraceSize);
+  const uint16_t copied = std::min(kept, size);
+  const uint32_t first = traced - copied;
+  for (uint16_t i = 0; i < copied; i++)
+    events[i] = trace[(first + i) & (kMatchTraceSize - 1)];
+  return copied;
+}
+
+/// How many match trace events have been recorded since it was cleared.
+/// @return The nr. of events. If more than `kMatchTraceSize`, the older ones
+///   have been overwritten.
+uint32_t count(void) { return traced; }
+
+/// Clear the match trace.
+/// @note `IRrecv::decode()` does this each time it is called.
+void clear(void) { traced = 0; }
+}  // namespace irtrace
+#endif  // ENABLE_MATCH_TRACE
+
 /// Obtain the maximum number of entries possible in the capture buffer.
 /// i.e. It's size.
 /// @return The size of the buffer that is in use by the object.
@@ -614,7 +786,9 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
   // resume() but that is a much more expensive operation compare to this.
   // However, don't do this if rawbuf is already full as we stomp over the heap.
   // See: https://github.com/crankyoldgit/IRremoteESP8266/issues/1516
+#if !ENABLE_COMPACT_CAPTURE
   if (!params.overflow) params.rawbuf[params.rawlen] = 0;
+#endif  // !ENABLE_COMPACT_CAPTURE
 
   bool resumed = false;  // Flag indicating if we have resumed.
 
@@ -625,7 +799,14 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
     // We haven't been asked to copy it so use the existing memory.
 #ifndef UNIT_TEST
     results->rawbuf = params.rawbuf;
+#if ENABLE_COMPACT_CAPTURE
+    // Only once per capture, as expanding in place overwrites the compact data.
+    if (!expanded)
+      expanded = expandCapture(params.rawlen, params.rawbuf, params.bufsize);
+    results->rawlen = expanded;
+#else  // ENABLE_COMPACT_CAPTURE
     results->rawlen = params.rawlen;
+#endif  // ENABLE_COMPACT_CAPTURE
     results->overflow = params.overflow;
 #endif
   } else {
@@ -645,6 +826,9 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
   results->address = 0;
   results->command = 0;
   results->repeat = false;
+#if ENABLE_MATCH_TRACE
+  irtrace::clear();
+#endif  // ENABLE_MATCH_TRACE
 
 #if ENABLE_NOISE_FILTER_OPTION
   crudeNoiseFilter(results, noise_floor);
@@ -654,6 +838,23 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
   for (uint16_t offset = kStartOffset;
        offset <= (max_skip * 2) + kStartOffset;
        offset += 2) {
+    // Try each protocol in the registry, in order. See IRprotocol.cpp
+    // The commented out blocks below are the protocols that aren't in this
+    // tree, in the order they used to be tried.
+    for (const irprotocol_t * const *entry = kIrProtocols; *entry != NULL;
+         entry++) {
+      const irprotocol_t *protocol = *entry;
+      if (protocol->decode == NULL) continue;
+      DPRINT("Attempting ");
+      DPRINT(typeToString(protocol->type));
+      DPRINTLN(" decode");
+      if ((this->*protocol->decode)(results, offset, protocol->nbits,
+                                    protocol->strict)) {
+        // A non-strict match is reported as the entry's protocol.
+        if (!protocol->strict) results->decode_type = protocol->type;
+        return true;
+      }
+    }
 // #if DECODE_AIWA_RC_T501
 //     DPRINTLN("Attempting Aiwa RC T501 decode");
 //     // Try decodeAiwaRCT501() before decodeSanyoLC7461() & decodeNEC()
@@ -693,10 +894,6 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 //   // first to try to reduce false detection as a NEC packet.
 //   if (decodeEpson(results, offset)) return true;
 // #endif
-#if DECODE_NEC
-    DPRINTLN("Attempting NEC decode");
-    if (decodeNEC(results, offset)) return true;
-#endif
 // #if DECODE_MILESTAG2
 //     DPRINTLN("Attempting MilesTag2 decode");
 //   // Try decodeMilestag2() before decodeSony() because the protocols are
@@ -754,13 +951,6 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 //     if (decodePanasonic(results, offset, kPanasonic40Bits, true,
 //                         kPanasonic40Manufacturer)) return true;
 // #endif  // DECODE_PANASONIC
-#if DECODE_LG
-    DPRINTLN("Attempting LG (28-bit) decode");
-    if (decodeLG(results, offset, kLgBits, true)) return true;
-    DPRINTLN("Attempting LG (32-bit) decode");
-    // LG32 should be tried before Samsung
-    if (decodeLG(results, offset, kLg32Bits, true)) return true;
-#endif
 // #if DECODE_GICABLE
 //     // Note: Needs to happen before JVC decode, because it looks similar except
 //     //       with a required NEC-like repeat code.
@@ -848,18 +1038,6 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
       return true;
 #endif
   */
-#if DECODE_NEC
-    // Some devices send NEC-like codes that don't follow the true NEC spec.
-    // This should detect those. e.g. Apple TV remote etc.
-    // This needs to be done after all other codes that use strict and some
-    // other protocols that are NEC-like as well, as turning off strict may
-    // cause this to match other valid protocols.
-    DPRINTLN("Attempting NEC (non-strict) decode");
-    if (decodeNEC(results, offset, kNECBits, false)) {
-      results->decode_type = NEC_LIKE;
-      return true;
-    }
-#endif
 // #if DECODE_LASERTAG
 //     DPRINTLN("Attempting Lasertag decode");
 //     if (decodeLasertag(results, offset)) return true;
@@ -1170,10 +1348,6 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 //     DPRINTLN("Attempting Arris decode");
 //     if (decodeArris(results, offset)) return true;
 // #endif  // DECODE_ARRIS
-#if DECODE_RHOSS
-    DPRINTLN("Attempting Rhoss decode");
-    if (decodeRhoss(results, offset)) return true;
-#endif  // DECODE_RHOSS
 // #if DECODE_AIRTON
 //     DPRINTLN("Attempting Airton decode");
 //     if (decodeAirton(results, offset)) return true;
@@ -1231,12 +1405,12 @@ bool IRrecv::decode(decode_results *results, irparams_t *save,
 //     DPRINTLN("Attempting York decode");
 //     if (decodeYork(results, offset, kYorkBits)) return true;
 // #endif  // DECODE_YORK
-  // Typically new protocols are added above this line.
+  // New protocols are added to the registry. See IRprotocol.cpp
   }
 #if DECODE_HASH
   // decodeHash returns a hash on any input.
   // Thus, it needs to be last in the list.
-  // If you add any decodes, add them before this.
+  // If you add any decodes, add them to the registry.
   if (decodeHash(results)) {
     return true;
   }
@@ -1287,12 +1461,6 @@ uint32_t IRrecv::ticksHigh(const uint32_t usecs, const uint8_t tolerance,
 bool IRrecv::match(uint32_t measured, uint32_t desired, uint8_t tolerance,
                    uint16_t delta) {
   measured *= kRawTick;  // Convert to uSecs.
-  DPRINT("Matching: ");
-  DPRINT(ticksLow(desired, tolerance, delta));
-  DPRINT(" <= ");
-  DPRINT(measured);
-  DPRINT(" <= ");
-  DPRINTLN(ticksHigh(desired, tolerance, delta));
 #ifdef UNIT_TEST
   // Sanity checks that we don't have values that cause integer over/underflow.
   // Only performed during testing so there is no performance hit in normal
@@ -1304,8 +1472,11 @@ bool IRrecv::match(uint32_t measured, uint32_t desired, uint8_t tolerance,
   // If there is a legit case, then this should be removed.
   assert(ticksHigh(desired, tolerance, delta) >= desired);
 #endif  // UNIT_TEST
-  return (measured >= ticksLow(desired, tolerance, delta) &&
-          measured <= ticksHigh(desired, tolerance, delta));
+  const uint32_t low = ticksLow(desired, tolerance, delta);
+  const uint32_t high = ticksHigh(desired, tolerance, delta);
+  const bool result = (measured >= low && measured <= high);
+  IRTRACE(kTraceMatch, result, measured, low, high);
+  return result;
 }
 
 /// Check if we match a pulse(measured) of at least desired within
@@ -1318,20 +1489,6 @@ bool IRrecv::match(uint32_t measured, uint32_t desired, uint8_t tolerance,
 bool IRrecv::matchAtLeast(uint32_t measured, uint32_t desired,
                           uint8_t tolerance, uint16_t delta) {
   measured *= kRawTick;  // Convert to uSecs.
-  DPRINT("Matching ATLEAST ");
-  DPRINT(measured);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(". Matching: ");
-  DPRINT(measured);
-  DPRINT(" >= ");
-  DPRINT(ticksLow(std::min(desired, (uint32_t)MS_TO_USEC(params.timeout)),
-                  tolerance, delta));
-  DPRINT(" [min(");
-  DPRINT(ticksLow(desired, tolerance, delta));
-  DPRINT(", ");
-  DPRINT(ticksLow(MS_TO_USEC(params.timeout), tolerance, delta));
-  DPRINTLN(")]");
 #ifdef UNIT_TEST
   // Sanity checks that we don't have values that cause integer over/underflow.
   // Only performed during testing so there is no performance hit in normal
@@ -1345,10 +1502,16 @@ bool IRrecv::matchAtLeast(uint32_t measured, uint32_t desired,
 #endif  // UNIT_TEST
   // We really should never get a value of 0, except as the last value
   // in the buffer. If that is the case, then assume infinity and return true.
-  if (measured == 0) return true;
-  return measured >= ticksLow(std::min(desired,
-                                       (uint32_t)MS_TO_USEC(params.timeout)),
-                              tolerance, delta);
+  if (measured == 0) {
+    IRTRACE(kTraceAtLeast, true, measured, 0, UINT16_MAX);
+    return true;
+  }
+  const uint32_t low = ticksLow(std::min(desired,
+                                         (uint32_t)MS_TO_USEC(params.timeout)),
+                                tolerance, delta);
+  const bool result = measured >= low;
+  IRTRACE(kTraceAtLeast, result, measured, low, UINT16_MAX);
+  return result;
 }
 
 /// Check if we match a mark signal(measured) with the desired within
@@ -1360,14 +1523,9 @@ bool IRrecv::matchAtLeast(uint32_t measured, uint32_t desired,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::matchMark(uint32_t measured, uint32_t desired, uint8_t tolerance,
                        int16_t excess) {
-  DPRINT("Matching MARK ");
-  DPRINT(measured * kRawTick);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(" + ");
-  DPRINT(excess);
-  DPRINT(". ");
-  return match(measured, desired + excess, tolerance);
+  const bool result = match(measured, desired + excess, tolerance);
+  IRTRACE_RETYPE(kTraceMark);
+  return result;
 }
 
 /// Check if we match a mark signal(measured) with the desired within a
@@ -1380,14 +1538,9 @@ bool IRrecv::matchMark(uint32_t measured, uint32_t desired, uint8_t tolerance,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::matchMarkRange(const uint32_t measured, const uint32_t desired,
                             const uint16_t range, const int16_t excess) {
-  DPRINT("Matching MARK ");
-  DPRINT(measured * kRawTick);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(" + ");
-  DPRINT(excess);
-  DPRINT(". ");
-  return match(measured, desired + excess, 0, range);
+  const bool result = match(measured, desired + excess, 0, range);
+  IRTRACE_RETYPE(kTraceMark);
+  return result;
 }
 
 /// Check if we match a space signal(measured) with the desired within
@@ -1399,14 +1552,9 @@ bool IRrecv::matchMarkRange(const uint32_t measured, const uint32_t desired,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::matchSpace(uint32_t measured, uint32_t desired, uint8_t tolerance,
                         int16_t excess) {
-  DPRINT("Matching SPACE ");
-  DPRINT(measured * kRawTick);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(" - ");
-  DPRINT(excess);
-  DPRINT(". ");
-  return match(measured, desired - excess, tolerance);
+  const bool result = match(measured, desired - excess, tolerance);
+  IRTRACE_RETYPE(kTraceSpace);
+  return result;
 }
 
 /// Check if we match a space signal(measured) with the desired within a
@@ -1419,14 +1567,9 @@ bool IRrecv::matchSpace(uint32_t measured, uint32_t desired, uint8_t tolerance,
 /// @return A Boolean. true if it matches, false if it doesn't.
 bool IRrecv::matchSpaceRange(const uint32_t measured, const uint32_t desired,
                              const uint16_t range, const int16_t excess) {
-  DPRINT("Matching SPACE ");
-  DPRINT(measured * kRawTick);
-  DPRINT(" vs ");
-  DPRINT(desired);
-  DPRINT(" - ");
-  DPRINT(excess);
-  DPRINT(". ");
-  return match(measured, desired - excess, 0, range);
+  const bool result = match(measured, desired - excess, 0, range);
+  IRTRACE_RETYPE(kTraceSpace);
+  return result;
 }
 
 #if DECODE_HASH
@@ -1513,6 +1656,7 @@ match_result_t IRrecv::matchData(
                  matchSpace(*(data_ptr + 1), zerospace, tolerance, excess)) {
         result.data <<= 1;  // The bit is a '0'.
       } else {
+        IRTRACE(kTraceData, false, result.used / 2, 0, 0);
         if (!MSBfirst) result.data = reverseBits(result.data, result.used / 2);
         return result;  // It's neither, so fail.
       }
@@ -1531,7 +1675,11 @@ match_result_t IRrecv::matchData(
         result.data <<= 1;  // The bit is a '0'.
       else
         result.success = false;
-      if (result.success) result.used++;
+      if (result.success) {
+        result.used++;
+      } else {
+        IRTRACE(kTraceData, false, nbits - 1, 0, 0);
+      }
     }
   }
   if (!MSBfirst) result.data = reverseBits(result.data, nbits);
@@ -1564,15 +1712,73 @@ uint16_t IRrecv::matchBytes(atomic_uint16_t *data_ptr, uint8_t *result_ptr,
   // Check if there is enough capture buffer to possibly have the desired bytes.
   if (remaining + expectlastspace < (nbytes * 8 * 2) + 1)
     return 0;  // Nope, so abort.
+  if (!nbytes) return 0;
+  // Work out what matchMark() & matchSpace() would accept for each kind of bit
+  // just the once, so every entry only needs a couple of integer compares.
+  const uint32_t onemark_low = ticksLow(onemark + excess, tolerance);
+  const uint32_t onemark_high = ticksHigh(onemark + excess, tolerance);
+  const uint32_t onespace_low = ticksLow(onespace - excess, tolerance);
+  const uint32_t onespace_high = ticksHigh(onespace - excess, tolerance);
+  const uint32_t zeromark_low = ticksLow(zeromark + excess, tolerance);
+  const uint32_t zeromark_high = ticksHigh(zeromark + excess, tolerance);
+  const uint32_t zerospace_low = ticksLow(zerospace - excess, tolerance);
+  const uint32_t zerospace_high = ticksHigh(zerospace - excess, tolerance);
+  const uint8_t first = MSBfirst ? 0x80 : 0x01;
   uint16_t offset = 0;
   for (uint16_t byte_pos = 0; byte_pos < nbytes; byte_pos++) {
-    bool lastspace = (byte_pos + 1 == nbytes) ? expectlastspace : true;
-    match_result_t result = matchData(data_ptr + offset, 8, onemark, onespace,
-                                      zeromark, zerospace, tolerance, excess,
-                                      MSBfirst, lastspace);
-    if (result.success == false) return 0;  // Fail
-    result_ptr[byte_pos] = (uint8_t)result.data;
-    offset += result.used;
+    // The last bit may not have a space. If so, only its mark is matched.
+    const bool markonly = !expectlastspace && (byte_pos + 1 == nbytes);
+#if ENABLE_MATCH_TRACE
+    const uint16_t start = offset;
+#endif  // ENABLE_MATCH_TRACE
+    // First, classify each mark & space pair as a '1' and/or a '0' bit ...
+    uint8_t ones = 0;
+    uint8_t zeros = 0;
+    uint8_t mask = first;
+    for (uint8_t bit = markonly; bit < 8; bit++, offset += 2) {
+      const uint32_t mark = data_ptr[offset] * kRawTick;
+      const uint32_t space = data_ptr[offset + 1] * kRawTick;
+      if (mark >= onemark_low && mark <= onemark_high &&
+          space >= onespace_low && space <= onespace_high) ones |= mask;
+      if (mark >= zeromark_low && mark <= zeromark_high &&
+          space >= zerospace_low && space <= zerospace_high) zeros |= mask;
+      mask = MSBfirst ? mask >> 1 : mask << 1;
+    }
+    if (markonly) {
+      const uint32_t mark = data_ptr[offset++] * kRawTick;
+      if (mark >= onemark_low && mark <= onemark_high) ones |= mask;
+      if (mark >= zeromark_low && mark <= zeromark_high) zeros |= mask;
+    }
+    // ... then every bit has to be one or the other. A '1' wins if it's both.
+    if ((ones | zeros) != 0xFF) {  // Fail
+#if ENABLE_MATCH_TRACE
+      // Only on failure, so work out which bit it was, & what it missed.
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        const uint16_t nr = byte_pos * 8 + bit;
+        const uint32_t mark = data_ptr[start + bit * 2] * kRawTick;
+        const bool one = mark >= onemark_low && mark <= onemark_high;
+        const bool zero = mark >= zeromark_low && mark <= zeromark_high;
+        if (!one && !zero) {  // The mark was neither, so use both windows.
+          IRTRACE(kTraceData, false, nr, std::min(onemark_low, zeromark_low),
+                  std::max(onemark_high, zeromark_high));
+          break;
+        }
+        if (markonly && bit == 7) break;
+        const uint32_t space = data_ptr[start + bit * 2 + 1] * kRawTick;
+        if (one && space >= onespace_low && space <= onespace_high) continue;
+        if (zero && space >= zerospace_low && space <= zerospace_high) continue;
+        // The space missed the window(s) of whatever the mark matched.
+        IRTRACE(kTraceData, false, nr,
+                zero ? (one ? std::min(onespace_low, zerospace_low)
+                            : zerospace_low) : onespace_low,
+                zero ? (one ? std::max(onespace_high, zerospace_high)
+                            : zerospace_high) : onespace_high);
+        break;
+      }
+#endif  // ENABLE_MATCH_TRACE
+      return 0;
+    }
+    result_ptr[byte_pos] = ones;
   }
   return offset;
 }
@@ -1642,11 +1848,16 @@ uint16_t IRrecv::_matchGeneric(atomic_uint16_t *data_ptr,
   uint16_t offset = 0;
 
   // Header
-  if (hdrmark && !matchMark(*(data_ptr + offset++), hdrmark, tolerance, excess))
+  if (hdrmark && !matchMark(*(data_ptr + offset++), hdrmark, tolerance,
+                            excess)) {
+    IRTRACE(kTraceHeader, false, 0, 0, 0);
     return 0;
+  }
   if (hdrspace && !matchSpace(*(data_ptr + offset++), hdrspace, tolerance,
-                              excess))
+                              excess)) {
+    IRTRACE(kTraceHeader, false, 1, 0, 0);
     return 0;
+  }
 
   // Data
   if (use_bits) {  // Bits.
@@ -1668,16 +1879,18 @@ uint16_t IRrecv::_matchGeneric(atomic_uint16_t *data_ptr,
   }
   // Footer
   if (footermark && !matchMark(*(data_ptr + offset++), footermark, tolerance,
-                               excess))
+                               excess)) {
+    IRTRACE(kTraceFooter, false, 0, 0, 0);
     return 0;
+  }
   // If we have something still to match & haven't reached the end of the buffer
   if (footerspace && offset < remaining) {
-      if (atleast) {
-        if (!matchAtLeast(*(data_ptr + offset), footerspace, tolerance, excess))
-          return 0;
-      } else {
-        if (!matchSpace(*(data_ptr + offset), footerspace, tolerance, excess))
-          return 0;
+      const bool matched = atleast ?
+          matchAtLeast(*(data_ptr + offset), footerspace, tolerance, excess) :
+          matchSpace(*(data_ptr + offset), footerspace, tolerance, excess);
+      if (!matched) {
+        IRTRACE(kTraceFooter, false, 1, 0, 0);
+        return 0;
       }
       offset++;
   }
@@ -47,6 +47,14 @@ const uint16_t kRawTick = 2;     // Capture tick to uSec factor.
 const uint8_t kTimeoutMs = 15;  // In MilliSeconds.
 #define TIMEOUT_MS kTimeoutMs   // For legacy documentation.
 const uint16_t kMaxTimeoutMs = kRawTick * (UINT16_MAX / MS_TO_USEC(1));
+// Compact capture buffers. (See ENABLE_COMPACT_CAPTURE)
+const uint8_t kCompactTick = 4;  // Compact capture unit, in kRawTicks.
+const uint8_t kCompactEscape = UINT8_MAX;  // The next 2 bytes are in kRawTicks.
+const uint8_t kCompactMaxBytes = 3;  // Max nr. of bytes used per interval.
+// Match trace ring buffer. (See ENABLE_MATCH_TRACE)
+const uint16_t kMatchTraceSize = MATCH_TRACE_SIZE;  // Nr. of events.
+static_assert((kMatchTraceSize & (kMatchTraceSize - 1)) == 0,
+              "MATCH_TRACE_SIZE must be a power of 2.");
 
 // Use FNV hash algorithm: http://isthe.com/chongo/tech/comp/fnv/#FNV-param
 const uint32_t kFnvPrime32 = 16777619UL;
@@ -62,13 +70,93 @@ const uint8_t kDefaultESP32Timer = 3;
 #endif  // SOC_TIMER_GROUP_TOTAL_TIMERS
 #endif  // ESP32
 
-#if DECODE_AC
-// Hitachi AC is the current largest state size.
-const uint16_t kStateSizeMax = kHitachiAc2StateLength;
-#else  // DECODE_AC
-// Just define something (a uint64_t)
-const uint16_t kStateSizeMax = sizeof(uint64_t);
-#endif  // DECODE_AC
+/// The larger of two sizes. (A C++11 friendly `std::max()`)
+/// @param[in] first A size.
+/// @param[in] second Another size.
+/// @return The larger of the two.
+constexpr uint16_t irLargerSize(const uint16_t first, const uint16_t second) {
+  return first > second ? first : second;
+}
+
+/// The largest of a list of sizes, at compile time.
+/// @param[in] size The last size in the list.
+/// @return The size.
+constexpr uint16_t irLargestSize(const uint16_t size) { return size; }
+
+/// The largest of a list of sizes, at compile time.
+/// @param[in] size The first size in the list.
+/// @param[in] rest The rest of the list.
+/// @return The largest size in the list.
+template <typename... Sizes>
+constexpr uint16_t irLargestSize(const uint16_t size, const Sizes... rest) {
+  return irLargerSize(size, irLargestSize(rest...));
+}
+
+// The largest state (in bytes) any enabled decoder can put in
+// decode_results::state. It is never smaller than a uint64_t, as the state is
+// also used to hold `value` etc. e.g. By IRjson & IRwire.
+// Add any DECODE_ that uses result->state here. The commented out ones are
+// those whose decoders aren't in this tree, same as in IRrecv::decode().
+#define IR_STATE_SIZE(PROTOCOL, LENGTH) (DECODE_##PROTOCOL ? (LENGTH) : 0)
+const uint16_t kStateSizeMax = irLargestSize(
+    (uint16_t)sizeof(uint64_t),
+//  IR_STATE_SIZE(AMCOR, kAmcorStateLength),
+//  IR_STATE_SIZE(ARGO, kArgoStateLength),
+    IR_STATE_SIZE(BLUESTARHEAVY, kBluestarHeavyStateLength),
+//  IR_STATE_SIZE(BOSCH144, kBosch144StateLength),
+//  IR_STATE_SIZE(CARRIER_AC84, kCarrierAc84StateLength),
+//  IR_STATE_SIZE(CARRIER_AC128, kCarrierAc128StateLength),
+//  IR_STATE_SIZE(CORONA_AC, kCoronaAcStateLength),
+//  IR_STATE_SIZE(DAIKIN, kDaikinStateLength),
+//  IR_STATE_SIZE(DAIKIN2, kDaikin2StateLength),
+//  IR_STATE_SIZE(DAIKIN128, kDaikin128StateLength),
+//  IR_STATE_SIZE(DAIKIN152, kDaikin152StateLength),
+//  IR_STATE_SIZE(DAIKIN160, kDaikin160StateLength),
+//  IR_STATE_SIZE(DAIKIN176, kDaikin176StateLength),
+//  IR_STATE_SIZE(DAIKIN200, kDaikin200StateLength),
+//  IR_STATE_SIZE(DAIKIN216, kDaikin216StateLength),
+//  IR_STATE_SIZE(DAIKIN312, kDaikin312StateLength),
+//  IR_STATE_SIZE(ELECTRA_AC, kElectraAcStateLength),
+//  IR_STATE_SIZE(FUJITSU_AC, kFujitsuAcStateLength),
+//  IR_STATE_SIZE(GREE, kGreeStateLength),
+//  IR_STATE_SIZE(HAIER_AC, kHaierACStateLength),
+//  IR_STATE_SIZE(HAIER_AC_YRW02, kHaierACYRW02StateLength),
+//  IR_STATE_SIZE(HAIER_AC160, kHaierAC160StateLength),
+//  IR_STATE_SIZE(HAIER_AC176, kHaierAC176StateLength),
+//  IR_STATE_SIZE(HITACHI_AC, kHitachiAcStateLength),
+//  IR_STATE_SIZE(HITACHI_AC1, kHitachiAc1StateLength),
+//  IR_STATE_SIZE(HITACHI_AC2, kHitachiAc2StateLength),
+//  IR_STATE_SIZE(HITACHI_AC3, kHitachiAc3StateLength),
+//  IR_STATE_SIZE(HITACHI_AC264, kHitachiAc264StateLength),
+//  IR_STATE_SIZE(HITACHI_AC296, kHitachiAc296StateLength),
+//  IR_STATE_SIZE(HITACHI_AC344, kHitachiAc344StateLength),
+//  IR_STATE_SIZE(HITACHI_AC424, kHitachiAc424StateLength),
+//  IR_STATE_SIZE(KELON168, kKelon168StateLength),
+//  IR_STATE_SIZE(KELVINATOR, kKelvinatorStateLength),
+//  IR_STATE_SIZE(MIRAGE, kMirageStateLength),
+//  IR_STATE_SIZE(MITSUBISHI_AC, kMitsubishiACStateLength),
+//  IR_STATE_SIZE(MITSUBISHI136, kMitsubishi136StateLength),
+//  IR_STATE_SIZE(MITSUBISHI112, kMitsubishi112StateLength),
+//  IR_STATE_SIZE(MITSUBISHIHEAVY, kMitsubishiHeavy152StateLength),
+//  IR_STATE_SIZE(NEOCLIMA, kNeoclimaStateLength),
+//  IR_STATE_SIZE(PANASONIC_AC, kPanasonicAcStateLength),
+    IR_STATE_SIZE(RHOSS, kRhossStateLength),
+//  IR_STATE_SIZE(SAMSUNG_AC, kSamsungAcExtendedStateLength),
+//  IR_STATE_SIZE(SANYO_AC, kSanyoAcStateLength),
+//  IR_STATE_SIZE(SANYO_AC88, kSanyoAc88StateLength),
+//  IR_STATE_SIZE(SANYO_AC152, kSanyoAc152StateLength),
+//  IR_STATE_SIZE(SHARP_AC, kSharpAcStateLength),
+//  IR_STATE_SIZE(TCL96AC, kTcl96AcStateLength),
+//  IR_STATE_SIZE(TCL112AC, kTcl112AcStateLength),
+//  IR_STATE_SIZE(TEKNOPOINT, kTeknopointStateLength),
+//  IR_STATE_SIZE(TOSHIBA_AC, kToshibaACStateLengthLong),
+//  IR_STATE_SIZE(TROTEC, kTrotecStateLength),
+//  IR_STATE_SIZE(TROTEC_3550, kTrotecStateLength),
+//  IR_STATE_SIZE(VOLTAS, kVoltasStateLength),
+//  IR_STATE_SIZE(WHIRLPOOL_AC, kWhirlpoolAcStateLength),
+//  IR_STATE_SIZE(YORK, kYorkStateLength),
+    (uint16_t)0);
+#undef IR_STATE_SIZE
 
 // Types
 
@@ -95,12 +183,61 @@ typedef struct {
   uint16_t used;  // How many buffer positions were used.
 } match_result_t;
 
+/// What a match trace event records. See `irtrace_event_t`.
+enum irtrace_type_t {
+  kTraceMatch = 1,  ///< `match()` of a period against a window.
+  kTraceMark,       ///< A `match()` made by `matchMark()`/`matchMarkRange()`.
+  kTraceSpace,      ///< A `match()` made by `matchSpace()`/`matchSpaceRange()`.
+  kTraceAtLeast,    ///< `matchAtLeast()`. `high` is `UINT16_MAX`.
+  kTraceHeader,     ///< The header failed. `value` is 0 (mark) or 1 (space).
+  kTraceData,       ///< `matchData()`/`matchBytes()` failed. `value` is the
+                    ///< bit nr. For `matchBytes()`, `low` & `high` are the
+                    ///< window its mark or space missed.
+  kTraceFooter,     ///< The footer failed. `value` is 0 (mark) or 1 (space).
+};
+
+/// A match trace event. 8 bytes, so a raw dump of them is easy to decode.
+/// Periods are in uSeconds, & capped at `UINT16_MAX`.
+/// @see ENABLE_MATCH_TRACE
+typedef struct {
+  uint8_t type;    ///< What happened. An `irtrace_type_t`.
+  uint8_t result;  ///< 1 if it matched, 0 if it didn't.
+  uint16_t value;  ///< The measured period, or which part failed.
+  uint16_t low;    ///< The shortest period accepted. (0 if not applicable)
+  uint16_t high;   ///< The longest period accepted. (0 if not applicable)
+} irtrace_event_t;
+
+#if ENABLE_MATCH_TRACE
+/// Reading the match trace ring buffer. See ENABLE_MATCH_TRACE
+namespace irtrace {
+uint16_t read(irtrace_event_t *events, const uint16_t size);
+uint32_t count(void);
+void clear(void);
+}  // namespace irtrace
+#endif  // ENABLE_MATCH_TRACE
+
 // Classes
 
+/// Reads the intervals back out of a compact capture buffer, in order.
+/// @see ENABLE_COMPACT_CAPTURE
+class IRcompactIterator {
+ public:
+  IRcompactIterator(const uint8_t *buf, const uint16_t length);
+  bool done(void) const;
+  uint16_t next(void);
+
+ private:
+  const uint8_t *_buf;  ///< The compact capture data.
+  uint16_t _length;  ///< Nr. of bytes of compact capture data.
+  uint16_t _pos;  ///< Nr. of bytes read so far.
+};
+
 /// Results returned from the decoder
+/// @note The members are ordered largest alignment first, so the compiler
+///   doesn't need to add any padding between them.
+///   See tools/decode_results_footprint.py for its size in various builds.
 class decode_results {
  public:
-  decode_type_t decode_type;  // NEC, SONY, RC5, UNKNOWN
   // value, address, & command are all mutually exclusive with state.
   // i.e. They MUST NOT be used at the same time as state, so we can use a union
   // structure to save us a handful of valuable bytes of memory.
@@ -112,8 +249,9 @@ class decode_results {
     };
     uint8_t state[kStateSizeMax];  // Multi-byte results.
   };
-  uint16_t bits;              // Number of bits in decoded value
   atomic_uint16_t *rawbuf;    // Raw intervals in .5 us ticks
+  decode_type_t decode_type;  // NEC, SONY, RC5, UNKNOWN
+  uint16_t bits;              // Number of bits in decoded value
   uint16_t rawlen;            // Number of records in rawbuf.
   bool overflow;
   bool repeat;  // Is the result a repeat code?
@@ -164,6 +302,7 @@ class IRrecv {
 
  private:
 #endif
+  friend class IRprotocols;  // Its registry entries point at our decoders.
   irparams_t *irparams_save;
   uint8_t _tolerance;
 #if defined(ESP32)
@@ -178,6 +317,10 @@ class IRrecv {
   // These are called by decode
   uint8_t _validTolerance(const uint8_t percentage);
   void copyIrParams(atomic_irparams_t *src, irparams_t *dst);
+#if ENABLE_COMPACT_CAPTURE
+  uint16_t expandCapture(const uint16_t length, volatile uint16_t *dst,
+                         const uint16_t size);
+#endif  // ENABLE_COMPACT_CAPTURE
   uint16_t compare(const uint16_t oldval, const uint16_t newval);
   uint32_t ticksLow(const uint32_t usecs,
                     const uint8_t tolerance = kUseDefTol,
@@ -989,8 +989,9 @@ typedef volatile const uint16_t atomic_const_uint16_t;
      DECODE_BOSCH144 || DECODE_SANYO_AC152 || DECODE_DAIKIN312 || \
      DECODE_CARRIER_AC84 || DECODE_YORK || DECODE_BLUESTARHEAVY || \
      false)
-  // Add any DECODE to the above if it uses result->state (see kStateSizeMax)
-  // you might also want to add the protocol to hasACState function
+  // Add any DECODE to the above if it uses result->state, and to the list
+  // for kStateSizeMax in IRrecv.h.
+  // You might also want to add the protocol to hasACState function
 #define DECODE_AC true  // We need some common infrastructure for decoding A/Cs.
 #else
 #define DECODE_AC false   // We don't need that infrastructure.
@@ -1021,6 +1022,35 @@ typedef volatile const uint16_t atomic_const_uint16_t;
 #define ENABLE_NOISE_FILTER_OPTION true
 #endif  // ENABLE_NOISE_FILTER_OPTION
 
+// Capture incoming IR data one byte per interval (in units of 8us, i.e. less
+// than a third of a 38kHz carrier period) instead of two. Intervals too long
+// for a byte are stored exactly, in three bytes. `decode()` expands the data
+// back into a normal `rawbuf` before any decoding, so decoders are unaffected.
+// It only saves memory if you use a save buffer. e.g. `save_buffer = true`
+// as the capture buffer then needs `bufsize` bytes rather than `2 * bufsize`.
+// e.g. A 1024 entry capture with a save buffer needs 3kB rather than 4kB.
+// Without a save buffer, the data is expanded in place, so it uses the same
+// memory as normal.
+#ifndef ENABLE_COMPACT_CAPTURE
+#define ENABLE_COMPACT_CAPTURE false
+#endif  // ENABLE_COMPACT_CAPTURE
+
+// Record what the matching functions (`IRrecv::match()` etc.) find into a
+// ring buffer of small binary events, instead of printing it with `DEBUG`.
+// Printing over Serial while decoding changes the timing so much the captures
+// are no longer representative. Recording an event costs a few instructions.
+// e.g. The measured period & the tolerance window it was matched against, or
+// which header, bit, or footer failed to match. `decode()` clears the trace,
+// so read it with `irtrace::read()` afterwards, & print it with
+// `traceToText()`. When disabled, the trace points compile to nothing.
+#ifndef ENABLE_MATCH_TRACE
+#define ENABLE_MATCH_TRACE false
+#endif  // ENABLE_MATCH_TRACE
+// Nr. of events the trace keeps. The most recent ones. Must be a power of 2.
+#ifndef MATCH_TRACE_SIZE
+#define MATCH_TRACE_SIZE 64
+#endif  // MATCH_TRACE_SIZE
+
 /// Enumerator for defining and numbering of supported IR protocol.
 /// @note Always add to the end of the list and should never remove entries
 ///  or change order. Projects may save the type number for later usage
@@ -0,0 +1,216 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+/// @file
+/// @brief A hierarchical timer-wheel for running timed & repeating IR jobs.
+/// @see https://en.wikipedia.org/wiki/Timer_wheel
+
+#include "IRscheduler.h"
+#ifndef UNIT_TEST
+#include <Arduino.h>
+#endif
+
+/// Class constructor.
+/// @param[in] callback A function to call when the job runs. (Optional)
+/// @param[in] context A value to pass to the callback function.
+IRschedulerJob::IRschedulerJob(void (*callback)(void *context),
+                               void *context)
+    : callback(callback), context(context), period(0), _expires(0),
+      _next(NULL), _pprev(NULL) {}
+
+/// Run the job. By default, call the callback function (if any).
+void IRschedulerJob::run(void) {
+  if (callback != NULL) callback(context);
+}
+
+/// Is the job currently waiting in a scheduler?
+/// @return true, if it is scheduled to run. Otherwise, false.
+bool IRschedulerJob::isPending(void) const { return _pprev != NULL; }
+
+/// Class constructor for sending a simple message.
+/// @param[in] irsend A ptr to the IRsend object to send the message with.
+/// @param[in] type The protocol to send.
+/// @param[in] data The message value to send.
+/// @param[in] nbits Nr. of bits in the message.
+/// @param[in] repeat Nr. of times the message is to be repeated.
+IRsendJob::IRsendJob(IRsend *irsend, const decode_type_t type,
+                     const uint64_t data, const uint16_t nbits,
+                     const uint16_t repeat)
+    : IRschedulerJob(), irsend(irsend), type(type), data(data), state(NULL),
+      nbits(nbits), repeat(repeat) {}
+
+/// Class constructor for sending a state[] message.
+/// @param[in] irsend A ptr to the IRsend object to send the message with.
+/// @param[in] type The protocol to send.
+/// @param[in] state A ptr to the state array to send.
+/// @param[in] nbytes Nr. of bytes in the state array.
+/// @note The state array must remain valid until the job has run.
+IRsendJob::IRsendJob(IRsend *irsend, const decode_type_t type,
+                     const uint8_t *state, const uint16_t nbytes)
+    : IRschedulerJob(), irsend(irsend), type(type), data(0), state(state),
+      nbits(nbytes), repeat(kNoRepeat) {}
+
+/// Send the message.
+void IRsendJob::run(void) {
+  if (irsend == NULL) return;
+  if (state != NULL)
+    irsend->send(type, state, nbits);
+  else
+    irsend->send(type, data, nbits, repeat);
+}
+
+/// Class constructor.
+/// @param[in] tick_ms The resolution of the scheduler in mSeconds.
+///   Longer ticks allow longer delays. See `kSchedulerMaxTicks`.
+IRscheduler::IRscheduler(const uint16_t tick_ms)
+    : _now(0), _count(0), _tick_ms(tick_ms ? tick_ms : 1), _carry_ms(0) {
+  for (uint8_t level = 0; level < kSchedulerLevels; level++)
+    for (uint8_t slot = 0; slot < kSchedulerSlots; slot++)
+      _wheel[level][slot] = NULL;
+}
+
+/// Convert a duration in mSeconds to a nr. of scheduler ticks.
+/// @param[in] msecs The duration in mSeconds.
+/// @return The nr. of ticks, rounded up so jobs never run early.
+uint32_t IRscheduler::msToTicks(const uint32_t msecs) const {
+  return msecs / _tick_ms + ((msecs % _tick_ms) ? 1 : 0);
+}
+
+/// Schedule a job to be run at a later time. If the job is already scheduled,
+/// it is rescheduled.
+/// @param[in,out] job A ptr to the job to run.
+/// @param[in] delay_ms How many mSeconds from now to run it.
+/// @param[in] period_ms How often to repeat the job after that. (mSeconds)
+///   0 means only run it once.
+/// @return true, if it was scheduled. false, if a time was too long.
+/// @note The job will run on the first tick after the delay has passed.
+///   i.e. Up to one tick late, but never early.
+bool IRscheduler::schedule(IRschedulerJob *job, const uint32_t delay_ms,
+                           const uint32_t period_ms) {
+  if (job == NULL) return false;
+  uint32_t delay = msToTicks(delay_ms);
+  const uint32_t period = msToTicks(period_ms);
+  if (delay > kSchedulerMaxTicks || period > kSchedulerMaxTicks) return false;
+  if (!delay) delay = 1;  // Nothing can run on a tick we've already processed.
+  cancel(job);
+  job->period = period;
+  job->_expires = _now + delay;
+  _add(job);
+  return true;
+}
+
+/// Stop a job from running.
+/// @param[in,out] job A ptr to the job to cancel.
+/// @return true, if the job was pending. Otherwise, false.
+bool IRscheduler::cancel(IRschedulerJob *job) {
+  if (job == NULL || !job->isPending()) return false;
+  _remove(job);
+  return true;
+}
+
+/// Process all the ticks that have happened since we were last called, running
+/// any jobs that are due.
+/// @return The nr. of jobs that were run.
+uint16_t IRscheduler::run(void) {
+  const uint32_t elapsed = _timer.elapsed() + _carry_ms;
+  if (elapsed < _tick_ms) return 0;
+  _timer.reset();
+  _carry_ms = elapsed % _tick_ms;
+  return advance(elapsed / _tick_ms);
+}
+
+/// Process a given nr. of ticks, running any jobs that become due.
+/// @param[in] ticks The nr. of ticks to move forward.
+/// @return The nr. of jobs that were run.
+uint16_t IRscheduler::advance(uint32_t ticks) {
+  uint16_t ran = 0;
+  while (ticks--) {
+    if (!_count) {  // Nothing to do, so skip ahead.
+      _now += ticks + 1;
+      break;
+    }
+    ran += _tick();
+  }
+  return ran;
+}
+
+/// How many jobs are currently scheduled?
+/// @return The nr. of jobs.
+uint32_t IRscheduler::pending(void) const { return _count; }
+
+/// Get the nr. of ticks processed so far.
+/// @return The nr. of ticks.
+uint32_t IRscheduler::getTicks(void) const { return _now; }
+
+/// Get the resolution of the scheduler.
+/// @return The nr. of mSeconds per tick.
+uint16_t IRscheduler::getTickMs(void) const { return _tick_ms; }
+
+/// Put a job in the appropriate slot of the wheel for its expiry time.
+/// The further away the expiry is, the higher (coarser) the level of the
+/// wheel it goes in. It gets moved down a level as its expiry gets closer.
+/// @param[in,out] job A ptr to the job.
+void IRscheduler::_add(IRschedulerJob *job) {
+  const uint32_t delta = job->_expires - _now;
+  uint8_t level = 0;
+  while (level + 1 < kSchedulerLevels &&
+         delta >= (1UL << (kSchedulerSlotBits * (level + 1))))
+    level++;
+  IRschedulerJob **slot = &_wheel[level][
+      (job->_expires >> (kSchedulerSlotBits * level)) & kSchedulerSlotMask];
+  job->_next = *slot;
+  if (job->_next != NULL) job->_next->_pprev = &job->_next;
+  job->_pprev = slot;
+  *slot = job;
+  _count++;
+}
+
+/// Take a job out of the wheel.
+/// @param[in,out] job A ptr to the job.
+void IRscheduler::_remove(IRschedulerJob *job) {
+  *job->_pprev = job->_next;
+  if (job->_next != NULL) job->_next->_pprev = job->_pprev;
+  job->_next = NULL;
+  job->_pprev = NULL;
+  _count--;
+}
+
+/// Move all the jobs in a slot down to the level(s) below it.
+/// @param[in] level The level of the wheel.
+/// @param[in] index The slot of that level of the wheel.
+void IRscheduler::_cascade(const uint8_t level, const uint8_t index) {
+  IRschedulerJob *job;
+  while ((job = _wheel[level][index]) != NULL) {
+    _remove(job);
+    _add(job);
+  }
+}
+
+/// Process a single tick.
+/// @return The nr. of jobs that were run.
+uint16_t IRscheduler::_tick(void) {
+  _now++;
+  const uint8_t index = _now & kSchedulerSlotMask;
+  // Every time a level wraps around, pull down the next slot of the level
+  // above it.
+  if (!index) {
+    for (uint8_t level = 1; level < kSchedulerLevels; level++) {
+      const uint8_t slot =
+          (_now >> (kSchedulerSlotBits * level)) & kSchedulerSlotMask;
+      _cascade(level, slot);
+      if (slot) break;
+    }
+  }
+  uint16_t ran = 0;
+  IRschedulerJob *job;
+  while ((job = _wheel[0][index]) != NULL) {
+    _remove(job);
+    // Re-arm it first, so the job can cancel or reschedule itself.
+    if (job->period) {
+      job->_expires += job->period;
+      _add(job);
+    }
+    job->run();
+    ran++;
+  }
+  return ran;
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+/// @file
+/// @brief A hierarchical timer-wheel for running timed & repeating IR jobs.
+/// e.g. "Turn the A/C off in 45 minutes", or "Resend the A/C state every
+/// 10 minutes in case the unit forgot it".
+/// @note The scheduler never allocates memory. All job storage is owned by the
+///   caller, and must stay valid (i.e. not go out of scope) while the job is
+///   scheduled.
+
+#ifndef IRSCHEDULER_H_
+#define IRSCHEDULER_H_
+
+#define __STDC_LIMIT_MACROS
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+#include "IRsend.h"
+#include "IRtimer.h"
+
+// Constants
+const uint16_t kSchedulerTickMs = 10;  ///< Default tick resolution. (mSeconds)
+const uint8_t kSchedulerSlotBits = 6;  ///< 64 slots per wheel level.
+const uint8_t kSchedulerSlots = 1 << kSchedulerSlotBits;
+const uint8_t kSchedulerSlotMask = kSchedulerSlots - 1;
+const uint8_t kSchedulerLevels = 4;
+/// Longest delay or period we can schedule. (Ticks)
+/// i.e. ~46 hours with the default tick of 10ms.
+const uint32_t kSchedulerMaxTicks =
+    (1UL << (kSchedulerSlotBits * kSchedulerLevels)) - 1;
+
+// Classes
+
+/// A unit of work that can be run at a later time by an IRscheduler.
+/// Either derive from it & override run(), or supply a callback function.
+class IRschedulerJob {
+ public:
+  explicit IRschedulerJob(void (*callback)(void *context) = NULL,
+                          void *context = NULL);
+  virtual ~IRschedulerJob(void) {}
+  virtual void run(void);
+  bool isPending(void) const;
+  void (*callback)(void *context);  ///< Function to call when it expires.
+  void *context;  ///< Caller supplied data passed to the callback.
+  uint32_t period;  ///< Nr. of ticks between repeats. 0 means run once.
+
+ private:
+  friend class IRscheduler;
+  uint32_t _expires;  ///< The tick this job is due to run on.
+  IRschedulerJob *_next;  ///< Next job in the same wheel slot.
+  IRschedulerJob **_pprev;  ///< Whatever points at us, or NULL if idle.
+};
+
+/// A job that sends a simple message, or a state array, via IRsend::send().
+class IRsendJob : public IRschedulerJob {
+ public:
+  IRsendJob(IRsend *irsend, const decode_type_t type, const uint64_t data,
+            const uint16_t nbits, const uint16_t repeat = kNoRepeat);
+  IRsendJob(IRsend *irsend, const decode_type_t type, const uint8_t *state,
+            const uint16_t nbytes);
+  void run(void);
+  IRsend *irsend;  ///< The object to send the message with.
+  decode_type_t type;  ///< The protocol to send.
+  uint64_t data;  ///< The simple message value to send.
+  const uint8_t *state;  ///< The state array to send. NULL uses `data`.
+  uint16_t nbits;  ///< Nr. of bits of `data`, or nr. of bytes of `state`.
+  uint16_t repeat;  ///< Nr. of message repeats for simple messages.
+};
+
+/// A timer-wheel of pending jobs, driven by the millisecond system clock.
+/// Inserting, cancelling, and expiring a job are all O(1) regardless of how
+/// many jobs are pending.
+/// @note Call run() regularly, e.g. every time through your `loop()`.
+class IRscheduler {
+ public:
+  explicit IRscheduler(const uint16_t tick_ms = kSchedulerTickMs);
+  bool schedule(IRschedulerJob *job, const uint32_t delay_ms,
+                const uint32_t period_ms = 0);
+  bool cancel(IRschedulerJob *job);
+  uint16_t run(void);
+  uint16_t advance(uint32_t ticks);
+  uint32_t pending(void) const;
+  uint32_t getTicks(void) const;
+  uint16_t getTickMs(void) const;
+  uint32_t msToTicks(const uint32_t msecs) const;
+
+ private:
+  /// The wheel slots, each a linked list of jobs.
+  IRschedulerJob *_wheel[kSchedulerLevels][kSchedulerSlots];
+  TimerMs _timer;  ///< Time since we last processed the wheel.
+  uint32_t _now;  ///< The last tick we processed.
+  uint32_t _count;  ///< Nr. of jobs currently scheduled.
+  uint16_t _tick_ms;  ///< How many mSeconds per tick.
+  uint16_t _carry_ms;  ///< mSeconds elapsed that weren't a whole tick.
+  void _add(IRschedulerJob *job);
+  void _remove(IRschedulerJob *job);
+  void _cascade(const uint8_t level, const uint8_t index);
+  uint16_t _tick(void);
+};
+#endif  // IRSCHEDULER_H_
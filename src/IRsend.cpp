@@ -13,6 +13,7 @@
 #ifdef UNIT_TEST
 #include <cmath>
 #endif
+#include "IRprotocol.h"
 #include "IRtimer.h"
 
 /// Constructor for an IRsend object.
@@ -26,7 +27,7 @@
 ///  i.e. If not, assume a 100% duty cycle. Ignore attempts to change the
 ///  duty cycle etc.
 IRsend::IRsend(uint16_t IRsendPin, bool inverted, bool use_modulation)
-    : IRpin(IRsendPin), periodOffset(kPeriodOffset) {
+    : _period(0), IRpin(IRsendPin), periodOffset(kPeriodOffset) {
   if (inverted) {
     outputOn = LOW;
     outputOff = HIGH;
@@ -101,6 +102,7 @@ void IRsend::enableIROut(uint32_t freq, uint8_t duty) {
 #ifdef UNIT_TEST
   _freq_unittest = freq;
 #endif  // UNIT_TEST
+  _period = calcUSecPeriod(freq, false);
   uint32_t period = calcUSecPeriod(freq);
   // Nr. of uSeconds the LED will be on per pulse.
   onTimePeriod = (period * _dutycycle) / kDutyMax;
@@ -166,10 +168,26 @@ uint16_t IRsend::mark(uint16_t usec) {
   // Not simple, so do it assuming frequency modulation.
   uint16_t counter = 0;
   IRtimer usecTimer = IRtimer();
-  // Cache the time taken so far. This saves us calling time, and we can be
-  // assured that we can't have odd math problems. i.e. unsigned under/overflow.
-  uint32_t elapsed = usecTimer.elapsed();
-
+  // Send the bulk of the mark in runs of whole carrier cycles, without reading
+  // the clock every period. Reading it (i.e. `micros()`) takes time on the
+  // ESP8266, which stretches each period and lowers the carrier frequency.
+  // Each run is sized from the nominal period to fill at most half of the time
+  // left, so it can't overrun unless a cycle takes twice as long as it should.
+  // The clock is read after each run, & the clock-checked tail below finishes
+  // the mark exactly.
+  uint32_t elapsed = 0;
+  uint32_t cycles = _period ? usec / _period / 2 : 0;
+  while (cycles) {
+    for (uint32_t i = 0; i < cycles; i++) {
+      ledOn();
+      _delayMicroseconds(onTimePeriod);
+      ledOff();
+      _delayMicroseconds(offTimePeriod);
+    }
+    counter += cycles;
+    elapsed = usecTimer.elapsed();
+    cycles = (elapsed < usec) ? (usec - elapsed) / _period / 2 : 0;
+  }
   while (elapsed < usec) {  // Loop until we've met/exceeded our required time.
     ledOn();
     // Calculate how long we should pulse on for.
@@ -227,8 +245,9 @@ int8_t IRsend::calibrate(uint16_t hz) {
   // Calculate the actual period from the actual time & the actual pulses
   // generated.
   double_t actualPeriod = (double_t)timeTaken / (double_t)pulses;
-  // Store the difference between the actual time per period vs. calculated.
-  periodOffset = (int8_t)((double_t)calcPeriod - actualPeriod);
+  // Store the difference between the actual time per period vs. calculated,
+  // rounded to the nearest uSecond rather than truncated towards zero.
+  periodOffset = (int8_t)floor((double_t)calcPeriod - actualPeriod + 0.5);
   return periodOffset;
 }
 
@@ -549,8 +568,119 @@ void IRsend::sendRaw(const uint16_t buf[], const uint16_t len,
   }
   ledOff();  // We potentially have ended with a mark(), so turn of the LED.
 }
+
+/// Send a raw message straight from a capture buffer. e.g. The `rawbuf` of a
+/// `decode_results`, without building a `sendRaw()` array from it first.
+///
+/// @param[in] ticks An array of durations, in units of `usecs_per_tick`.
+/// @param[in] len Nr. of elements in the ticks[] array.
+/// @param[in] hz Frequency to send the message at. (kHz < 1000; Hz >= 1000)
+/// @param[in] usecs_per_tick Nr. of microseconds per tick. e.g. `kRawTick`
+/// @note Sends exactly what `sendRaw()` would for the array that
+///   `resultToRawArray()` makes. i.e. Durations too long for a `uint16_t` are
+///   split up with a zero length opposite in between.
+/// @code
+///   irsend.sendRawTicks(results.rawbuf + kStartOffset,
+///                       results.rawlen - kStartOffset, 38, kRawTick);
+/// @endcode
+void IRsend::sendRawTicks(const atomic_uint16_t ticks[], const uint16_t len,
+                          const uint16_t hz, const uint16_t usecs_per_tick) {
+  // Set IR carrier frequency
+  enableIROut(hz);
+  for (uint16_t i = 0; i < len; i++) {
+    uint32_t usecs = (uint32_t)ticks[i] * usecs_per_tick;
+    for (; usecs > UINT16_MAX; usecs -= UINT16_MAX) {
+      if (i & 1) {  // Odd bit.
+        space(UINT16_MAX);
+        mark(0);
+      } else {  // Even bit.
+        mark(UINT16_MAX);
+        space(0);
+      }
+    }
+    if (i & 1)  // Odd bit.
+      space(usecs);
+    else  // Even bit.
+      mark(usecs);
+  }
+  ledOff();  // We potentially have ended with a mark(), so turn of the LED.
+}
+
+/// Send a packed raw message. i.e. A compressed `sendRaw()` array.
+///
+/// @param[in] packed A ptr to the packed raw message. e.g. From `packRaw()`.
+/// @param[in] size Nr. of bytes in the packed[] array.
+/// @return true, if the message was valid and sent, otherwise false.
+/// @note The entries are expanded one at a time as they are sent, so no
+///   `uint16_t` array is ever built in memory.
+/// @note Layout (multi-byte values are little-endian):
+///   - [0]    Format version. (kPackedRawVersion)
+///   - [1]    Carrier frequency in kHz.
+///   - [2]    Nr. of entries in the duration dictionary. (1-16)
+///   - [3]    Nr. of bits per symbol. (1, 2 or 4)
+///   - [4-5]  Nr. of symbols in the packed pattern.
+///   - [6-7]  Nr. of raw entries to send. If larger than the nr. of symbols,
+///            the pattern is repeated. i.e. Run-length of repeated frames.
+///   - [8-]   The dictionary. A uint16_t duration (usecs) per entry.
+///   - [...]  The symbols. Indexes into the dictionary, packed LSB first.
+/// Ref:
+///   tools/raw_pack.cpp
+bool IRsend::sendPackedRaw(const uint8_t packed[], const uint16_t size) {
+  const uint16_t length = packedRawLength(packed, size);
+  if (!length) return false;  // Not a valid packed message.
+  // Set IR carrier frequency
+  enableIROut(packed[1]);
+  for (uint16_t i = 0; i < length; i++) {
+    if (i & 1)  // Odd bit.
+      space(packedRawEntry(packed, i));
+    else  // Even bit.
+      mark(packedRawEntry(packed, i));
+  }
+  ledOff();  // We potentially have ended with a mark(), so turn of the LED.
+  return true;
+}
 #endif  // SEND_RAW
 
+/// Check a packed raw message is valid, and how many entries it expands to.
+/// @param[in] packed A ptr to the packed raw message.
+/// @param[in] size Nr. of bytes in the packed[] array.
+/// @return The nr. of `sendRaw()` entries it represents. 0 if it is invalid.
+uint16_t IRsend::packedRawLength(const uint8_t packed[], const uint16_t size) {
+  if (packed == NULL || size < kPackedRawHeaderSize) return 0;
+  if (packed[0] != kPackedRawVersion) return 0;
+  const uint8_t entries = packed[2];
+  const uint8_t bits = packed[3];
+  const uint16_t symbols = packed[4] | (packed[5] << 8);
+  const uint16_t length = packed[6] | (packed[7] << 8);
+  if (entries == 0 || entries > kPackedRawMaxDict) return 0;
+  if ((bits != 1 && bits != 2 && bits != 4) || (1U << bits) < entries)
+    return 0;
+  if (symbols == 0 || length < symbols) return 0;
+  const uint32_t needed = kPackedRawHeaderSize + entries * 2U +
+      ((uint32_t)symbols * bits + 7) / 8;
+  if (size < needed) return 0;  // Truncated.
+  return length;
+}
+
+/// Get a single `sendRaw()` entry from a packed raw message.
+/// @param[in] packed A ptr to a packed raw message already validated by
+///   `packedRawLength()`.
+/// @param[in] index The position of the raw entry wanted.
+/// @return The duration in usecs of the entry.
+uint16_t IRsend::packedRawEntry(const uint8_t packed[], uint16_t index) {
+  const uint8_t entries = packed[2];
+  const uint8_t bits = packed[3];
+  const uint16_t symbols = packed[4] | (packed[5] << 8);
+  if (index >= symbols) index %= symbols;  // A repeat of the pattern.
+  const uint8_t *dict = packed + kPackedRawHeaderSize;
+  const uint32_t bitpos = (uint32_t)index * bits;
+  // Symbols never straddle a byte boundary as `bits` is 1, 2, or 4.
+  const uint8_t symbol = (dict[entries * 2 + (bitpos >> 3)] >> (bitpos & 7)) &
+      ((1 << bits) - 1);
+  if (symbol >= entries) return 0;  // Corrupt. A 0 in sendRaw() means skip.
+  return dict[symbol * 2] | (dict[symbol * 2 + 1] << 8);
+}
+
 /// Get the minimum number of repeats for a given protocol.
 /// @param[in] protocol Protocol number/type of the message you want to send.
 /// @return The number of repeats required.
@@ -817,335 +947,10 @@ uint16_t IRsend::defaultBits(const decode_type_t protocol) {
 /// @return True if it is a type we can attempt to send, false if not.
 bool IRsend::send(const decode_type_t type, const uint64_t data,
                   const uint16_t nbits, const uint16_t repeat) {
-  uint16_t min_repeat __attribute__((unused)) =
-      std::max(IRsend::minRepeats(type), repeat);
-  switch (type) {
-#if SEND_AIRTON
-    case AIRTON:
-      sendAirton(data, nbits, min_repeat);
-      break;
-#endif  // SEND_AIRTON
-#if SEND_AIRWELL
-    case AIRWELL:
-      sendAirwell(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_AIWA_RC_T501
-    case AIWA_RC_T501:
-      sendAiwaRCT501(data, nbits, min_repeat);
-      break;
-#endif  // SEND_AIWA_RC_T501
-#if SEND_ARRIS
-    case ARRIS:
-      sendArris(data, nbits, min_repeat);
-      break;
-#endif  // SEND_ARRIS
-#if SEND_BOSE
-    case BOSE:
-      sendBose(data, nbits, min_repeat);
-      break;
-#endif  // SEND_BOSE
-#if SEND_CARRIER_AC
-    case CARRIER_AC:
-      sendCarrierAC(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_CARRIER_AC40
-    case CARRIER_AC40:
-      sendCarrierAC40(data, nbits, min_repeat);
-      break;
-#endif  // SEND_CARRIER_AC40
-#if SEND_CARRIER_AC64
-    case CARRIER_AC64:
-      sendCarrierAC64(data, nbits, min_repeat);
-      break;
-#endif  // SEND_CARRIER_AC64
-#if SEND_CLIMABUTLER
-    case CLIMABUTLER:
-      sendClimaButler(data, nbits, min_repeat);
-      break;
-#endif  // SEND_CLIMABUTLER
-#if SEND_COOLIX
-    case COOLIX:
-      sendCOOLIX(data, nbits, min_repeat);
-      break;
-#endif  // SEND_COOLIX
-#if SEND_COOLIX48
-    case COOLIX48:
-      sendCoolix48(data, nbits, min_repeat);
-      break;
-#endif  // SEND_COOLIX48
-#if SEND_DAIKIN64
-    case DAIKIN64:
-      sendDaikin64(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_DELONGHI_AC
-    case DELONGHI_AC:
-      sendDelonghiAc(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_DENON
-    case DENON:
-      sendDenon(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_DISH
-    case DISH:
-      sendDISH(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_DOSHISHA
-    case DOSHISHA:
-      sendDoshisha(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_ECOCLIM
-    case ECOCLIM:
-      sendEcoclim(data, nbits, min_repeat);
-      break;
-#endif  // SEND_ECOCLIM
-#if SEND_ELITESCREENS
-    case ELITESCREENS:
-      sendElitescreens(data, nbits, min_repeat);
-      break;
-#endif  // SEND_ELITESCREENS
-#if SEND_EPSON
-    case EPSON:
-      sendEpson(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_GICABLE
-    case GICABLE:
-      sendGICable(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_GOODWEATHER
-    case GOODWEATHER:
-      sendGoodweather(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_GORENJE
-    case GORENJE:
-      sendGorenje(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_GREE
-    case GREE:
-      sendGree(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_INAX
-    case INAX:
-      sendInax(data, nbits, min_repeat);
-      break;
-#endif  // SEND_INAX
-#if SEND_JVC
-    case JVC:
-      sendJVC(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_KELON
-    case KELON:
-      sendKelon(data, nbits, min_repeat);
-      break;
-#endif  // SEND_KELON
-#if SEND_LASERTAG
-    case LASERTAG:
-      sendLasertag(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_LEGOPF
-    case LEGOPF:
-      sendLegoPf(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_LG
-    case LG:
-      sendLG(data, nbits, min_repeat);
-      break;
-    case LG2:
-      sendLG2(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_LUTRON
-    case LUTRON:
-      sendLutron(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_MAGIQUEST
-    case MAGIQUEST:
-      sendMagiQuest(data, nbits, min_repeat);
-      break;
-#endif  // SEND_MAGIQUEST
-#if SEND_METZ
-    case METZ:
-      sendMetz(data, nbits, min_repeat);
-      break;
-#endif  // SEND_METZ
-#if SEND_MIDEA
-    case MIDEA:
-      sendMidea(data, nbits, min_repeat);
-      break;
-#endif  // SEND_MIDEA
-#if SEND_MIDEA24
-    case MIDEA24:
-      sendMidea24(data, nbits, min_repeat);
-      break;
-#endif  // SEND_MIDEA24
-#if SEND_MILESTAG2
-    case MILESTAG2:
-      sendMilestag2(data, nbits, min_repeat);
-      break;
-#endif  // SEND_MILESTAG2
-#if SEND_MITSUBISHI
-    case MITSUBISHI:
-      sendMitsubishi(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_MITSUBISHI2
-    case MITSUBISHI2:
-      sendMitsubishi2(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_MULTIBRACKETS
-    case MULTIBRACKETS:
-      sendMultibrackets(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_NIKAI
-    case NIKAI:
-      sendNikai(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_NEC
-    case NEC:
-    case NEC_LIKE:
-      sendNEC(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_PANASONIC
-    case PANASONIC:
-      sendPanasonic64(data, nbits, min_repeat);
-      break;
-#endif  // SEND_PANASONIC
-#if SEND_PANASONIC_AC32
-    case PANASONIC_AC32:
-      sendPanasonicAC32(data, nbits, min_repeat);
-      break;
-#endif  // SEND_PANASONIC_AC32
-#if SEND_PIONEER
-    case PIONEER:
-      sendPioneer(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_RC5
-    case RC5:
-    case RC5X:
-      sendRC5(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_RC6
-    case RC6:
-      sendRC6(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_RCMM
-    case RCMM:
-      sendRCMM(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_SAMSUNG
-    case SAMSUNG:
-      sendSAMSUNG(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_SAMSUNG36
-    case SAMSUNG36:
-      sendSamsung36(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_SANYO
-    case SANYO_LC7461:
-      sendSanyoLC7461(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_SHARP
-    case SHARP:
-      sendSharpRaw(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_SHERWOOD
-    case SHERWOOD:
-      sendSherwood(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_SONY
-    case SONY:
-      sendSony(data, nbits, min_repeat);
-      break;
-    case SONY_38K:
-      sendSony38(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_SYMPHONY
-    case SYMPHONY:
-      sendSymphony(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_TECHNIBEL_AC
-    case TECHNIBEL_AC:
-      sendTechnibelAc(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_TECO
-    case TECO:
-      sendTeco(data, nbits, min_repeat);
-      break;
-#endif  // SEND_TECO
-#if SEND_TOTO
-    case TOTO:
-      sendToto(data, nbits, min_repeat);
-      break;
-#endif  // SEND_TOTO
-#if SEND_TRANSCOLD
-    case TRANSCOLD:
-      sendTranscold(data, nbits, min_repeat);
-      break;
-#endif  // SEND_TRANSCOLD
-#if SEND_TRUMA
-    case TRUMA:
-      sendTruma(data, nbits, min_repeat);
-      break;
-#endif  // SEND_TRUMA
-#if SEND_VESTEL_AC
-    case VESTEL_AC:
-      sendVestelAc(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_WHYNTER
-    case WHYNTER:
-      sendWhynter(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_WOWWEE
-    case WOWWEE:
-      sendWowwee(data, nbits, min_repeat);
-      break;
-#endif  // SEND_WOWWEE
-#if SEND_XMP
-    case XMP:
-      sendXmp(data, nbits, min_repeat);
-      break;
-#endif
-#if SEND_ZEPEAL
-    case ZEPEAL:
-      sendZepeal(data, nbits, min_repeat);
-      break;
-#endif  // SEND_ZEPEAL
-    default:
-      return false;
-  }
+  const irprotocol_t *protocol = irprotocolFind(type);
+  if (protocol == NULL || protocol->send == NULL) return false;
+  (this->*protocol->send)(data, nbits,
+                          std::max(IRsend::minRepeats(type), repeat));
   return true;
 }
 
@@ -1157,292 +962,8 @@ bool IRsend::send(const decode_type_t type, const uint64_t data,
 /// @return True if it is a type we can attempt to send, false if not.
 bool IRsend::send(const decode_type_t type, const uint8_t *state,
                   const uint16_t nbytes) {
-  switch (type) {
-#if SEND_VOLTAS
-    case VOLTAS:
-      sendVoltas(state, nbytes);
-      break;
-#endif  // SEND_VOLTAS
-#if SEND_AMCOR
-    case AMCOR:
-      sendAmcor(state, nbytes);
-      break;
-#endif
-#if SEND_ARGO
-    case ARGO:
-      sendArgo(state, nbytes);
-      break;
-#endif  // SEND_ARGO
-#if SEND_BOSCH144
-    case BOSCH144:
-      sendBosch144(state, nbytes);
-      break;
-#endif  // SEND_BOSCH144
-#if SEND_CARRIER_AC84
-    case CARRIER_AC84:
-      sendCarrierAC84(state, nbytes);
-      break;
-#endif  // SEND_CARRIER_AC84
-#if SEND_CARRIER_AC128
-    case CARRIER_AC128:
-      sendCarrierAC128(state, nbytes);
-      break;
-#endif  // SEND_CARRIER_AC128
-#if SEND_CORONA_AC
-    case CORONA_AC:
-      sendCoronaAc(state, nbytes);
-      break;
-#endif  // SEND_ARGO
-#if SEND_DAIKIN
-    case DAIKIN:
-      sendDaikin(state, nbytes);
-      break;
-#endif  // SEND_DAIKIN
-#if SEND_DAIKIN128
-    case DAIKIN128:
-        sendDaikin128(state, nbytes);
-        break;
-#endif  // SEND_DAIKIN128
-#if SEND_DAIKIN152
-    case DAIKIN152:
-        sendDaikin152(state, nbytes);
-        break;
-#endif  // SEND_DAIKIN152
-#if SEND_DAIKIN160
-    case DAIKIN160:
-      sendDaikin160(state, nbytes);
-      break;
-#endif  // SEND_DAIKIN160
-#if SEND_DAIKIN176
-    case DAIKIN176:
-      sendDaikin176(state, nbytes);
-      break;
-#endif  // SEND_DAIKIN176
-#if SEND_DAIKIN2
-    case DAIKIN2:
-      sendDaikin2(state, nbytes);
-      break;
-#endif  // SEND_DAIKIN2
-#if SEND_DAIKIN200
-    case DAIKIN200:
-      sendDaikin200(state, nbytes);
-      break;
-#endif  // SEND_DAIKIN200
-#if SEND_DAIKIN216
-    case DAIKIN216:
-      sendDaikin216(state, nbytes);
-      break;
-#endif  // SEND_DAIKIN216
-#if SEND_DAIKIN312
-    case DAIKIN312:
-      sendDaikin312(state, nbytes);
-      break;
-#endif  // SEND_DAIKIN312
-#if SEND_ELECTRA_AC
-    case ELECTRA_AC:
-      sendElectraAC(state, nbytes);
-      break;
-#endif  // SEND_ELECTRA_AC
-#if SEND_FUJITSU_AC
-    case FUJITSU_AC:
-      sendFujitsuAC(state, nbytes);
-      break;
-#endif  // SEND_FUJITSU_AC
-#if SEND_GREE
-    case GREE:
-      sendGree(state, nbytes);
-      break;
-#endif  // SEND_GREE
-#if SEND_HAIER_AC
-    case HAIER_AC:
-      sendHaierAC(state, nbytes);
-      break;
-#endif  // SEND_HAIER_AC
-#if SEND_HAIER_AC_YRW02
-    case HAIER_AC_YRW02:
-      sendHaierACYRW02(state, nbytes);
-      break;
-#endif  // SEND_HAIER_AC_YRW02
-#if SEND_HAIER_AC160
-    case HAIER_AC160:
-      sendHaierAC160(state, nbytes);
-      break;
-#endif  // SEND_HAIER_AC160
-#if SEND_HAIER_AC176
-    case HAIER_AC176:
-      sendHaierAC176(state, nbytes);
-      break;
-#endif  // SEND_HAIER_AC176
-#if SEND_HITACHI_AC
-    case HITACHI_AC:
-      sendHitachiAC(state, nbytes);
-      break;
-#endif  // SEND_HITACHI_AC
-#if SEND_HITACHI_AC1
-    case HITACHI_AC1:
-      sendHitachiAC1(state, nbytes);
-      break;
-#endif  // SEND_HITACHI_AC1
-#if SEND_HITACHI_AC2
-    case HITACHI_AC2:
-      sendHitachiAC2(state, nbytes);
-      break;
-#endif  // SEND_HITACHI_AC2
-#if SEND_HITACHI_AC3
-    case HITACHI_AC3:
-      sendHitachiAc3(state, nbytes);
-      break;
-#endif  // SEND_HITACHI_AC3
-#if SEND_HITACHI_AC264
-    case HITACHI_AC264:
-      sendHitachiAc264(state, nbytes);
-      break;
-#endif  // SEND_HITACHI_AC264
-#if SEND_HITACHI_AC296
-    case HITACHI_AC296:
-      sendHitachiAc296(state, nbytes);
-      break;
-#endif  // SEND_HITACHI_AC296
-#if SEND_HITACHI_AC344
-    case HITACHI_AC344:
-      sendHitachiAc344(state, nbytes);
-      break;
-#endif  // SEND_HITACHI_AC344
-#if SEND_HITACHI_AC424
-    case HITACHI_AC424:
-      sendHitachiAc424(state, nbytes);
-      break;
-#endif  // SEND_HITACHI_AC424
-#if SEND_KELON168
-    case KELON168:
-      sendKelon168(state, nbytes);
-      break;
-#endif  // SEND_KELON168
-#if SEND_KELVINATOR
-    case KELVINATOR:
-      sendKelvinator(state, nbytes);
-      break;
-#endif  // SEND_KELVINATOR
-#if SEND_MIRAGE
-    case MIRAGE:
-      sendMirage(state, nbytes);
-      break;
-#endif  // SEND_MIRAGE
-#if SEND_MITSUBISHI_AC
-    case MITSUBISHI_AC:
-      sendMitsubishiAC(state, nbytes);
-      break;
-#endif  // SEND_MITSUBISHI_AC
-#if SEND_MITSUBISHI136
-    case MITSUBISHI136:
-      sendMitsubishi136(state, nbytes);
-      break;
-#endif  // SEND_MITSUBISHI136
-#if SEND_MITSUBISHI112
-    case MITSUBISHI112:
-      sendMitsubishi112(state, nbytes);
-      break;
-#endif  // SEND_MITSUBISHI112
-#if SEND_MITSUBISHIHEAVY
-    case MITSUBISHI_HEAVY_88:
-      sendMitsubishiHeavy88(state, nbytes);
-      break;
-    case MITSUBISHI_HEAVY_152:
-      sendMitsubishiHeavy152(state, nbytes);
-      break;
-#endif  // SEND_MITSUBISHIHEAVY
-#if SEND_MWM
-    case MWM:
-      sendMWM(state, nbytes);
-      break;
-#endif  // SEND_MWM
-#if SEND_NEOCLIMA
-    case NEOCLIMA:
-      sendNeoclima(state, nbytes);
-      break;
-#endif  // SEND_NEOCLIMA
-#if SEND_PANASONIC_AC
-    case PANASONIC_AC:
-      sendPanasonicAC(state, nbytes);
-      break;
-#endif  // SEND_PANASONIC_AC
-#if SEND_RHOSS
-    case RHOSS:
-      sendRhoss(state, nbytes);
-      break;
-#endif  // SEND_RHOSS
-#if SEND_SAMSUNG_AC
-    case SAMSUNG_AC:
-      sendSamsungAC(state, nbytes);
-      break;
-#endif  // SEND_SAMSUNG_AC
-#if SEND_SANYO_AC
-    case SANYO_AC:
-      sendSanyoAc(state, nbytes);
-      break;
-#endif  // SEND_SANYO_AC
-#if SEND_SANYO_AC88
-    case SANYO_AC88:
-      sendSanyoAc88(state, nbytes);
-      break;
-#endif  // SEND_SANYO_AC88
-#if SEND_SANYO_AC152
-    case SANYO_AC152:
-      sendSanyoAc152(state, nbytes);
-      break;
-#endif  // SEND_SANYO_AC152
-#if SEND_SHARP_AC
-    case SHARP_AC:
-      sendSharpAc(state, nbytes);
-      break;
-#endif  // SEND_SHARP_AC
-#if SEND_TCL96AC
-    case TCL96AC:
-      sendTcl96Ac(state, nbytes);
-      break;
-#endif  // SEND_TCL96AC
-#if SEND_TCL112AC
-    case TCL112AC:
-      sendTcl112Ac(state, nbytes);
-      break;
-#endif  // SEND_TCL112AC
-#if SEND_TEKNOPOINT
-    case TEKNOPOINT:
-      sendTeknopoint(state, nbytes);
-      break;
-#endif  // SEND_TEKNOPOINT
-#if SEND_TOSHIBA_AC
-    case TOSHIBA_AC:
-      sendToshibaAC(state, nbytes);
-      break;
-#endif  // SEND_TOSHIBA_AC
-#if SEND_TROTEC
-    case TROTEC:
-      sendTrotec(state, nbytes);
-      break;
-#endif  // SEND_TROTEC
-#if SEND_TROTEC_3550
-    case TROTEC_3550:
-      sendTrotec3550(state, nbytes);
-      break;
-#endif  // SEND_TROTEC_3550
-#if SEND_WHIRLPOOL_AC
-    case WHIRLPOOL_AC:
-      sendWhirlpoolAC(state, nbytes);
-      break;
-#endif  // SEND_WHIRLPOOL_AC
-#if SEND_YORK
-    case YORK:
-      sendYork(state, nbytes);
-      break;
-#endif  // SEND_YORK
-#if SEND_BLUESTARHEAVY
-    case BLUESTARHEAVY:
-      sendBluestarHeavy(state, nbytes);
-      break;
-#endif  // SEND_BLUESTARHEAVY
-    default:
-      return false;
-  }
+  const irprotocol_t *protocol = irprotocolFind(type);
+  if (protocol == NULL || protocol->sendState == NULL) return false;
+  (this->*protocol->sendState)(state, nbytes, protocol->repeat);
   return true;
 }
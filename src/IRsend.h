@@ -39,6 +39,11 @@ const uint8_t kDutyMax = 100;     // Percentage
 const uint16_t kMaxAccurateUsecDelay = 16383;
 //  Usecs to wait between messages we don't know the proper gap time.
 const uint32_t kDefaultMessageGap = 100000;
+// Packed raw message format. See `IRsend::sendPackedRaw()` for the layout.
+const uint8_t kPackedRawVersion = 1;
+const uint8_t kPackedRawHeaderSize = 8;  // Bytes
+const uint8_t kPackedRawMaxDict = 16;    // Max nr. of distinct durations.
+const uint8_t kPackedRawTolerance = 10;  // Percentage
 /// Placeholder for missing sensor temp value
 /// @note Not using "-1" as it may be a valid external temp
 const float kNoTempValue = -100.0;
@@ -134,6 +139,57 @@ struct state_t {
   bool iFeel = false;
   float sensorTemperature = kNoTempValue;  // `kNoTempValue` means not set.
 };
+
+/// A packed, canonical form of a `state_t`, for cheap storage, comparison, and
+/// hashing. e.g. When keeping the states of lots of A/Cs.
+/// @note Temperatures are kept in 1/100ths of a degree, so converting to & from
+///   a `state_t` is lossless for temperatures with up to two decimal places
+///   between -327.68 & +327.67 degrees.
+/// @see IRac::packState(), IRac::unpackState(), IRac::cmpStates()
+union packed_state_t {
+  uint32_t raw[4];  ///< The state as whole words. Unused bits are always 0.
+  struct {
+    // Word 0
+    uint32_t protocol  :8;  ///< decode_type_t + 1. i.e. 0 is UNKNOWN.
+    uint32_t mode      :3;  ///< opmode_t + 1.
+    uint32_t fanspeed  :3;
+    uint32_t swingv    :3;  ///< swingv_t + 1.
+    uint32_t swingh    :3;  ///< swingh_t + 1.
+    uint32_t command   :2;
+    uint32_t power     :1;
+    uint32_t celsius   :1;
+    uint32_t quiet     :1;
+    uint32_t turbo     :1;
+    uint32_t econo     :1;
+    uint32_t light     :1;
+    uint32_t filter    :1;
+    uint32_t clean     :1;
+    uint32_t beep      :1;
+    uint32_t iFeel     :1;
+    // Word 1
+    int32_t model      :16;
+    int32_t sleep      :16;
+    // Word 2
+    int32_t degrees    :16;  ///< In 1/100ths of a degree.
+    int32_t sensorTemperature :16;  ///< In 1/100ths of a degree.
+    // Word 3
+    int32_t clock      :16;
+    uint32_t           :16;
+  };
+};
+// Make sure every value of the enums fits in its bitfield above.
+static_assert(kLastDecodeType + 1 <= 0xFF,
+              "packed_state_t::protocol is too small for decode_type_t");
+static_assert((int8_t)opmode_t::kLastOpmodeEnum + 1 <= 0x7,
+              "packed_state_t::mode is too small for opmode_t");
+static_assert((int8_t)fanspeed_t::kLastFanspeedEnum <= 0x7,
+              "packed_state_t::fanspeed is too small for fanspeed_t");
+static_assert((int8_t)swingv_t::kLastSwingvEnum + 1 <= 0x7,
+              "packed_state_t::swingv is too small for swingv_t");
+static_assert((int8_t)swingh_t::kLastSwinghEnum + 1 <= 0x7,
+              "packed_state_t::swingh is too small for swingh_t");
+static_assert((int8_t)ac_command_t::kLastAcCommandEnum <= 0x3,
+              "packed_state_t::command is too small for ac_command_t");
 };  // namespace stdAc
 
 /// Fujitsu A/C model numbers
@@ -252,6 +308,11 @@ class IRsend {
   VIRTUAL void space(uint32_t usec);
   int8_t calibrate(uint16_t hz = 38000U);
   void sendRaw(const uint16_t buf[], const uint16_t len, const uint16_t hz);
+  void sendRawTicks(const atomic_uint16_t ticks[], const uint16_t len,
+                    const uint16_t hz, const uint16_t usecs_per_tick);
+  bool sendPackedRaw(const uint8_t packed[], const uint16_t size);
+  static uint16_t packedRawLength(const uint8_t packed[], const uint16_t size);
+  static uint16_t packedRawEntry(const uint8_t packed[], uint16_t index);
   void sendData(uint16_t onemark, uint32_t onespace, uint16_t zeromark,
                 uint32_t zerospace, uint64_t data, uint16_t nbits,
                 bool MSBfirst = true);
@@ -917,6 +978,7 @@ class IRsend {
 #else
   uint32_t _freq_unittest;
 #endif  // UNIT_TEST
+  uint16_t _period;  // The nominal carrier period, without any offset. (uSecs)
   uint16_t onTimePeriod;
   uint16_t offTimePeriod;
   uint16_t IRpin;
@@ -5,6 +5,7 @@
 ///   '../tools/generate_irtext_h.sh' to rebuild the `IRtext.h` file.
 
 #include "IRtext.h"
+#include <stddef.h>
 #ifndef UNIT_TEST
 #include <Arduino.h>
 #endif  // UNIT_TEST
@@ -31,10 +32,80 @@
     IRTEXT_CONST_PTR(NAME) {\
         IRTEXT_CONST_PTR_CAST(IRTEXT_CONST_BLOB_NAME(NAME)) }
 
+#if _IR_LOCALE_POOL_
+#include <ctype.h>
+#include "locale/pool.h"
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(ADDR) (*reinterpret_cast<const uint8_t *>(ADDR))
+#endif  // pgm_read_byte
+#ifndef pgm_read_word
+#define pgm_read_word(ADDR) (*reinterpret_cast<const uint16_t *>(ADDR))
+#endif  // pgm_read_word
+
+// The strings are all in `kIrTextPool` instead.
+#define IRTEXT_CONST_STRING(NAME, VALUE)
+
+static_assert(irtextPoolLocale(ENQUOTE(_IR_LOCALE_)) < kIrTextPoolLocales,
+              "_IR_LOCALE_ isn't in the locale pool. Re-run "
+              "tools/generate_irtext_pool.py with it included.");
+
+/// The locale all the IRtext strings are currently in.
+static uint8_t irtext_locale = irtextPoolLocale(ENQUOTE(_IR_LOCALE_));
+
+/// Get an IRtext string, in the current locale.
+/// @param[in] id The id of the string. e.g. kPowerStrId
+/// @return A Ptr to the string. (In flash memory on ESP8266)
+/// @note This is what `kPowerStr` etc. are when using the locale pool.
+IRTEXT_POOL_PTR irtextPoolStr(const uint16_t id) {
+  if (id >= kIrTextPoolEntries) return irtextPoolStr(kUnknownStrId);
+  return IRTEXT_CONST_PTR_CAST(
+      kIrTextPool + pgm_read_word(&kIrTextPoolIndex[irtext_locale][id]));
+}
+
+/// Change the locale of all the IRtext strings.
+/// @param[in] locale The index of the locale in the pool.
+/// @return true, if it is a valid locale. Otherwise, false & no change.
+bool irtextSetLocale(const uint8_t locale) {
+  if (locale >= kIrTextPoolLocales) return false;
+  irtext_locale = locale;
+  return true;
+}
+
+/// Change the locale of all the IRtext strings.
+/// @param[in] name The name of the locale. e.g. "de-DE" (Case insensitive)
+/// @return true, if the locale is in the pool. Otherwise, false & no change.
+bool irtextSetLocale(const char *name) {
+  if (name == NULL) return false;
+  for (uint8_t locale = 0; locale < kIrTextPoolLocales; locale++) {
+    for (uint8_t i = 0; i < sizeof(kIrTextPoolLocaleNames[0]); i++) {
+      const char c = pgm_read_byte(&kIrTextPoolLocaleNames[locale][i]);
+      if (tolower(c) != tolower(name[i])) break;
+      if (c == '\0') return irtextSetLocale(locale);
+    }
+  }
+  return false;
+}
+
+/// Get the current locale of the IRtext strings.
+/// @return The index of the locale in the pool.
+uint8_t irtextGetLocale(void) {
+  return irtext_locale;
+}
+
+/// Get the name of a locale in the pool.
+/// @param[in] locale The index of the locale in the pool.
+/// @return A Ptr to the name. e.g. "de-DE", or NULL if there is no such locale.
+IRTEXT_POOL_PTR irtextLocaleName(const uint8_t locale) {
+  if (locale >= kIrTextPoolLocales) return NULL;
+  return IRTEXT_CONST_PTR_CAST(kIrTextPoolLocaleNames[locale]);
+}
+#else  // _IR_LOCALE_POOL_
 #define IRTEXT_CONST_STRING(NAME, VALUE)\
     static IRTEXT_CONST_BLOB_DECL(NAME) { VALUE };\
     IRTEXT_CONST_PTR(NAME) PROGMEM {\
         IRTEXT_CONST_PTR_CAST(&(IRTEXT_CONST_BLOB_NAME(NAME))[0]) }
+#endif  // _IR_LOCALE_POOL_
 
 // Common
 IRTEXT_CONST_STRING(kUnknownStr, D_STR_UNKNOWN);  ///< "Unknown"
@@ -305,263 +376,299 @@ IRTEXT_CONST_STRING(kToshibaGenericRemoteBStr, D_STR_TOSHIBAGENERICREMOTEB);
                                // to show only currently included protocols
 // Protocol Names
 // Needs to be in decode_type_t order.
+// X(ID, NAME) for each protocol. The ID is only used internally as a label.
+#define IRTEXT_PROTOCOL_NAMES(X) \
+    X(UNUSED, D_STR_UNUSED) \
+    X(RC5, COND(DECODE_RC5 || SEND_RC5, \
+                D_STR_RC5, D_STR_UNSUPPORTED)) \
+    X(RC6, COND(DECODE_RC6 || SEND_RC6, \
+                D_STR_RC6, D_STR_UNSUPPORTED)) \
+    X(NEC, COND(DECODE_NEC || SEND_NEC, \
+                D_STR_NEC, D_STR_UNSUPPORTED)) \
+    X(SONY, COND(DECODE_SONY || SEND_SONY, \
+                D_STR_SONY, D_STR_UNSUPPORTED)) \
+    X(PANASONIC, COND(DECODE_PANASONIC || SEND_PANASONIC, \
+                D_STR_PANASONIC, D_STR_UNSUPPORTED)) \
+    X(JVC, COND(DECODE_JVC || SEND_JVC, \
+                D_STR_JVC, D_STR_UNSUPPORTED)) \
+    X(SAMSUNG, COND(DECODE_SAMSUNG || SEND_SAMSUNG, \
+                D_STR_SAMSUNG, D_STR_UNSUPPORTED)) \
+    X(WHYNTER, COND(DECODE_WHYNTER || SEND_WHYNTER, \
+                D_STR_WHYNTER, D_STR_UNSUPPORTED)) \
+    X(AIWA_RC_T501, COND(DECODE_AIWA_RC_T501 || SEND_AIWA_RC_T501, \
+                D_STR_AIWA_RC_T501, D_STR_UNSUPPORTED)) \
+    X(LG, COND(DECODE_LG || SEND_LG, \
+                D_STR_LG, D_STR_UNSUPPORTED)) \
+    X(SANYO, COND(DECODE_SANYO || SEND_SANYO, \
+                D_STR_SANYO, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI, COND(DECODE_MITSUBISHI || SEND_MITSUBISHI, \
+                D_STR_MITSUBISHI, D_STR_UNSUPPORTED)) \
+    X(DISH, COND(DECODE_DISH || SEND_DISH, \
+                D_STR_DISH, D_STR_UNSUPPORTED)) \
+    X(SHARP, COND(DECODE_SHARP || SEND_SHARP, \
+                D_STR_SHARP, D_STR_UNSUPPORTED)) \
+    X(COOLIX, COND(DECODE_COOLIX || SEND_COOLIX, \
+                D_STR_COOLIX, D_STR_UNSUPPORTED)) \
+    X(DAIKIN, COND(DECODE_DAIKIN || SEND_DAIKIN, \
+                D_STR_DAIKIN, D_STR_UNSUPPORTED)) \
+    X(DENON, COND(DECODE_DENON || SEND_DENON, \
+                D_STR_DENON, D_STR_UNSUPPORTED)) \
+    X(KELVINATOR, COND(DECODE_KELVINATOR || SEND_KELVINATOR, \
+                D_STR_KELVINATOR, D_STR_UNSUPPORTED)) \
+    X(SHERWOOD, COND(SEND_SHERWOOD, \
+                D_STR_SHERWOOD, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI_AC, COND(DECODE_MITSUBISHI_AC || SEND_MITSUBISHI_AC, \
+                D_STR_MITSUBISHI_AC, D_STR_UNSUPPORTED)) \
+    X(RCMM, COND(DECODE_RCMM || SEND_RCMM, \
+                D_STR_RCMM, D_STR_UNSUPPORTED)) \
+    X(SANYO_LC7461, COND(DECODE_SANYO || SEND_SANYO, \
+                D_STR_SANYO_LC7461, D_STR_UNSUPPORTED)) \
+    X(RC5X, COND(DECODE_RC5 || SEND_RC5, \
+                D_STR_RC5X, D_STR_UNSUPPORTED)) \
+    X(GREE, COND(DECODE_GREE || SEND_GREE, \
+                D_STR_GREE, D_STR_UNSUPPORTED)) \
+    X(PRONTO, COND(SEND_PRONTO, \
+                D_STR_PRONTO, D_STR_UNSUPPORTED)) \
+    X(NEC_LIKE, COND(DECODE_NEC || SEND_NEC, \
+                D_STR_NEC_LIKE, D_STR_UNSUPPORTED)) \
+    X(ARGO, COND(DECODE_ARGO || SEND_ARGO, \
+                D_STR_ARGO, D_STR_UNSUPPORTED)) \
+    X(TROTEC, COND(DECODE_TROTEC || SEND_TROTEC, \
+                D_STR_TROTEC, D_STR_UNSUPPORTED)) \
+    X(NIKAI, COND(DECODE_NIKAI || SEND_NIKAI, \
+                D_STR_NIKAI, D_STR_UNSUPPORTED)) \
+    X(RAW, COND(SEND_RAW, \
+                D_STR_RAW, D_STR_UNSUPPORTED)) \
+    X(GLOBALCACHE, COND(SEND_GLOBALCACHE, \
+                D_STR_GLOBALCACHE, D_STR_UNSUPPORTED)) \
+    X(TOSHIBA_AC, COND(DECODE_TOSHIBA_AC || SEND_TOSHIBA_AC, \
+                D_STR_TOSHIBA_AC, D_STR_UNSUPPORTED)) \
+    X(FUJITSU_AC, COND(DECODE_FUJITSU_AC || SEND_FUJITSU_AC, \
+                D_STR_FUJITSU_AC, D_STR_UNSUPPORTED)) \
+    X(MIDEA, COND(DECODE_MIDEA || SEND_MIDEA, \
+                D_STR_MIDEA, D_STR_UNSUPPORTED)) \
+    X(MAGIQUEST, COND(DECODE_MAGIQUEST || SEND_MAGIQUEST, \
+                D_STR_MAGIQUEST, D_STR_UNSUPPORTED)) \
+    X(LASERTAG, COND(DECODE_LASERTAG || SEND_LASERTAG, \
+                D_STR_LASERTAG, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC, COND(DECODE_CARRIER_AC || SEND_CARRIER_AC, \
+                D_STR_CARRIER_AC, D_STR_UNSUPPORTED)) \
+    X(HAIER_AC, COND(DECODE_HAIER_AC || SEND_HAIER_AC, \
+                D_STR_HAIER_AC, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI2, COND(DECODE_MITSUBISHI2 || SEND_MITSUBISHI2, \
+                D_STR_MITSUBISHI2, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC, COND(DECODE_HITACHI_AC || SEND_HITACHI_AC, \
+                D_STR_HITACHI_AC, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC1, COND(DECODE_HITACHI_AC1 || SEND_HITACHI_AC1, \
+                D_STR_HITACHI_AC1, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC2, COND(DECODE_HITACHI_AC2 || SEND_HITACHI_AC2, \
+                D_STR_HITACHI_AC2, D_STR_UNSUPPORTED)) \
+    X(GICABLE, COND(DECODE_GICABLE || SEND_GICABLE, \
+                D_STR_GICABLE, D_STR_UNSUPPORTED)) \
+    X(HAIER_AC_YRW02, COND(DECODE_HAIER_AC_YRW02 || SEND_HAIER_AC_YRW02, \
+                D_STR_HAIER_AC_YRW02, D_STR_UNSUPPORTED)) \
+    X(WHIRLPOOL_AC, COND(DECODE_WHIRLPOOL_AC || SEND_WHIRLPOOL_AC, \
+                D_STR_WHIRLPOOL_AC, D_STR_UNSUPPORTED)) \
+    X(SAMSUNG_AC, COND(DECODE_SAMSUNG_AC || SEND_SAMSUNG_AC, \
+                D_STR_SAMSUNG_AC, D_STR_UNSUPPORTED)) \
+    X(LUTRON, COND(DECODE_LUTRON || SEND_LUTRON, \
+                D_STR_LUTRON, D_STR_UNSUPPORTED)) \
+    X(ELECTRA_AC, COND(DECODE_ELECTRA_AC || SEND_ELECTRA_AC, \
+                D_STR_ELECTRA_AC, D_STR_UNSUPPORTED)) \
+    X(PANASONIC_AC, COND(DECODE_PANASONIC_AC || SEND_PANASONIC_AC, \
+                D_STR_PANASONIC_AC, D_STR_UNSUPPORTED)) \
+    X(PIONEER, COND(DECODE_PIONEER || SEND_PIONEER, \
+                D_STR_PIONEER, D_STR_UNSUPPORTED)) \
+    X(LG2, COND(DECODE_LG || SEND_LG, \
+                D_STR_LG2, D_STR_UNSUPPORTED)) \
+    X(MWM, COND(DECODE_MWM || SEND_MWM, \
+                D_STR_MWM, D_STR_UNSUPPORTED)) \
+    X(DAIKIN2, COND(DECODE_DAIKIN2 || SEND_DAIKIN2, \
+                D_STR_DAIKIN2, D_STR_UNSUPPORTED)) \
+    X(VESTEL_AC, COND(DECODE_VESTEL_AC || SEND_VESTEL_AC, \
+                D_STR_VESTEL_AC, D_STR_UNSUPPORTED)) \
+    X(TECO, COND(DECODE_TECO || SEND_TECO, \
+                D_STR_TECO, D_STR_UNSUPPORTED)) \
+    X(SAMSUNG36, COND(DECODE_SAMSUNG36 || SEND_SAMSUNG36, \
+                D_STR_SAMSUNG36, D_STR_UNSUPPORTED)) \
+    X(TCL112AC, COND(DECODE_TCL112AC || SEND_TCL112AC, \
+                D_STR_TCL112AC, D_STR_UNSUPPORTED)) \
+    X(LEGOPF, COND(DECODE_LEGOPF || SEND_LEGOPF, \
+                D_STR_LEGOPF, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI_HEAVY_88, \
+      COND(DECODE_MITSUBISHIHEAVY || SEND_MITSUBISHIHEAVY, \
+           D_STR_MITSUBISHI_HEAVY_88, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI_HEAVY_152, \
+      COND(DECODE_MITSUBISHIHEAVY || SEND_MITSUBISHIHEAVY, \
+           D_STR_MITSUBISHI_HEAVY_152, D_STR_UNSUPPORTED)) \
+    X(DAIKIN216, COND(DECODE_DAIKIN216 || SEND_DAIKIN216, \
+                D_STR_DAIKIN216, D_STR_UNSUPPORTED)) \
+    X(SHARP_AC, COND(DECODE_SHARP_AC || SEND_SHARP_AC, \
+                D_STR_SHARP_AC, D_STR_UNSUPPORTED)) \
+    X(GOODWEATHER, COND(DECODE_GOODWEATHER || SEND_GOODWEATHER, \
+                D_STR_GOODWEATHER, D_STR_UNSUPPORTED)) \
+    X(INAX, COND(DECODE_INAX || SEND_INAX, \
+                D_STR_INAX, D_STR_UNSUPPORTED)) \
+    X(DAIKIN160, COND(DECODE_DAIKIN160 || SEND_DAIKIN160, \
+                D_STR_DAIKIN160, D_STR_UNSUPPORTED)) \
+    X(NEOCLIMA, COND(DECODE_NEOCLIMA || SEND_NEOCLIMA, \
+                D_STR_NEOCLIMA, D_STR_UNSUPPORTED)) \
+    X(DAIKIN176, COND(DECODE_DAIKIN176 || SEND_DAIKIN176, \
+                D_STR_DAIKIN176, D_STR_UNSUPPORTED)) \
+    X(DAIKIN128, COND(DECODE_DAIKIN128 || SEND_DAIKIN128, \
+                D_STR_DAIKIN128, D_STR_UNSUPPORTED)) \
+    X(AMCOR, COND(DECODE_AMCOR || SEND_AMCOR, \
+                D_STR_AMCOR, D_STR_UNSUPPORTED)) \
+    X(DAIKIN152, COND(DECODE_DAIKIN152 || SEND_DAIKIN152, \
+                D_STR_DAIKIN152, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI136, COND(DECODE_MITSUBISHI136 || SEND_MITSUBISHI136, \
+                D_STR_MITSUBISHI136, D_STR_UNSUPPORTED)) \
+    X(MITSUBISHI112, COND(DECODE_MITSUBISHI112 || SEND_MITSUBISHI112, \
+                D_STR_MITSUBISHI112, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC424, COND(DECODE_HITACHI_AC424 || SEND_HITACHI_AC424, \
+                D_STR_HITACHI_AC424, D_STR_UNSUPPORTED)) \
+    X(SONY_38K, COND(SEND_SONY, \
+                D_STR_SONY_38K, D_STR_UNSUPPORTED)) \
+    X(EPSON, COND(DECODE_EPSON || SEND_EPSON, \
+                D_STR_EPSON, D_STR_UNSUPPORTED)) \
+    X(SYMPHONY, COND(DECODE_SYMPHONY || SEND_SYMPHONY, \
+                D_STR_SYMPHONY, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC3, COND(DECODE_HITACHI_AC3 || SEND_HITACHI_AC3, \
+                D_STR_HITACHI_AC3, D_STR_UNSUPPORTED)) \
+    X(DAIKIN64, COND(DECODE_DAIKIN64 || SEND_DAIKIN64, \
+                D_STR_DAIKIN64, D_STR_UNSUPPORTED)) \
+    X(AIRWELL, COND(DECODE_AIRWELL || SEND_AIRWELL, \
+                D_STR_AIRWELL, D_STR_UNSUPPORTED)) \
+    X(DELONGHI_AC, COND(DECODE_DELONGHI_AC || SEND_DELONGHI_AC, \
+                D_STR_DELONGHI_AC, D_STR_UNSUPPORTED)) \
+    X(DOSHISHA, COND(DECODE_DOSHISHA || SEND_DOSHISHA, \
+                D_STR_DOSHISHA, D_STR_UNSUPPORTED)) \
+    X(MULTIBRACKETS, COND(DECODE_MULTIBRACKETS || SEND_MULTIBRACKETS, \
+                D_STR_MULTIBRACKETS, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC40, COND(DECODE_CARRIER_AC40 || SEND_CARRIER_AC40, \
+                D_STR_CARRIER_AC40, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC64, COND(DECODE_CARRIER_AC64 || SEND_CARRIER_AC64, \
+                D_STR_CARRIER_AC64, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC344, COND(DECODE_HITACHI_AC344 || SEND_HITACHI_AC344, \
+                D_STR_HITACHI_AC344, D_STR_UNSUPPORTED)) \
+    X(CORONA_AC, COND(DECODE_CORONA_AC || SEND_CORONA_AC, \
+                D_STR_CORONA_AC, D_STR_UNSUPPORTED)) \
+    X(MIDEA24, COND(DECODE_MIDEA24 || SEND_MIDEA24, \
+                D_STR_MIDEA24, D_STR_UNSUPPORTED)) \
+    X(ZEPEAL, COND(DECODE_ZEPEAL || SEND_ZEPEAL, \
+                D_STR_ZEPEAL, D_STR_UNSUPPORTED)) \
+    X(SANYO_AC, COND(DECODE_SANYO_AC || SEND_SANYO_AC, \
+                D_STR_SANYO_AC, D_STR_UNSUPPORTED)) \
+    X(VOLTAS, COND(DECODE_VOLTAS || SEND_VOLTAS, \
+                D_STR_VOLTAS, D_STR_UNSUPPORTED)) \
+    X(METZ, COND(DECODE_METZ || SEND_METZ, \
+                D_STR_METZ, D_STR_UNSUPPORTED)) \
+    X(TRANSCOLD, COND(DECODE_TRANSCOLD || SEND_TRANSCOLD, \
+                D_STR_TRANSCOLD, D_STR_UNSUPPORTED)) \
+    X(TECHNIBEL_AC, COND(DECODE_TECHNIBEL_AC || SEND_TECHNIBEL_AC, \
+                D_STR_TECHNIBEL_AC, D_STR_UNSUPPORTED)) \
+    X(MIRAGE, COND(DECODE_MIRAGE || SEND_MIRAGE, \
+                D_STR_MIRAGE, D_STR_UNSUPPORTED)) \
+    X(ELITESCREENS, COND(DECODE_ELITESCREENS || SEND_ELITESCREENS, \
+                D_STR_ELITESCREENS, D_STR_UNSUPPORTED)) \
+    X(PANASONIC_AC32, COND(DECODE_PANASONIC_AC32 || SEND_PANASONIC_AC32, \
+                D_STR_PANASONIC_AC32, D_STR_UNSUPPORTED)) \
+    X(MILESTAG2, COND(DECODE_MILESTAG2 || SEND_MILESTAG2, \
+                D_STR_MILESTAG2, D_STR_UNSUPPORTED)) \
+    X(ECOCLIM, COND(DECODE_ECOCLIM || SEND_ECOCLIM, \
+                D_STR_ECOCLIM, D_STR_UNSUPPORTED)) \
+    X(XMP, COND(DECODE_XMP || SEND_XMP, \
+                D_STR_XMP, D_STR_UNSUPPORTED)) \
+    X(TRUMA, COND(DECODE_TRUMA || SEND_TRUMA, \
+                D_STR_TRUMA, D_STR_UNSUPPORTED)) \
+    X(HAIER_AC176, COND(DECODE_HAIER_AC176 || SEND_HAIER_AC176, \
+                D_STR_HAIER_AC176, D_STR_UNSUPPORTED)) \
+    X(TEKNOPOINT, COND(DECODE_TEKNOPOINT || SEND_TEKNOPOINT, \
+                D_STR_TEKNOPOINT, D_STR_UNSUPPORTED)) \
+    X(KELON, COND(DECODE_KELON || SEND_KELON, \
+                D_STR_KELON, D_STR_UNSUPPORTED)) \
+    X(TROTEC_3550, COND(DECODE_TROTEC_3550 || SEND_TROTEC_3550, \
+                D_STR_TROTEC_3550, D_STR_UNSUPPORTED)) \
+    X(SANYO_AC88, COND(DECODE_SANYO_AC88 || SEND_SANYO_AC88, \
+                D_STR_SANYO_AC88, D_STR_UNSUPPORTED)) \
+    X(BOSE, COND(DECODE_BOSE || SEND_BOSE, \
+                D_STR_BOSE, D_STR_UNSUPPORTED)) \
+    X(ARRIS, COND(DECODE_ARRIS || SEND_ARRIS, \
+                D_STR_ARRIS, D_STR_UNSUPPORTED)) \
+    X(RHOSS, COND(DECODE_RHOSS || SEND_RHOSS, \
+                D_STR_RHOSS, D_STR_UNSUPPORTED)) \
+    X(AIRTON, COND(DECODE_AIRTON || SEND_AIRTON, \
+                D_STR_AIRTON, D_STR_UNSUPPORTED)) \
+    X(COOLIX48, COND(DECODE_COOLIX48 || SEND_COOLIX48, \
+                D_STR_COOLIX48, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC264, COND(DECODE_HITACHI_AC264 || SEND_HITACHI_AC264, \
+                D_STR_HITACHI_AC264, D_STR_UNSUPPORTED)) \
+    X(KELON168, COND(DECODE_KELON168 || SEND_KELON168, \
+                D_STR_KELON168, D_STR_UNSUPPORTED)) \
+    X(HITACHI_AC296, COND(DECODE_HITACHI_AC296 || SEND_HITACHI_AC296, \
+                D_STR_HITACHI_AC296, D_STR_UNSUPPORTED)) \
+    X(DAIKIN200, COND(DECODE_DAIKIN200 || SEND_DAIKIN200, \
+                D_STR_DAIKIN200, D_STR_UNSUPPORTED)) \
+    X(HAIER_AC160, COND(DECODE_HAIER_AC160 || SEND_HAIER_AC160, \
+                D_STR_HAIER_AC160, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC128, COND(DECODE_CARRIER_AC128 || SEND_CARRIER_AC128, \
+                D_STR_CARRIER_AC128, D_STR_UNSUPPORTED)) \
+    X(TOTO, COND(DECODE_TOTO || SEND_TOTO, \
+                D_STR_TOTO, D_STR_UNSUPPORTED)) \
+    X(CLIMABUTLER, COND(DECODE_CLIMABUTLER || SEND_CLIMABUTLER, \
+                D_STR_CLIMABUTLER, D_STR_UNSUPPORTED)) \
+    X(TCL96AC, COND(DECODE_TCL96AC || SEND_TCL96AC, \
+                D_STR_TCL96AC, D_STR_UNSUPPORTED)) \
+    X(BOSCH144, COND(DECODE_BOSCH144 || SEND_BOSCH144, \
+                D_STR_BOSCH144, D_STR_UNSUPPORTED)) \
+    X(SANYO_AC152, COND(DECODE_SANYO_AC152 || SEND_SANYO_AC152, \
+                D_STR_SANYO_AC152, D_STR_UNSUPPORTED)) \
+    X(DAIKIN312, COND(DECODE_DAIKIN312 || SEND_DAIKIN312, \
+                D_STR_DAIKIN312, D_STR_UNSUPPORTED)) \
+    X(GORENJE, COND(DECODE_GORENJE || SEND_GORENJE, \
+                D_STR_GORENJE, D_STR_UNSUPPORTED)) \
+    X(WOWWEE, COND(DECODE_WOWWEE || SEND_WOWWEE, \
+                D_STR_WOWWEE, D_STR_UNSUPPORTED)) \
+    X(CARRIER_AC84, COND(DECODE_CARRIER_AC84 || SEND_CARRIER_AC84, \
+                D_STR_CARRIER_AC84, D_STR_UNSUPPORTED)) \
+    X(YORK, COND(DECODE_YORK || SEND_YORK, \
+                D_STR_YORK, D_STR_UNSUPPORTED)) \
+    X(BLUESTARHEAVY, COND(DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY, \
+                D_STR_BLUESTARHEAVY, D_STR_UNSUPPORTED)) \
+    /* New protocol (macro) strings should be added just above this line. */
+
+#define IRTEXT_PROTOCOL_NAME_STR(ID, NAME) NAME "\x0"
 IRTEXT_CONST_BLOB_DECL(kAllProtocolNamesStr) {
-    D_STR_UNUSED "\x0"
-    COND(DECODE_RC5 || SEND_RC5,
-            D_STR_RC5, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_RC6 || SEND_RC6,
-            D_STR_RC6, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_NEC || SEND_NEC,
-            D_STR_NEC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SONY || SEND_SONY,
-            D_STR_SONY, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_PANASONIC || SEND_PANASONIC,
-            D_STR_PANASONIC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_JVC || SEND_JVC,
-            D_STR_JVC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SAMSUNG || SEND_SAMSUNG,
-            D_STR_SAMSUNG, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_WHYNTER || SEND_WHYNTER,
-            D_STR_WHYNTER, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_AIWA_RC_T501 || SEND_AIWA_RC_T501,
-            D_STR_AIWA_RC_T501, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LG || SEND_LG,
-            D_STR_LG, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO || SEND_SANYO,
-            D_STR_SANYO, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHI || SEND_MITSUBISHI,
-            D_STR_MITSUBISHI, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DISH || SEND_DISH,
-            D_STR_DISH, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SHARP || SEND_SHARP,
-            D_STR_SHARP, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_COOLIX || SEND_COOLIX,
-            D_STR_COOLIX, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN || SEND_DAIKIN,
-            D_STR_DAIKIN, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DENON || SEND_DENON,
-            D_STR_DENON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_KELVINATOR || SEND_KELVINATOR,
-            D_STR_KELVINATOR, D_STR_UNSUPPORTED) "\x0"
-    COND(SEND_SHERWOOD,
-            D_STR_SHERWOOD, D_STR_UNSUPPORTED) "\x0"  // SEND-ONLY
-    COND(DECODE_MITSUBISHI_AC || SEND_MITSUBISHI_AC,
-            D_STR_MITSUBISHI_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_RCMM || SEND_RCMM,
-            D_STR_RCMM, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO || SEND_SANYO,
-            D_STR_SANYO_LC7461, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_RC5 || SEND_RC5,
-            D_STR_RC5X, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_GREE || SEND_GREE,
-            D_STR_GREE, D_STR_UNSUPPORTED) "\x0"
-    COND(SEND_PRONTO,
-            D_STR_PRONTO, D_STR_UNSUPPORTED) "\x0"  // SEND-ONLY
-    COND(DECODE_NEC || SEND_NEC,
-            D_STR_NEC_LIKE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ARGO || SEND_ARGO,
-            D_STR_ARGO, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TROTEC || SEND_TROTEC,
-            D_STR_TROTEC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_NIKAI || SEND_NIKAI,
-            D_STR_NIKAI, D_STR_UNSUPPORTED) "\x0"
-    COND(SEND_RAW,
-            D_STR_RAW, D_STR_UNSUPPORTED) "\x0"  // SEND-ONLY
-    COND(SEND_GLOBALCACHE,
-            D_STR_GLOBALCACHE, D_STR_UNSUPPORTED) "\x0"  // SEND
-    COND(DECODE_TOSHIBA_AC || SEND_TOSHIBA_AC,
-            D_STR_TOSHIBA_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_FUJITSU_AC || SEND_FUJITSU_AC,
-            D_STR_FUJITSU_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MIDEA || SEND_MIDEA,
-            D_STR_MIDEA, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MAGIQUEST || SEND_MAGIQUEST,
-            D_STR_MAGIQUEST, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LASERTAG || SEND_LASERTAG,
-            D_STR_LASERTAG, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC || SEND_CARRIER_AC,
-            D_STR_CARRIER_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HAIER_AC || SEND_HAIER_AC,
-            D_STR_HAIER_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHI2 || SEND_MITSUBISHI2,
-            D_STR_MITSUBISHI2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC || SEND_HITACHI_AC,
-            D_STR_HITACHI_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC1 || SEND_HITACHI_AC1,
-            D_STR_HITACHI_AC1, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC2 || SEND_HITACHI_AC2,
-            D_STR_HITACHI_AC2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_GICABLE || SEND_GICABLE,
-            D_STR_GICABLE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HAIER_AC_YRW02 || SEND_HAIER_AC_YRW02,
-            D_STR_HAIER_AC_YRW02, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_WHIRLPOOL_AC || SEND_WHIRLPOOL_AC,
-            D_STR_WHIRLPOOL_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SAMSUNG_AC || SEND_SAMSUNG_AC,
-            D_STR_SAMSUNG_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LUTRON || SEND_LUTRON,
-            D_STR_LUTRON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ELECTRA_AC || SEND_ELECTRA_AC,
-            D_STR_ELECTRA_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_PANASONIC_AC || SEND_PANASONIC_AC,
-            D_STR_PANASONIC_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_PIONEER || SEND_PIONEER,
-            D_STR_PIONEER, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LG || SEND_LG,
-            D_STR_LG2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MWM || SEND_MWM,
-            D_STR_MWM, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN2 || SEND_DAIKIN2,
-            D_STR_DAIKIN2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_VESTEL_AC || SEND_VESTEL_AC,
-            D_STR_VESTEL_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TECO || SEND_TECO,
-            D_STR_TECO, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SAMSUNG36 || SEND_SAMSUNG36,
-            D_STR_SAMSUNG36, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TCL112AC || SEND_TCL112AC,
-            D_STR_TCL112AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_LEGOPF || SEND_LEGOPF,
-            D_STR_LEGOPF, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHIHEAVY || SEND_MITSUBISHIHEAVY,
-            D_STR_MITSUBISHI_HEAVY_88, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHIHEAVY || SEND_MITSUBISHIHEAVY,
-            D_STR_MITSUBISHI_HEAVY_152, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN216 || SEND_DAIKIN216,
-            D_STR_DAIKIN216, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SHARP_AC || SEND_SHARP_AC,
-            D_STR_SHARP_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_GOODWEATHER || SEND_GOODWEATHER,
-            D_STR_GOODWEATHER, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_INAX || SEND_INAX,
-            D_STR_INAX, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN160 || SEND_DAIKIN160,
-            D_STR_DAIKIN160, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_NEOCLIMA || SEND_NEOCLIMA,
-            D_STR_NEOCLIMA, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN176 || SEND_DAIKIN176,
-            D_STR_DAIKIN176, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN128 || SEND_DAIKIN128,
-            D_STR_DAIKIN128, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_AMCOR || SEND_AMCOR,
-            D_STR_AMCOR, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN152 || SEND_DAIKIN152,
-            D_STR_DAIKIN152, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHI136 || SEND_MITSUBISHI136,
-            D_STR_MITSUBISHI136, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MITSUBISHI112 || SEND_MITSUBISHI112,
-            D_STR_MITSUBISHI112, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC424 || SEND_HITACHI_AC424,
-            D_STR_HITACHI_AC424, D_STR_UNSUPPORTED) "\x0"
-    COND(SEND_SONY,
-            D_STR_SONY_38K, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_EPSON || SEND_EPSON,
-            D_STR_EPSON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SYMPHONY || SEND_SYMPHONY,
-            D_STR_SYMPHONY, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC3 || SEND_HITACHI_AC3,
-            D_STR_HITACHI_AC3, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN64 || SEND_DAIKIN64,
-            D_STR_DAIKIN64, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_AIRWELL || SEND_AIRWELL,
-            D_STR_AIRWELL, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DELONGHI_AC || SEND_DELONGHI_AC,
-            D_STR_DELONGHI_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DOSHISHA || SEND_DOSHISHA,
-            D_STR_DOSHISHA, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MULTIBRACKETS || SEND_MULTIBRACKETS,
-            D_STR_MULTIBRACKETS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC40 || SEND_CARRIER_AC40,
-            D_STR_CARRIER_AC40, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC64 || SEND_CARRIER_AC64,
-            D_STR_CARRIER_AC64, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC344 || SEND_HITACHI_AC344,
-            D_STR_HITACHI_AC344, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CORONA_AC || SEND_CORONA_AC,
-            D_STR_CORONA_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MIDEA24 || SEND_MIDEA24,
-            D_STR_MIDEA24, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ZEPEAL || SEND_ZEPEAL,
-            D_STR_ZEPEAL, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO_AC || SEND_SANYO_AC,
-            D_STR_SANYO_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_VOLTAS || SEND_VOLTAS,
-            D_STR_VOLTAS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_METZ || SEND_METZ,
-            D_STR_METZ, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TRANSCOLD || SEND_TRANSCOLD,
-            D_STR_TRANSCOLD, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TECHNIBEL_AC || SEND_TECHNIBEL_AC,
-            D_STR_TECHNIBEL_AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MIRAGE || SEND_MIRAGE,
-            D_STR_MIRAGE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ELITESCREENS || SEND_ELITESCREENS,
-            D_STR_ELITESCREENS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_PANASONIC_AC32 || SEND_PANASONIC_AC32,
-            D_STR_PANASONIC_AC32, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_MILESTAG2 || SEND_MILESTAG2,
-            D_STR_MILESTAG2, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ECOCLIM || SEND_ECOCLIM,
-            D_STR_ECOCLIM, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_XMP || SEND_XMP,
-            D_STR_XMP, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TRUMA || SEND_TRUMA,
-            D_STR_TRUMA, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HAIER_AC176 || SEND_HAIER_AC176,
-            D_STR_HAIER_AC176, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TEKNOPOINT || SEND_TEKNOPOINT,
-            D_STR_TEKNOPOINT, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_KELON || SEND_KELON,
-            D_STR_KELON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TROTEC_3550 || SEND_TROTEC_3550,
-            D_STR_TROTEC_3550, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO_AC88 || SEND_SANYO_AC88,
-            D_STR_SANYO_AC88, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_BOSE || SEND_BOSE,
-            D_STR_BOSE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_ARRIS || SEND_ARRIS,
-            D_STR_ARRIS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_RHOSS || SEND_RHOSS,
-            D_STR_RHOSS, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_AIRTON || SEND_AIRTON,
-            D_STR_AIRTON, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_COOLIX48 || SEND_COOLIX48,
-            D_STR_COOLIX48, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC264 || SEND_HITACHI_AC264,
-            D_STR_HITACHI_AC264, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_KELON168 || SEND_KELON168,
-            D_STR_KELON168, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HITACHI_AC296 || SEND_HITACHI_AC296,
-            D_STR_HITACHI_AC296, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN200 || SEND_DAIKIN200,
-            D_STR_DAIKIN200, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_HAIER_AC160 || SEND_HAIER_AC160,
-            D_STR_HAIER_AC160, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC128 || SEND_CARRIER_AC128,
-            D_STR_CARRIER_AC128, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TOTO || SEND_TOTO,
-            D_STR_TOTO, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CLIMABUTLER || SEND_CLIMABUTLER,
-            D_STR_CLIMABUTLER, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_TCL96AC || SEND_TCL96AC,
-            D_STR_TCL96AC, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_BOSCH144 || SEND_BOSCH144,
-            D_STR_BOSCH144, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_SANYO_AC152 || SEND_SANYO_AC152,
-            D_STR_SANYO_AC152, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_DAIKIN312 || SEND_DAIKIN312,
-            D_STR_DAIKIN312, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_GORENJE || SEND_GORENJE,
-            D_STR_GORENJE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_WOWWEE || SEND_WOWWEE,
-            D_STR_WOWWEE, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_CARRIER_AC84 || SEND_CARRIER_AC84,
-            D_STR_CARRIER_AC84, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_YORK || SEND_YORK,
-            D_STR_YORK, D_STR_UNSUPPORTED) "\x0"
-    COND(DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY,
-            D_STR_BLUESTARHEAVY, D_STR_UNSUPPORTED) "\x0"
-    ///< New protocol (macro) strings should be added just above this line.
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_STR)
     "\x0"  ///< This string requires double null termination.
 };
 IRTEXT_CONST_BLOB_PTR(kAllProtocolNamesStr);
+
+// A type with a char array member for each protocol name, laid out exactly
+// like `kAllProtocolNamesStr`, so the compiler can work out where each name
+// starts. It is never instantiated.
+#define IRTEXT_PROTOCOL_NAME_MEMBER(ID, NAME) char ID##Name[sizeof(NAME)];
+struct IRtextProtocolNames {
+  IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_MEMBER)
+};
+static_assert(sizeof(IRtextProtocolNames) + 2 ==
+              sizeof(IRTEXT_CONST_BLOB_NAME(kAllProtocolNamesStr)),
+              "Protocol name offsets don't match the protocol names.");
+
+/// Offset of each protocol name in `kAllProtocolNamesStr`, so looking one up
+/// doesn't need to walk all the names before it.
+#define IRTEXT_PROTOCOL_NAME_OFFSET(ID, NAME) \
+    offsetof(IRtextProtocolNames, ID##Name),
+const uint16_t kAllProtocolNameOffsets[] PROGMEM = {
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_OFFSET)
+};
+static_assert(sizeof(kAllProtocolNameOffsets) / sizeof(uint16_t) ==
+              kLastDecodeType + 1,
+              "There must be a protocol name for every decode_type_t.");
+
+/// Case-insensitive hash of each protocol name, in decode_type_t order, so a
+/// name can be matched without string comparisons against every protocol.
+#define IRTEXT_PROTOCOL_NAME_HASH(ID, NAME) irtextHash(NAME),
+const uint32_t kAllProtocolNameHashes[] PROGMEM = {
+    IRTEXT_PROTOCOL_NAMES(IRTEXT_PROTOCOL_NAME_HASH)
+};
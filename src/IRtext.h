@@ -1,4 +1,4 @@
-// Copyright 2019-2022 - David Conran (@crankyoldgit)
+// Copyright 2019-2026 - David Conran (@crankyoldgit)
 // This header file is to be included in files **other than** 'IRtext.cpp'.
 //
 // WARNING: Do not edit this file! This file is automatically generated by
@@ -7,6 +7,7 @@
 #ifndef IRTEXT_H_
 #define IRTEXT_H_
 
+#include <stdint.h>
 #include "i18n.h"
 
 // Constant text to be shared across all object files.
@@ -22,7 +23,269 @@ class __FlashStringHelper;
 #define IRTEXT_CONST_PTR(NAME) const char* const NAME
 #endif  // ESP8266
 
+/// Calculate a case-insensitive FNV-1a hash of some text at compile time.
+/// @note Must give the same result as `irutils::textHash()` does at run time.
+/// @param[in] str The text.
+/// @param[in] hash The hash so far.
+/// @return The hash value.
+constexpr uint32_t irtextHash(const char *str,
+                              const uint32_t hash = 2166136261UL) {
+  return *str ? irtextHash(str + 1,
+                           (hash ^ (uint8_t)((*str >= 'A' && *str <= 'Z') ?
+                                             *str + ('a' - 'A') : *str)) *
+                           16777619UL)
+              : hash;
+}
+
+#if _IR_LOCALE_POOL_
+// The strings are in a pool of several locales, so they are looked up.
+#include "IRtext_pool.h"
+#ifdef ESP8266
+#define IRTEXT_POOL_PTR const __FlashStringHelper*
+#else  // ESP8266
+#define IRTEXT_POOL_PTR const char*
+#endif  // ESP8266
+IRTEXT_POOL_PTR irtextPoolStr(const uint16_t id);
+bool irtextSetLocale(const uint8_t locale);
+bool irtextSetLocale(const char *name);
+uint8_t irtextGetLocale(void);
+IRTEXT_POOL_PTR irtextLocaleName(const uint8_t locale);
+#endif  // _IR_LOCALE_POOL_
+
 extern const char kTimeSep;
+extern const uint16_t kAllProtocolNameOffsets[];
+extern const uint32_t kAllProtocolNameHashes[];
+#if _IR_LOCALE_POOL_
+#define k0Str irtextPoolStr(k0StrId)
+#define k10CHeatStr irtextPoolStr(k10CHeatStrId)
+#define k122lzfStr irtextPoolStr(k122lzfStrId)
+#define k1Str irtextPoolStr(k1StrId)
+#define k3DStr irtextPoolStr(k3DStrId)
+#define k6thSenseStr irtextPoolStr(k6thSenseStrId)
+#define k8CHeatStr irtextPoolStr(k8CHeatStrId)
+#define kA705Str irtextPoolStr(kA705StrId)
+#define kA903Str irtextPoolStr(kA903StrId)
+#define kA907Str irtextPoolStr(kA907StrId)
+#define kAbsenseDetectStr irtextPoolStr(kAbsenseDetectStrId)
+#define kAirFlowStr irtextPoolStr(kAirFlowStrId)
+#define kAkb73757604Str irtextPoolStr(kAkb73757604StrId)
+#define kAkb74955603Str irtextPoolStr(kAkb74955603StrId)
+#define kAkb75215403Str irtextPoolStr(kAkb75215403StrId)
+#define kArdb1Str irtextPoolStr(kArdb1StrId)
+#define kArgoWrem2Str irtextPoolStr(kArgoWrem2StrId)
+#define kArgoWrem3Str irtextPoolStr(kArgoWrem3StrId)
+#define kArjw2Str irtextPoolStr(kArjw2StrId)
+#define kArrah2eStr irtextPoolStr(kArrah2eStrId)
+#define kArreb1eStr irtextPoolStr(kArreb1eStrId)
+#define kArrew4eStr irtextPoolStr(kArrew4eStrId)
+#define kArry4Str irtextPoolStr(kArry4StrId)
+#define kAutoStr irtextPoolStr(kAutoStrId)
+#define kAutomaticStr irtextPoolStr(kAutomaticStrId)
+#define kBeepStr irtextPoolStr(kBeepStrId)
+#define kBitsStr irtextPoolStr(kBitsStrId)
+#define kBottomStr irtextPoolStr(kBottomStrId)
+#define kBreezeStr irtextPoolStr(kBreezeStrId)
+#define kButtonStr irtextPoolStr(kButtonStrId)
+#define kCancelStr irtextPoolStr(kCancelStrId)
+#define kCeilingStr irtextPoolStr(kCeilingStrId)
+#define kCelsiusFahrenheitStr irtextPoolStr(kCelsiusFahrenheitStrId)
+#define kCelsiusStr irtextPoolStr(kCelsiusStrId)
+#define kCentreStr irtextPoolStr(kCentreStrId)
+#define kChStr irtextPoolStr(kChStrId)
+#define kChangeStr irtextPoolStr(kChangeStrId)
+#define kCirculateStr irtextPoolStr(kCirculateStrId)
+#define kCkpStr irtextPoolStr(kCkpStrId)
+#define kCleanStr irtextPoolStr(kCleanStrId)
+#define kClockStr irtextPoolStr(kClockStrId)
+#define kCodeStr irtextPoolStr(kCodeStrId)
+#define kColonSpaceStr irtextPoolStr(kColonSpaceStrId)
+#define kComfortStr irtextPoolStr(kComfortStrId)
+#define kCommaSpaceStr irtextPoolStr(kCommaSpaceStrId)
+#define kCommandStr irtextPoolStr(kCommandStrId)
+#define kConfigCommandStr irtextPoolStr(kConfigCommandStrId)
+#define kControlCommandStr irtextPoolStr(kControlCommandStrId)
+#define kCoolStr irtextPoolStr(kCoolStrId)
+#define kCoolingStr irtextPoolStr(kCoolingStrId)
+#define kDashStr irtextPoolStr(kDashStrId)
+#define kDayStr irtextPoolStr(kDayStrId)
+#define kDaysStr irtextPoolStr(kDaysStrId)
+#define kDehumidifyStr irtextPoolStr(kDehumidifyStrId)
+#define kDg11j104Str irtextPoolStr(kDg11j104StrId)
+#define kDg11j13aStr irtextPoolStr(kDg11j13aStrId)
+#define kDg11j191Str irtextPoolStr(kDg11j191StrId)
+#define kDirectIndirectModeStr irtextPoolStr(kDirectIndirectModeStrId)
+#define kDirectStr irtextPoolStr(kDirectStrId)
+#define kDisplayTempStr irtextPoolStr(kDisplayTempStrId)
+#define kDkeStr irtextPoolStr(kDkeStrId)
+#define kDownStr irtextPoolStr(kDownStrId)
+#define kDryStr irtextPoolStr(kDryStrId)
+#define kDryingStr irtextPoolStr(kDryingStrId)
+#define kEconoStr irtextPoolStr(kEconoStrId)
+#define kEconoToggleStr irtextPoolStr(kEconoToggleStrId)
+#define kEyeAutoStr irtextPoolStr(kEyeAutoStrId)
+#define kEyeStr irtextPoolStr(kEyeStrId)
+#define kFalseStr irtextPoolStr(kFalseStrId)
+#define kFanOnlyNoSpaceStr irtextPoolStr(kFanOnlyNoSpaceStrId)
+#define kFanOnlyStr irtextPoolStr(kFanOnlyStrId)
+#define kFanOnlyWithSpaceStr irtextPoolStr(kFanOnlyWithSpaceStrId)
+#define kFanStr irtextPoolStr(kFanStrId)
+#define kFan_OnlyStr irtextPoolStr(kFan_OnlyStrId)
+#define kFastStr irtextPoolStr(kFastStrId)
+#define kFilterStr irtextPoolStr(kFilterStrId)
+#define kFixedStr irtextPoolStr(kFixedStrId)
+#define kFollowStr irtextPoolStr(kFollowStrId)
+#define kFreshStr irtextPoolStr(kFreshStrId)
+#define kGe6711ar2853mStr irtextPoolStr(kGe6711ar2853mStrId)
+#define kGz055be1Str irtextPoolStr(kGz055be1StrId)
+#define kHealthStr irtextPoolStr(kHealthStrId)
+#define kHeatStr irtextPoolStr(kHeatStrId)
+#define kHeatingStr irtextPoolStr(kHeatingStrId)
+#define kHiStr irtextPoolStr(kHiStrId)
+#define kHighStr irtextPoolStr(kHighStrId)
+#define kHighestStr irtextPoolStr(kHighestStrId)
+#define kHoldStr irtextPoolStr(kHoldStrId)
+#define kHourStr irtextPoolStr(kHourStrId)
+#define kHoursStr irtextPoolStr(kHoursStrId)
+#define kHumidStr irtextPoolStr(kHumidStrId)
+#define kIFeelReportStr irtextPoolStr(kIFeelReportStrId)
+#define kIFeelStr irtextPoolStr(kIFeelStrId)
+#define kISeeStr irtextPoolStr(kISeeStrId)
+#define kIdStr irtextPoolStr(kIdStrId)
+#define kIndirectStr irtextPoolStr(kIndirectStrId)
+#define kInsideStr irtextPoolStr(kInsideStrId)
+#define kIonStr irtextPoolStr(kIonStrId)
+#define kJkeStr irtextPoolStr(kJkeStrId)
+#define kKeyStr irtextPoolStr(kKeyStrId)
+#define kKkg29ac1Str irtextPoolStr(kKkg29ac1StrId)
+#define kKkg9ac1Str irtextPoolStr(kKkg9ac1StrId)
+#define kLastStr irtextPoolStr(kLastStrId)
+#define kLeftMaxNoSpaceStr irtextPoolStr(kLeftMaxNoSpaceStrId)
+#define kLeftMaxStr irtextPoolStr(kLeftMaxStrId)
+#define kLeftStr irtextPoolStr(kLeftStrId)
+#define kLg6711a20083vStr irtextPoolStr(kLg6711a20083vStrId)
+#define kLightStr irtextPoolStr(kLightStrId)
+#define kLightToggleStr irtextPoolStr(kLightToggleStrId)
+#define kLkeStr irtextPoolStr(kLkeStrId)
+#define kLoStr irtextPoolStr(kLoStrId)
+#define kLockStr irtextPoolStr(kLockStrId)
+#define kLoudStr irtextPoolStr(kLoudStrId)
+#define kLowStr irtextPoolStr(kLowStrId)
+#define kLowerStr irtextPoolStr(kLowerStrId)
+#define kLowestStr irtextPoolStr(kLowestStrId)
+#define kManualStr irtextPoolStr(kManualStrId)
+#define kMaxLeftNoSpaceStr irtextPoolStr(kMaxLeftNoSpaceStrId)
+#define kMaxLeftStr irtextPoolStr(kMaxLeftStrId)
+#define kMaxRightNoSpaceStr irtextPoolStr(kMaxRightNoSpaceStrId)
+#define kMaxRightStr irtextPoolStr(kMaxRightStrId)
+#define kMaxStr irtextPoolStr(kMaxStrId)
+#define kMaximumStr irtextPoolStr(kMaximumStrId)
+#define kMedHighStr irtextPoolStr(kMedHighStrId)
+#define kMedStr irtextPoolStr(kMedStrId)
+#define kMediumStr irtextPoolStr(kMediumStrId)
+#define kMidStr irtextPoolStr(kMidStrId)
+#define kMiddleStr irtextPoolStr(kMiddleStrId)
+#define kMinStr irtextPoolStr(kMinStrId)
+#define kMinimumStr irtextPoolStr(kMinimumStrId)
+#define kMinuteStr irtextPoolStr(kMinuteStrId)
+#define kMinutesStr irtextPoolStr(kMinutesStrId)
+#define kModeStr irtextPoolStr(kModeStrId)
+#define kModelStr irtextPoolStr(kModelStrId)
+#define kMouldStr irtextPoolStr(kMouldStrId)
+#define kMoveStr irtextPoolStr(kMoveStrId)
+#define kNAStr irtextPoolStr(kNAStrId)
+#define kNightStr irtextPoolStr(kNightStrId)
+#define kNkeStr irtextPoolStr(kNkeStrId)
+#define kNoStr irtextPoolStr(kNoStrId)
+#define kNowStr irtextPoolStr(kNowStrId)
+#define kOffStr irtextPoolStr(kOffStrId)
+#define kOffTimerStr irtextPoolStr(kOffTimerStrId)
+#define kOnStr irtextPoolStr(kOnStrId)
+#define kOnTimerStr irtextPoolStr(kOnTimerStrId)
+#define kOutsideQuietStr irtextPoolStr(kOutsideQuietStrId)
+#define kOutsideStr irtextPoolStr(kOutsideStrId)
+#define kPanasonicCkpStr irtextPoolStr(kPanasonicCkpStrId)
+#define kPanasonicDkeStr irtextPoolStr(kPanasonicDkeStrId)
+#define kPanasonicJkeStr irtextPoolStr(kPanasonicJkeStrId)
+#define kPanasonicLkeStr irtextPoolStr(kPanasonicLkeStrId)
+#define kPanasonicNkeStr irtextPoolStr(kPanasonicNkeStrId)
+#define kPanasonicPkrStr irtextPoolStr(kPanasonicPkrStrId)
+#define kPanasonicRkrStr irtextPoolStr(kPanasonicRkrStrId)
+#define kPkrStr irtextPoolStr(kPkrStrId)
+#define kPowerButtonStr irtextPoolStr(kPowerButtonStrId)
+#define kPowerStr irtextPoolStr(kPowerStrId)
+#define kPowerToggleStr irtextPoolStr(kPowerToggleStrId)
+#define kPowerfulStr irtextPoolStr(kPowerfulStrId)
+#define kPreviousPowerStr irtextPoolStr(kPreviousPowerStrId)
+#define kProtocolStr irtextPoolStr(kProtocolStrId)
+#define kPurifyStr irtextPoolStr(kPurifyStrId)
+#define kQuietStr irtextPoolStr(kQuietStrId)
+#define kRecycleStr irtextPoolStr(kRecycleStrId)
+#define kRepeatStr irtextPoolStr(kRepeatStrId)
+#define kRightMaxNoSpaceStr irtextPoolStr(kRightMaxNoSpaceStrId)
+#define kRightMaxStr irtextPoolStr(kRightMaxStrId)
+#define kRightStr irtextPoolStr(kRightStrId)
+#define kRkrStr irtextPoolStr(kRkrStrId)
+#define kRlt0541htaaStr irtextPoolStr(kRlt0541htaaStrId)
+#define kRlt0541htabStr irtextPoolStr(kRlt0541htabStrId)
+#define kRoomStr irtextPoolStr(kRoomStrId)
+#define kSaveStr irtextPoolStr(kSaveStrId)
+#define kScheduleStr irtextPoolStr(kScheduleStrId)
+#define kSecondStr irtextPoolStr(kSecondStrId)
+#define kSecondsStr irtextPoolStr(kSecondsStrId)
+#define kSensorStr irtextPoolStr(kSensorStrId)
+#define kSensorTempStr irtextPoolStr(kSensorTempStrId)
+#define kSetStr irtextPoolStr(kSetStrId)
+#define kSetTimerCommandStr irtextPoolStr(kSetTimerCommandStrId)
+#define kSilentStr irtextPoolStr(kSilentStrId)
+#define kSleepStr irtextPoolStr(kSleepStrId)
+#define kSleepTimerStr irtextPoolStr(kSleepTimerStrId)
+#define kSlowStr irtextPoolStr(kSlowStrId)
+#define kSpaceLBraceStr irtextPoolStr(kSpaceLBraceStrId)
+#define kSpecialStr irtextPoolStr(kSpecialStrId)
+#define kStartStr irtextPoolStr(kStartStrId)
+#define kStepStr irtextPoolStr(kStepStrId)
+#define kStopStr irtextPoolStr(kStopStrId)
+#define kSuperStr irtextPoolStr(kSuperStrId)
+#define kSwingHStr irtextPoolStr(kSwingHStrId)
+#define kSwingStr irtextPoolStr(kSwingStrId)
+#define kSwingVModeStr irtextPoolStr(kSwingVModeStrId)
+#define kSwingVStr irtextPoolStr(kSwingVStrId)
+#define kSwingVToggleStr irtextPoolStr(kSwingVToggleStrId)
+#define kTac09chsdStr irtextPoolStr(kTac09chsdStrId)
+#define kTempDownStr irtextPoolStr(kTempDownStrId)
+#define kTempStr irtextPoolStr(kTempStrId)
+#define kTempUpStr irtextPoolStr(kTempUpStrId)
+#define kThreeLetterDayOfWeekStr irtextPoolStr(kThreeLetterDayOfWeekStrId)
+#define kTimerActiveDaysStr irtextPoolStr(kTimerActiveDaysStrId)
+#define kTimerModeStr irtextPoolStr(kTimerModeStrId)
+#define kTimerStr irtextPoolStr(kTimerStrId)
+#define kToggleStr irtextPoolStr(kToggleStrId)
+#define kTopStr irtextPoolStr(kTopStrId)
+#define kToshibaGenericRemoteAStr irtextPoolStr(kToshibaGenericRemoteAStrId)
+#define kToshibaGenericRemoteBStr irtextPoolStr(kToshibaGenericRemoteBStrId)
+#define kTrueStr irtextPoolStr(kTrueStrId)
+#define kTurboStr irtextPoolStr(kTurboStrId)
+#define kTurboToggleStr irtextPoolStr(kTurboToggleStrId)
+#define kTypeStr irtextPoolStr(kTypeStrId)
+#define kUnknownStr irtextPoolStr(kUnknownStrId)
+#define kUpStr irtextPoolStr(kUpStrId)
+#define kUpperMiddleStr irtextPoolStr(kUpperMiddleStrId)
+#define kUpperStr irtextPoolStr(kUpperStrId)
+#define kV9014557AStr irtextPoolStr(kV9014557AStrId)
+#define kV9014557BStr irtextPoolStr(kV9014557BStrId)
+#define kValueStr irtextPoolStr(kValueStrId)
+#define kVaneStr irtextPoolStr(kVaneStrId)
+#define kWallStr irtextPoolStr(kWallStrId)
+#define kWeeklyTimerStr irtextPoolStr(kWeeklyTimerStrId)
+#define kWideStr irtextPoolStr(kWideStrId)
+#define kWifiStr irtextPoolStr(kWifiStrId)
+#define kXFanStr irtextPoolStr(kXFanStrId)
+#define kYaw1fStr irtextPoolStr(kYaw1fStrId)
+#define kYbofbStr irtextPoolStr(kYbofbStrId)
+#define kYesStr irtextPoolStr(kYesStrId)
+#define kYx1fsfStr irtextPoolStr(kYx1fsfStrId)
+#define kZoneFollowStr irtextPoolStr(kZoneFollowStrId)
+#else  // _IR_LOCALE_POOL_
 extern IRTEXT_CONST_PTR(k0Str);
 extern IRTEXT_CONST_PTR(k10CHeatStr);
 extern IRTEXT_CONST_PTR(k122lzfStr);
@@ -58,8 +321,8 @@ extern IRTEXT_CONST_PTR(kCeilingStr);
 extern IRTEXT_CONST_PTR(kCelsiusFahrenheitStr);
 extern IRTEXT_CONST_PTR(kCelsiusStr);
 extern IRTEXT_CONST_PTR(kCentreStr);
-extern IRTEXT_CONST_PTR(kChangeStr);
 extern IRTEXT_CONST_PTR(kChStr);
+extern IRTEXT_CONST_PTR(kChangeStr);
 extern IRTEXT_CONST_PTR(kCirculateStr);
 extern IRTEXT_CONST_PTR(kCkpStr);
 extern IRTEXT_CONST_PTR(kCleanStr);
@@ -199,10 +462,10 @@ extern IRTEXT_CONST_PTR(kSaveStr);
 extern IRTEXT_CONST_PTR(kScheduleStr);
 extern IRTEXT_CONST_PTR(kSecondStr);
 extern IRTEXT_CONST_PTR(kSecondsStr);
-extern IRTEXT_CONST_PTR(kSensorReportStr);
 extern IRTEXT_CONST_PTR(kSensorStr);
 extern IRTEXT_CONST_PTR(kSensorTempStr);
 extern IRTEXT_CONST_PTR(kSetStr);
+extern IRTEXT_CONST_PTR(kSetTimerCommandStr);
 extern IRTEXT_CONST_PTR(kSilentStr);
 extern IRTEXT_CONST_PTR(kSleepStr);
 extern IRTEXT_CONST_PTR(kSleepTimerStr);
@@ -225,7 +488,6 @@ extern IRTEXT_CONST_PTR(kTempUpStr);
 extern IRTEXT_CONST_PTR(kThreeLetterDayOfWeekStr);
 extern IRTEXT_CONST_PTR(kTimerActiveDaysStr);
 extern IRTEXT_CONST_PTR(kTimerModeStr);
-extern IRTEXT_CONST_PTR(kSetTimerCommandStr);
 extern IRTEXT_CONST_PTR(kTimerStr);
 extern IRTEXT_CONST_PTR(kToggleStr);
 extern IRTEXT_CONST_PTR(kTopStr);
@@ -237,11 +499,11 @@ extern IRTEXT_CONST_PTR(kTurboToggleStr);
 extern IRTEXT_CONST_PTR(kTypeStr);
 extern IRTEXT_CONST_PTR(kUnknownStr);
 extern IRTEXT_CONST_PTR(kUpStr);
-extern IRTEXT_CONST_PTR(kUpperStr);
 extern IRTEXT_CONST_PTR(kUpperMiddleStr);
-extern IRTEXT_CONST_PTR(kValueStr);
+extern IRTEXT_CONST_PTR(kUpperStr);
 extern IRTEXT_CONST_PTR(kV9014557AStr);
 extern IRTEXT_CONST_PTR(kV9014557BStr);
+extern IRTEXT_CONST_PTR(kValueStr);
 extern IRTEXT_CONST_PTR(kVaneStr);
 extern IRTEXT_CONST_PTR(kWallStr);
 extern IRTEXT_CONST_PTR(kWeeklyTimerStr);
@@ -253,6 +515,7 @@ extern IRTEXT_CONST_PTR(kYbofbStr);
 extern IRTEXT_CONST_PTR(kYesStr);
 extern IRTEXT_CONST_PTR(kYx1fsfStr);
 extern IRTEXT_CONST_PTR(kZoneFollowStr);
+#endif  // _IR_LOCALE_POOL_
 extern IRTEXT_CONST_PTR(kAllProtocolNamesStr);
 
 #endif  // IRTEXT_H_
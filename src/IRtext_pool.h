@@ -0,0 +1,263 @@
+// Copyright 2026 IRremoteESP8266 project and others
+// The ids of the IRtext strings in the runtime switchable locale string pool.
+//
+// WARNING: Do not edit this file! This file is automatically generated by
+//          '../tools/generate_irtext_pool.py'.
+// Locales: en-AU en-US de-DE es-ES fr-FR it-IT
+
+#ifndef IRTEXT_POOL_H_
+#define IRTEXT_POOL_H_
+
+#include <stdint.h>
+
+/// An id for each IRtext string. e.g. `kPowerStrId` for `kPowerStr`.
+enum irtext_id_t {
+  kUnknownStrId,
+  kProtocolStrId,
+  kPowerStrId,
+  kOnStrId,
+  kOffStrId,
+  k1StrId,
+  k0StrId,
+  kModeStrId,
+  kToggleStrId,
+  kTurboStrId,
+  kSuperStrId,
+  kSleepStrId,
+  kLightStrId,
+  kPowerfulStrId,
+  kQuietStrId,
+  kEconoStrId,
+  kSwingStrId,
+  kSwingHStrId,
+  kSwingVStrId,
+  kBeepStrId,
+  kZoneFollowStrId,
+  kFixedStrId,
+  kMouldStrId,
+  kCleanStrId,
+  kPurifyStrId,
+  kTimerStrId,
+  kOnTimerStrId,
+  kOffTimerStrId,
+  kTimerModeStrId,
+  kClockStrId,
+  kCommandStrId,
+  kConfigCommandStrId,
+  kControlCommandStrId,
+  kXFanStrId,
+  kHealthStrId,
+  kModelStrId,
+  kTempStrId,
+  kIFeelReportStrId,
+  kIFeelStrId,
+  kHumidStrId,
+  kSaveStrId,
+  kEyeStrId,
+  kFollowStrId,
+  kIonStrId,
+  kFreshStrId,
+  kHoldStrId,
+  kButtonStrId,
+  k8CHeatStrId,
+  k10CHeatStrId,
+  kISeeStrId,
+  kAbsenseDetectStrId,
+  kDirectIndirectModeStrId,
+  kDirectStrId,
+  kIndirectStrId,
+  kNightStrId,
+  kSilentStrId,
+  kFilterStrId,
+  k3DStrId,
+  kCelsiusStrId,
+  kCelsiusFahrenheitStrId,
+  kTempUpStrId,
+  kTempDownStrId,
+  kStartStrId,
+  kStopStrId,
+  kMoveStrId,
+  kSetStrId,
+  kCancelStrId,
+  kUpStrId,
+  kDownStrId,
+  kChangeStrId,
+  kComfortStrId,
+  kSensorStrId,
+  kWeeklyTimerStrId,
+  kWifiStrId,
+  kLastStrId,
+  kFastStrId,
+  kSlowStrId,
+  kAirFlowStrId,
+  kStepStrId,
+  kNAStrId,
+  kInsideStrId,
+  kOutsideStrId,
+  kLoudStrId,
+  kLowerStrId,
+  kUpperStrId,
+  kUpperMiddleStrId,
+  kBreezeStrId,
+  kCirculateStrId,
+  kCeilingStrId,
+  kWallStrId,
+  kRoomStrId,
+  k6thSenseStrId,
+  kTypeStrId,
+  kSpecialStrId,
+  kIdStrId,
+  kVaneStrId,
+  kLockStrId,
+  kAutoStrId,
+  kAutomaticStrId,
+  kManualStrId,
+  kCoolStrId,
+  kCoolingStrId,
+  kHeatStrId,
+  kHeatingStrId,
+  kDryStrId,
+  kDryingStrId,
+  kDehumidifyStrId,
+  kFanStrId,
+  kFanOnlyStrId,
+  kFan_OnlyStrId,
+  kFanOnlyWithSpaceStrId,
+  kFanOnlyNoSpaceStrId,
+  kRecycleStrId,
+  kMaxStrId,
+  kMaximumStrId,
+  kMinStrId,
+  kMinimumStrId,
+  kMedHighStrId,
+  kMedStrId,
+  kMediumStrId,
+  kHighestStrId,
+  kHighStrId,
+  kHiStrId,
+  kMidStrId,
+  kMiddleStrId,
+  kLowStrId,
+  kLoStrId,
+  kLowestStrId,
+  kMaxRightStrId,
+  kMaxRightNoSpaceStrId,
+  kRightMaxStrId,
+  kRightMaxNoSpaceStrId,
+  kRightStrId,
+  kLeftStrId,
+  kMaxLeftStrId,
+  kMaxLeftNoSpaceStrId,
+  kLeftMaxStrId,
+  kLeftMaxNoSpaceStrId,
+  kWideStrId,
+  kCentreStrId,
+  kTopStrId,
+  kBottomStrId,
+  kEconoToggleStrId,
+  kEyeAutoStrId,
+  kLightToggleStrId,
+  kOutsideQuietStrId,
+  kPowerToggleStrId,
+  kPowerButtonStrId,
+  kPreviousPowerStrId,
+  kDisplayTempStrId,
+  kSensorTempStrId,
+  kSleepTimerStrId,
+  kSwingVModeStrId,
+  kSwingVToggleStrId,
+  kTurboToggleStrId,
+  kSetTimerCommandStrId,
+  kScheduleStrId,
+  kChStrId,
+  kTimerActiveDaysStrId,
+  kKeyStrId,
+  kValueStrId,
+  kSpaceLBraceStrId,
+  kCommaSpaceStrId,
+  kColonSpaceStrId,
+  kDashStrId,
+  kDayStrId,
+  kDaysStrId,
+  kHourStrId,
+  kHoursStrId,
+  kMinuteStrId,
+  kMinutesStrId,
+  kSecondStrId,
+  kSecondsStrId,
+  kNowStrId,
+  kThreeLetterDayOfWeekStrId,
+  kYesStrId,
+  kNoStrId,
+  kTrueStrId,
+  kFalseStrId,
+  kRepeatStrId,
+  kCodeStrId,
+  kBitsStrId,
+  kYaw1fStrId,
+  kYbofbStrId,
+  kYx1fsfStrId,
+  kV9014557AStrId,
+  kV9014557BStrId,
+  kRlt0541htaaStrId,
+  kRlt0541htabStrId,
+  kArrah2eStrId,
+  kArdb1StrId,
+  kArreb1eStrId,
+  kArjw2StrId,
+  kArry4StrId,
+  kArrew4eStrId,
+  kGe6711ar2853mStrId,
+  kAkb75215403StrId,
+  kAkb74955603StrId,
+  kAkb73757604StrId,
+  kLg6711a20083vStrId,
+  kKkg9ac1StrId,
+  kKkg29ac1StrId,
+  kLkeStrId,
+  kNkeStrId,
+  kDkeStrId,
+  kPkrStrId,
+  kJkeStrId,
+  kCkpStrId,
+  kRkrStrId,
+  kPanasonicLkeStrId,
+  kPanasonicNkeStrId,
+  kPanasonicDkeStrId,
+  kPanasonicPkrStrId,
+  kPanasonicJkeStrId,
+  kPanasonicCkpStrId,
+  kPanasonicRkrStrId,
+  kA907StrId,
+  kA705StrId,
+  kA903StrId,
+  kTac09chsdStrId,
+  kGz055be1StrId,
+  k122lzfStrId,
+  kDg11j13aStrId,
+  kDg11j104StrId,
+  kDg11j191StrId,
+  kArgoWrem2StrId,
+  kArgoWrem3StrId,
+  kToshibaGenericRemoteAStrId,
+  kToshibaGenericRemoteBStrId,
+  kIrTextPoolEntries  ///< Nr. of strings in the pool.
+};
+
+/// Nr. of locales in the pool.
+const uint8_t kIrTextPoolLocales = 6;
+
+/// Find a locale in the pool at compile time. e.g. For `_IR_LOCALE_`
+/// @param[in] name The name of the locale. e.g. "de-DE"
+/// @return The index of the locale, or `kIrTextPoolLocales` if it isn't there.
+constexpr uint8_t irtextPoolLocale(const char *name) {
+  return irtextHash(name) == irtextHash("en-AU") ? 0 :
+         irtextHash(name) == irtextHash("en-US") ? 1 :
+         irtextHash(name) == irtextHash("de-DE") ? 2 :
+         irtextHash(name) == irtextHash("es-ES") ? 3 :
+         irtextHash(name) == irtextHash("fr-FR") ? 4 :
+         irtextHash(name) == irtextHash("it-IT") ? 5 :
+         kIrTextPoolLocales;
+}
+
+#endif  // IRTEXT_POOL_H_
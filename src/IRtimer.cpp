@@ -9,6 +9,9 @@
 // Used to help simulate elapsed time in unit tests.
 uint32_t _IRtimer_unittest_now = 0;
 uint32_t _TimerMs_unittest_now = 0;
+// Used to help simulate the cost of reading the system clock in unit tests.
+uint32_t _IRtimer_unittest_reads = 0;
+uint32_t _IRtimer_unittest_read_cost = 0;
 #endif  // UNIT_TEST
 
 /// Class constructor.
@@ -19,6 +22,8 @@ void IRtimer::reset() {
 #ifndef UNIT_TEST
   start = micros();
 #else
+  _IRtimer_unittest_reads++;
+  _IRtimer_unittest_now += _IRtimer_unittest_read_cost;
   start = _IRtimer_unittest_now;
 #endif
 }
@@ -29,6 +34,8 @@ uint32_t IRtimer::elapsed() {
 #ifndef UNIT_TEST
   uint32_t now = micros();
 #else
+  _IRtimer_unittest_reads++;
+  _IRtimer_unittest_now += _IRtimer_unittest_read_cost;
   uint32_t now = _IRtimer_unittest_now;
 #endif
   if (start <= now)      // Check if the system timer has wrapped.
@@ -74,5 +81,5 @@ uint32_t TimerMs::elapsed() {
 /// @param[in] msecs Nr. of mSeconds to be added.
 /// @note Only used in unit testing.
 #ifdef UNIT_TEST
-void TimerMs::add(uint32_t msecs) { _IRtimer_unittest_now += msecs; }
+void TimerMs::add(uint32_t msecs) { _TimerMs_unittest_now += msecs; }
 #endif  // UNIT_TEST
@@ -28,16 +28,38 @@
 #define STRCASECMP strcasecmp
 #endif  // ESP8266
 #endif  // STRCASECMP
-#ifndef STRLEN
-#if defined(ESP8266)
-#define STRLEN(PTR) strlen_P(PTR)
-#else  // ESP8266
-#define STRLEN(PTR) strlen(PTR)
-#endif  // ESP8266
-#endif  // STRLEN
 #ifndef FPSTR
 #define FPSTR(X) X
 #endif  // FPSTR
+#ifndef PROGMEM
+#define PROGMEM  // Pretend we have the PROGMEM macro even if we really don't.
+#endif  // PROGMEM
+#ifndef pgm_read_byte
+#define pgm_read_byte(ADDR) (*reinterpret_cast<const uint8_t *>(ADDR))
+#endif  // pgm_read_byte
+#ifndef pgm_read_word
+#define pgm_read_word(ADDR) (*reinterpret_cast<const uint16_t *>(ADDR))
+#endif  // pgm_read_word
+#ifndef pgm_read_dword
+#define pgm_read_dword(ADDR) (*reinterpret_cast<const uint32_t *>(ADDR))
+#endif  // pgm_read_dword
+#ifndef pgm_read_ptr
+#define pgm_read_ptr(ADDR) (*reinterpret_cast<const void * const *>(ADDR))
+#endif  // pgm_read_ptr
+
+const uint8_t kProtocolNameMaxLength = 63;  ///< Longest name we can look up.
+
+#if IRUTILS_WORD_KERNELS
+/// Read 8 bytes as a word, from any alignment, in the CPU's native byte order.
+/// @param[in] ptr A ptr to the first byte.
+/// @return The bytes as a word.
+/// @note Only good for things that don't care about the order of the bytes.
+static inline uint64_t loadWord(const uint8_t * const ptr) {
+  uint64_t word;
+  memcpy(&word, ptr, sizeof(word));
+  return word;
+}
+#endif  // IRUTILS_WORD_KERNELS
 
 /// Reverse the order of the requested least significant nr. of bits.
 /// @param[in] input Bit pattern/integer to reverse.
@@ -47,6 +69,26 @@ uint64_t reverseBits(uint64_t input, uint16_t nbits) {
   if (nbits <= 1) return input;  // Reversing <= 1 bits makes no change at all.
   // Cap the nr. of bits to rotate to the max nr. of bits in the input.
   nbits = std::min(nbits, (uint16_t)(sizeof(input) * 8));
+#if IRUTILS_WORD_KERNELS
+  // Reverse the whole word by swapping ever smaller groups of bits, then shift
+  // the ones we wanted back down to the bottom.
+  uint64_t output = input;
+  output = ((output >> 1) & 0x5555555555555555ULL) |
+      ((output & 0x5555555555555555ULL) << 1);
+  output = ((output >> 2) & 0x3333333333333333ULL) |
+      ((output & 0x3333333333333333ULL) << 2);
+  output = ((output >> 4) & 0x0F0F0F0F0F0F0F0FULL) |
+      ((output & 0x0F0F0F0F0F0F0F0FULL) << 4);
+  output = ((output >> 8) & 0x00FF00FF00FF00FFULL) |
+      ((output & 0x00FF00FF00FF00FFULL) << 8);
+  output = ((output >> 16) & 0x0000FFFF0000FFFFULL) |
+      ((output & 0x0000FFFF0000FFFFULL) << 16);
+  output = (output >> 32) | (output << 32);
+  output >>= 64 - nbits;
+  if (nbits == 64) return output;
+  // Keep any unreversed bits at the top.
+  return ((input >> nbits) << nbits) | output;
+#else  // IRUTILS_WORD_KERNELS
   uint64_t output = 0;
   for (uint16_t i = 0; i < nbits; i++) {
     output <<= 1;
@@ -55,6 +97,74 @@ uint64_t reverseBits(uint64_t input, uint16_t nbits) {
   }
   // Merge any remaining unreversed bits back to the top of the reversed bits.
   return (input << nbits) | output;
+#endif  // IRUTILS_WORD_KERNELS
+}
+
+/// Every pair of decimal digits, so we can do two digits per division.
+static const char kDigitPairs[] PROGMEM =
+    "000102030405060708091011121314151617181920212223242526272829"
+    "303132333435363738394041424344454647484950515253545556575859"
+    "606162636465666768697071727374757677787980818283848586878889"
+    "90919293949596979899";
+/// Digits for any base up to 36.
+static const char kDigits[] PROGMEM = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+/// Convert a uint64_t (unsigned long long) to text in a caller's buffer.
+/// The text is written backwards from the end of the buffer, so there is no
+/// need to work out how long it will be first, or to move it afterwards.
+/// @param[in] input The value to convert.
+/// @param[in] base The output base. Invalid bases are treated as base 10.
+/// @param[out] end A ptr to just past the end of the buffer. The buffer needs
+///   room for up to `kUint64TextSize` chars before `end`, including a NUL.
+/// @return A ptr to the NUL terminated text, somewhere in the buffer.
+/// @note Decimal is done two digits at a time, and 32-bit maths is used once
+///   the value fits. Powers of two are done with shifts.
+char *uint64ToText(uint64_t input, uint8_t base, char *end) {
+  if (base < 2 || base > 36) base = 10;
+  char *ptr = end;
+  *--ptr = '\0';
+  if (base == 10) {
+    while (input > UINT32_MAX) {  // Only use slow 64-bit division if needed.
+      const uint8_t pair = input % 100;
+      input /= 100;
+      *--ptr = pgm_read_byte(kDigitPairs + pair * 2 + 1);
+      *--ptr = pgm_read_byte(kDigitPairs + pair * 2);
+    }
+    uint32_t value = input;
+    while (value >= 100) {
+      const uint8_t pair = value % 100;
+      value /= 100;
+      *--ptr = pgm_read_byte(kDigitPairs + pair * 2 + 1);
+      *--ptr = pgm_read_byte(kDigitPairs + pair * 2);
+    }
+    *--ptr = pgm_read_byte(kDigitPairs + value * 2 + 1);
+    if (value >= 10) *--ptr = pgm_read_byte(kDigitPairs + value * 2);
+  } else if ((base & (base - 1)) == 0) {  // A power of two. e.g. Hexadecimal.
+    const uint8_t shift = __builtin_ctz(base);
+    do {
+      *--ptr = pgm_read_byte(kDigits + (input & (base - 1)));
+      input >>= shift;
+    } while (input);
+  } else {
+    do {
+      *--ptr = pgm_read_byte(kDigits + input % base);
+      input /= base;
+    } while (input);
+  }
+  return ptr;
+}
+
+/// Convert a int64_t (signed long long) to text in a caller's buffer.
+/// Like `uint64ToText()`, but with a leading '-' if it is negative.
+/// @param[in] input The value to convert.
+/// @param[in] base The output base. Invalid bases are treated as base 10.
+/// @param[out] end A ptr to just past the end of the buffer. The buffer needs
+///   room for up to `kInt64TextSize` chars before `end`, including a NUL.
+/// @return A ptr to the NUL terminated text, somewhere in the buffer.
+char *int64ToText(int64_t input, uint8_t base, char *end) {
+  char *ptr = uint64ToText(input < 0 ? -(uint64_t)input : input, base, end);
+  if (input < 0) *--ptr = '-';
+  return ptr;
 }
 
 /// Convert a uint64_t (unsigned long long) to a string.
@@ -62,31 +172,9 @@ uint64_t reverseBits(uint64_t input, uint16_t nbits) {
 /// @param[in] input The value to print
 /// @param[in] base The output base.
 /// @returns A String representation of the integer.
-/// @note Based on Arduino's Print::printNumber()
 String uint64ToString(uint64_t input, uint8_t base) {
-  String result = "";
-  // prevent issues if called with base <= 1
-  if (base < 2) base = 10;
-  // Check we have a base that we can actually print.
-  // i.e. [0-9A-Z] == 36
-  if (base > 36) base = 10;
-
-  // Reserve some string space to reduce fragmentation.
-  // 16 bytes should store a uint64 in hex text which is the likely worst case.
-  // 64 bytes would be the worst case (base 2).
-  result.reserve(16);
-
-  do {
-    char c = input % base;
-    input /= base;
-
-    if (c < 10)
-      c += '0';
-    else
-      c += 'A' - 10;
-    result = c + result;
-  } while (input);
-  return result;
+  char buffer[kUint64TextSize];
+  return String(uint64ToText(input, base, buffer + sizeof(buffer)));
 }
 
 /// Convert a int64_t (signed long long) to a string.
@@ -95,13 +183,133 @@ String uint64ToString(uint64_t input, uint8_t base) {
 /// @param[in] base The output base.
 /// @returns A String representation of the integer.
 String int64ToString(int64_t input, uint8_t base) {
-  if (input < 0) {
-    // Using String(kDashStr) to keep compatible with old arduino
-    // frameworks. Not needed with 3.0.2.
-    ///> @see https://github.com/crankyoldgit/IRremoteESP8266/issues/1639#issuecomment-944906016
-    return String(kDashStr) + uint64ToString(-input, base);
+  char buffer[kInt64TextSize];
+  return String(int64ToText(input, base, buffer + sizeof(buffer)));
+}
+
+/// Class constructor for writing to a char buffer.
+/// @param[out] buffer The buffer to write to.
+/// @param[in] size The size of the buffer, including room for the NUL.
+IRtextSink::IRtextSink(char *buffer, const size_t size)
+    : _buffer(buffer), _size(buffer != NULL ? size : 0), _str(NULL),
+#ifndef UNIT_TEST
+      _print(NULL),
+#endif  // UNIT_TEST
+      _length(0) {
+  if (_size) _buffer[0] = '\0';
+}
+
+/// Class constructor for appending to a String.
+/// @param[in,out] str A Ptr to the String to append to.
+IRtextSink::IRtextSink(String *str)
+    : _buffer(NULL), _size(0), _str(str),
+#ifndef UNIT_TEST
+      _print(NULL),
+#endif  // UNIT_TEST
+      _length(0) {}
+
+#ifndef UNIT_TEST
+/// Class constructor for writing to a Print object. e.g. Serial
+/// @param[in,out] print A Ptr to the Print object.
+IRtextSink::IRtextSink(Print *print)
+    : _buffer(NULL), _size(0), _str(NULL), _print(print), _length(0) {}
+#endif  // UNIT_TEST
+
+/// Add a character.
+/// @param[in] c The character to add.
+void IRtextSink::add(const char c) {
+  if (_buffer != NULL) {
+    if (_length + 1 < _size) {
+      _buffer[_length] = c;
+      _buffer[_length + 1] = '\0';
+    }
+  } else if (_str != NULL) {
+    *_str += c;
+#ifndef UNIT_TEST
+  } else if (_print != NULL) {
+    _print->write(c);
+#endif  // UNIT_TEST
+  }
+  _length++;
+}
+
+/// Add a NUL terminated string.
+/// @param[in] str A Ptr to the string to add.
+void IRtextSink::add(const char *str) {
+  if (str == NULL) return;
+  const size_t len = strlen(str);
+  if (_buffer != NULL) {
+    if (_length + 1 < _size) {
+      const size_t room = _size - 1 - _length;
+      const size_t copy = (len < room) ? len : room;
+      memcpy(_buffer + _length, str, copy);
+      _buffer[_length + copy] = '\0';
+    }
+  } else if (_str != NULL) {
+    *_str += str;
+#ifndef UNIT_TEST
+  } else if (_print != NULL) {
+    _print->print(str);
+#endif  // UNIT_TEST
   }
-  return uint64ToString(input, base);
+  _length += len;
+}
+
+#ifndef UNIT_TEST
+/// Add a string stored in flash memory. e.g. F("text")
+/// @param[in] str A Ptr to the flash string to add.
+void IRtextSink::add(const __FlashStringHelper *str) {
+#ifdef ESP8266
+  if (str == NULL) return;
+  PGM_P ptr = reinterpret_cast<PGM_P>(str);
+  if (_buffer != NULL) {
+    char c;
+    while ((c = pgm_read_byte(ptr++))) add(c);
+    return;
+  }
+  if (_str != NULL) *_str += str;
+  else if (_print != NULL) _print->print(str);
+  _length += strlen_P(ptr);
+#else  // ESP8266
+  add(reinterpret_cast<const char *>(str));
+#endif  // ESP8266
+}
+#endif  // UNIT_TEST
+
+/// Add the contents of a String.
+/// @param[in] str The String to add.
+void IRtextSink::add(const String &str) { add(str.c_str()); }
+
+/// Add an unsigned integer. Same format as uint64ToString().
+/// @param[in] value The value to add.
+/// @param[in] base The output base.
+/// @param[in] width The minimum nr. of characters to use.
+/// @param[in] pad The character to pad it out to `width` with.
+void IRtextSink::addUint(uint64_t value, uint8_t base, const uint8_t width,
+                         const char pad) {
+  char digits[kUint64TextSize];
+  const char *ptr = uint64ToText(value, base, digits + sizeof(digits));
+  for (uint8_t len = digits + sizeof(digits) - 1 - ptr; len < width; len++)
+    add(pad);
+  add(ptr);
+}
+
+/// Add a signed integer in decimal.
+/// @param[in] value The value to add.
+void IRtextSink::addInt(const int64_t value) {
+  char digits[kInt64TextSize];
+  add(int64ToText(value, 10, digits + sizeof(digits)));
+}
+
+/// Get the length of the text added so far. For a char buffer, this includes
+/// anything that didn't fit.
+/// @return The nr. of characters.
+size_t IRtextSink::length(void) const { return _length; }
+
+/// Did the text not fit in the char buffer?
+/// @return true, if the text was truncated. Otherwise, false.
+bool IRtextSink::overflowed(void) const {
+  return _buffer != NULL && _length >= _size;
 }
 
 #ifdef ARDUINO
@@ -110,24 +318,46 @@ String int64ToString(int64_t input, uint8_t base) {
 /// @param[in] input The value to print
 /// @param[in] base The output base.
 void serialPrintUint64(uint64_t input, uint8_t base) {
-  Serial.print(uint64ToString(input, base));
+  char buffer[kUint64TextSize];
+  Serial.print(uint64ToText(input, base, buffer + sizeof(buffer)));
 }
 #endif
 
+/// Find the name of a protocol, without walking all the names before it.
+/// @param[in] protocol A protocol nr. from 0 to kLastDecodeType.
+/// @return A Ptr to the name in `kAllProtocolNamesStr`. (May be in flash)
+static const char *protocolName(const uint16_t protocol) {
+  return reinterpret_cast<const char*>(kAllProtocolNamesStr) +
+      pgm_read_word(&kAllProtocolNameOffsets[protocol]);
+}
+
+/// Find the first protocol with a given name. (Case-insensitive)
+/// Only protocols with the same hash need their name compared.
+/// @param[in] str A C-style string containing a protocol name.
+/// @return A decode_type_t enum. (decode_type_t::UNKNOWN if no match.)
+static decode_type_t findProtocolName(const char * const str) {
+  const uint32_t hash = irutils::textHash(str);
+  for (uint16_t i = 0; i <= kLastDecodeType; i++)
+    if (pgm_read_dword(&kAllProtocolNameHashes[i]) == hash &&
+        !STRCASECMP(str, protocolName(i)))
+      return (decode_type_t)i;
+  return decode_type_t::UNKNOWN;
+}
+
 /// Convert a C-style string to a decode_type_t.
 /// @param[in] str A C-style string containing a protocol name or number.
 /// @return A decode_type_t enum. (decode_type_t::UNKNOWN if no match.)
 decode_type_t strToDecodeType(const char * const str) {
-  auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
-  uint16_t length = STRLEN(ptr);
-  for (uint16_t i = 0; length; i++) {
-    if (!STRCASECMP(str, ptr)) return (decode_type_t)i;
-    ptr += length + 1;
-    length = STRLEN(ptr);
-  }
-  // Handle integer values of the type by converting to a string and back again.
-  decode_type_t result = strToDecodeType(
-      typeToString((decode_type_t)atoi(str)).c_str());
+  decode_type_t result = findProtocolName(str);
+  if (result != decode_type_t::UNKNOWN) return result;
+  // Handle integer values of the type. i.e. Whichever protocol is first to
+  // have the same name as that protocol nr. (e.g. Unsupported ones are "?")
+  const int nr = atoi(str);
+  if (nr <= 0 || nr > kLastDecodeType) return decode_type_t::UNKNOWN;
+  char name[kProtocolNameMaxLength + 1];
+  IRtextSink out(name, sizeof(name));
+  typeToString(&out, (decode_type_t)nr);
+  result = findProtocolName(name);
   if (result > 0)
     return result;
 
@@ -141,24 +371,26 @@ decode_type_t strToDecodeType(const char * const str) {
 String typeToString(const decode_type_t protocol, const bool isRepeat) {
   String result = "";
   result.reserve(30);  // Size of longest protocol name + " (Repeat)"
-  if (protocol > kLastDecodeType || protocol == decode_type_t::UNKNOWN) {
-    result = kUnknownStr;
-  } else {
-    auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
-    for (uint16_t i = 0; i <= protocol && STRLEN(ptr); i++) {
-      if (i == protocol) {
-        result = FPSTR(ptr);
-        break;
-      }
-      ptr += STRLEN(ptr) + 1;
-    }
-  }
+  IRtextSink out(&result);
+  typeToString(&out, protocol, isRepeat);
+  return result;
+}
+
+/// Add the human readable name of a protocol type (enum etc) to a text sink.
+/// @param[in,out] out The sink to add the text to.
+/// @param[in] protocol Nr. (enum) of the protocol.
+/// @param[in] isRepeat A flag indicating if it is a repeat message.
+void typeToString(IRtextSink *out, const decode_type_t protocol,
+                  const bool isRepeat) {
+  if (protocol > kLastDecodeType || protocol == decode_type_t::UNKNOWN)
+    out->add(kUnknownStr);
+  else
+    out->add(IRTEXT_CONST_PTR_CAST(protocolName(protocol)));
   if (isRepeat) {
-    result += kSpaceLBraceStr;
-    result += kRepeatStr;
-    result += ')';
+    out->add(kSpaceLBraceStr);
+    out->add(kRepeatStr);
+    out->add(')');
   }
-  return result;
 }
 
 /// Does the given protocol use a complex state as part of the decode?
@@ -250,8 +482,6 @@ uint16_t getCorrectedRawLength(const decode_results * const results) {
 /// @return A String containing the code-ified result.
 String resultToSourceCode(const decode_results * const results) {
   String output = "";
-  const uint16_t length = getCorrectedRawLength(results);
-  const bool hasState = hasACState(results->decode_type);
   // Reserve some space for the string to reduce heap fragmentation.
   // "uint16_t rawData[9999] = {};  // LONGEST_PROTOCOL\n" = ~55 chars.
   // "NNNN,  " = ~7 chars on average per raw entry
@@ -263,58 +493,71 @@ String resultToSourceCode(const decode_results * const results) {
   //   "uint32_t address = 0xDEADBEEF;\n"
   //   "uint32_t command = 0xDEADBEEF;\n"
   //   "uint64_t data = 0xDEADBEEFDEADBEEF;" = ~116 chars max.
-  output.reserve(55 + (length * 7) + hasState ? 25 + (results->bits / 8) * 6
-                                              : 116);
+  output.reserve(55 + (results->rawlen * 7) +
+                 (hasACState(results->decode_type) ?
+                  25 + (results->bits / 8) * 6 : 116));
+  IRtextSink out(&output);
+  resultToSourceCode(&out, results);
+  return output;
+}
+
+/// Add the key values of a decode_results structure, in a C/C++ code style
+/// format, to a text sink.
+/// @param[in,out] out The sink to add the text to.
+/// @param[in] results A ptr to a decode_results structure.
+void resultToSourceCode(IRtextSink *out, const decode_results * const results) {
+  const bool hasState = hasACState(results->decode_type);
   // Start declaration
-  output += F("uint16_t ");  // variable type
-  output += F("rawData[");   // array name
-  output += uint64ToString(length, 10);
+  out->add(F("uint16_t "));  // variable type
+  out->add(F("rawData["));   // array name
+  out->addUint(getCorrectedRawLength(results));
   // array size
-  output += F("] = {");  // Start declaration
+  out->add(F("] = {"));  // Start declaration
 
   // Dump data
   for (uint16_t i = 1; i < results->rawlen; i++) {
     uint32_t usecs;
     for (usecs = results->rawbuf[i] * kRawTick; usecs > UINT16_MAX;
          usecs -= UINT16_MAX) {
-      output += uint64ToString(UINT16_MAX);
+      out->addUint(UINT16_MAX);
       if (i % 2)
-        output += F(", 0,  ");
+        out->add(F(", 0,  "));
       else
-        output += F(",  0, ");
+        out->add(F(",  0, "));
     }
-    output += uint64ToString(usecs, 10);
+    out->addUint(usecs);
     if (i < results->rawlen - 1)
-      output += kCommaSpaceStr;            // ',' not needed on the last one
-    if (i % 2 == 0) output += ' ';  // Extra if it was even.
+      out->add(kCommaSpaceStr);            // ',' not needed on the last one
+    if (i % 2 == 0) out->add(' ');  // Extra if it was even.
   }
 
   // End declaration
-  output += F("};");
+  out->add(F("};"));
 
   // Comment
-  output += F("  // ");
-  output += typeToString(results->decode_type, results->repeat);
+  out->add(F("  // "));
+  typeToString(out, results->decode_type, results->repeat);
   // Only display the value if the decode type doesn't have an A/C state.
-  if (!hasState)
-    output += ' ' + uint64ToString(results->value, 16);
-  output += F("\n");
+  if (!hasState) {
+    out->add(' ');
+    out->addUint(results->value, 16);
+  }
+  out->add(F("\n"));
 
   // Now dump "known" codes
   if (results->decode_type != UNKNOWN) {
     if (hasState) {
 #if DECODE_AC
       uint16_t nbytes = ceil(static_cast<float>(results->bits) / 8.0);
-      output += F("uint8_t state[");
-      output += uint64ToString(nbytes);
-      output += F("] = {");
+      out->add(F("uint8_t state["));
+      out->addUint(nbytes);
+      out->add(F("] = {"));
       for (uint16_t i = 0; i < nbytes; i++) {
-        output += F("0x");
-        if (results->state[i] < 0x10) output += '0';
-        output += uint64ToString(results->state[i], 16);
-        if (i < nbytes - 1) output += kCommaSpaceStr;
+        out->add(F("0x"));
+        out->addUint(results->state[i], 16, 2, '0');
+        if (i < nbytes - 1) out->add(kCommaSpaceStr);
       }
-      output += F("};\n");
+      out->add(F("};\n"));
 #endif  // DECODE_AC
     } else {
       // Simple protocols
@@ -322,20 +565,19 @@ String resultToSourceCode(const decode_results * const results) {
       // NOTE: It will ignore the atypical case when a message has been
       // decoded but the address & the command are both 0.
       if (results->address > 0 || results->command > 0) {
-        output += F("uint32_t address = 0x");
-        output += uint64ToString(results->address, 16);
-        output += F(";\n");
-        output += F("uint32_t command = 0x");
-        output += uint64ToString(results->command, 16);
-        output += F(";\n");
+        out->add(F("uint32_t address = 0x"));
+        out->addUint(results->address, 16);
+        out->add(F(";\n"));
+        out->add(F("uint32_t command = 0x"));
+        out->addUint(results->command, 16);
+        out->add(F(";\n"));
       }
       // Most protocols have data
-      output += F("uint64_t data = 0x");
-      output += uint64ToString(results->value, 16);
-      output += F(";\n");
+      out->add(F("uint64_t data = 0x"));
+      out->addUint(results->value, 16);
+      out->add(F(";\n"));
     }
   }
-  return output;
 }
 
 /// Dump out the decode_results structure.
@@ -344,51 +586,111 @@ String resultToSourceCode(const decode_results * const results) {
 /// @deprecated This is only for those that want this legacy format.
 String resultToTimingInfo(const decode_results * const results) {
   String output = "";
-  String value = "";
   // Reserve some space for the string to reduce heap fragmentation.
   // "Raw Timing[NNNN]:\n\n" = 19 chars
   // "   +123456, " / "-123456, " = ~12 chars on avg per raw entry.
   output.reserve(19 + 12 * results->rawlen);  // Should be less than this.
-  value.reserve(6);  // Max value should be 2^17 = 131072
-  output += F("Raw Timing[");
-  output += uint64ToString(results->rawlen - 1, 10);
-  output += F("]:\n");
+  IRtextSink out(&output);
+  resultToTimingInfo(&out, results);
+  return output;
+}
+
+/// Add the decode_results structure, in the legacy timing format, to a text
+/// sink.
+/// @param[in,out] out The sink to add the text to.
+/// @param[in] results A ptr to a decode_results structure.
+/// @deprecated This is only for those that want this legacy format.
+void resultToTimingInfo(IRtextSink *out, const decode_results * const results) {
+  out->add(F("Raw Timing["));
+  out->addUint(results->rawlen - 1);
+  out->add(F("]:\n"));
 
   for (uint16_t i = 1; i < results->rawlen; i++) {
     if (i % 2 == 0)
-      output += kDashStr;  // even
+      out->add(kDashStr);  // even
     else
-      output += F("   +");  // odd
-    value = uint64ToString(results->rawbuf[i] * kRawTick);
+      out->add(F("   +"));  // odd
     // Space pad the value till it is at least 6 chars long.
-    while (value.length() < 6) value = ' ' + value;
-    output += value;
+    out->addUint(results->rawbuf[i] * kRawTick, 10, 6);
     if (i < results->rawlen - 1)
-      output += kCommaSpaceStr;  // ',' not needed for last one
-    if (!(i % 8)) output += '\n';  // Newline every 8 entries.
+      out->add(kCommaSpaceStr);  // ',' not needed for last one
+    if (!(i % 8)) out->add('\n');  // Newline every 8 entries.
+  }
+  out->add('\n');
+}
+
+/// Add some match trace events, one per line, to a text sink.
+/// e.g. "MARK 8990 [7650..10350] ok" or "DATA bit 7 failed"
+/// @param[in,out] out The sink to add the text to.
+/// @param[in] events The events. e.g. From `irtrace::read()`.
+/// @param[in] count Nr. of events.
+/// @see ENABLE_MATCH_TRACE
+void traceToText(IRtextSink *out, const irtrace_event_t events[],
+                 const uint16_t count) {
+  for (uint16_t i = 0; i < count; i++) {
+    const irtrace_event_t *event = &events[i];
+    switch (event->type) {
+      case kTraceMatch:
+      case kTraceMark:
+      case kTraceSpace:
+        out->add(event->type == kTraceMark ? F("MARK ") :
+                 event->type == kTraceSpace ? F("SPACE ") : F("MATCH "));
+        out->addUint(event->value);
+        out->add(F(" ["));
+        out->addUint(event->low);
+        out->add(F(".."));
+        out->addUint(event->high);
+        out->add(']');
+        break;
+      case kTraceAtLeast:
+        out->add(F("ATLEAST "));
+        out->addUint(event->value);
+        out->add(F(" >= "));
+        out->addUint(event->low);
+        break;
+      case kTraceHeader:
+      case kTraceFooter:
+        out->add(event->type == kTraceHeader ? F("HEADER ") : F("FOOTER "));
+        out->add(event->value ? F("space") : F("mark"));
+        break;
+      case kTraceData:
+        out->add(F("DATA bit "));
+        out->addUint(event->value);
+        break;
+      default:
+        out->add(F("UNKNOWN "));
+        out->addUint(event->type);
+    }
+    out->add(event->result ? F(" ok\n") : F(" failed\n"));
   }
-  output += '\n';
-  return output;
 }
 
 /// Convert the decode_results structure's value/state to simple hexadecimal.
 /// @param[in] result A ptr to a decode_results structure.
 /// @return A String containing the output.
 String resultToHexidecimal(const decode_results * const result) {
-  String output = F("0x");
+  String output = "";
   // Reserve some space for the string to reduce heap fragmentation.
   output.reserve(2 * kStateSizeMax + 2);  // Should cover worst cases.
+  IRtextSink out(&output);
+  resultToHexidecimal(&out, result);
+  return output;
+}
+
+/// Add the decode_results structure's value/state, in simple hexadecimal, to
+/// a text sink.
+/// @param[in,out] out The sink to add the text to.
+/// @param[in] result A ptr to a decode_results structure.
+void resultToHexidecimal(IRtextSink *out, const decode_results * const result) {
+  out->add(F("0x"));
   if (hasACState(result->decode_type)) {
 #if DECODE_AC
-    for (uint16_t i = 0; result->bits > i * 8; i++) {
-      if (result->state[i] < 0x10) output += '0';  // Zero pad
-      output += uint64ToString(result->state[i], 16);
-    }
+    for (uint16_t i = 0; result->bits > i * 8; i++)
+      out->addUint(result->state[i], 16, 2, '0');  // Zero pad
 #endif  // DECODE_AC
   } else {
-    output += uint64ToString(result->value, 16);
+    out->addUint(result->value, 16);
   }
-  return output;
 }
 
 /// Dump out the decode_results structure into a human readable format.
@@ -400,22 +702,32 @@ String resultToHumanReadableBasic(const decode_results * const results) {
   // "Protocol  : LONGEST_PROTOCOL_NAME (Repeat)\n"
   // "Code      : 0x (NNNN Bits)\n" = 70 chars
   output.reserve(2 * kStateSizeMax + 70);  // Should cover most cases.
+  IRtextSink out(&output);
+  resultToHumanReadableBasic(&out, results);
+  return output;
+}
+
+/// Add the decode_results structure, in a human readable format, to a text
+/// sink.
+/// @param[in,out] out The sink to add the text to.
+/// @param[in] results A ptr to a decode_results structure.
+void resultToHumanReadableBasic(IRtextSink *out,
+                                const decode_results * const results) {
   // Show Encoding standard
-  output += kProtocolStr;
-  output += F("  : ");
-  output += typeToString(results->decode_type, results->repeat);
-  output += '\n';
+  out->add(kProtocolStr);
+  out->add(F("  : "));
+  typeToString(out, results->decode_type, results->repeat);
+  out->add('\n');
 
   // Show Code & length
-  output += kCodeStr;
-  output += F("      : ");
-  output += resultToHexidecimal(results);
-  output += kSpaceLBraceStr;
-  output += uint64ToString(results->bits);
-  output += ' ';
-  output += kBitsStr;
-  output +=  F(")\n");
-  return output;
+  out->add(kCodeStr);
+  out->add(F("      : "));
+  resultToHexidecimal(out, results);
+  out->add(kSpaceLBraceStr);
+  out->addUint(results->bits);
+  out->add(' ');
+  out->add(kBitsStr);
+  out->add(F(")\n"));
 }
 
 /// Convert a decode_results into an array suitable for `sendRaw()`.
@@ -423,22 +735,159 @@ String resultToHumanReadableBasic(const decode_results * const results) {
 /// @return A PTR to a dynamically allocated uint16_t sendRaw compatible array.
 /// @note The returned array needs to be delete[]'ed/free()'ed (deallocated)
 ///  after use by caller.
+/// @note Consider the version that uses a caller's buffer, or
+///   `IRsend::sendRawTicks()`, to avoid fragmenting the heap.
 uint16_t* resultToRawArray(const decode_results * const decode) {
-  uint16_t *result = new uint16_t[getCorrectedRawLength(decode)];
-  if (result != NULL) {  // The memory was allocated successfully.
-    // Convert the decode data.
-    uint16_t pos = 0;
-    for (uint16_t i = 1; i < decode->rawlen; i++) {
-      uint32_t usecs = decode->rawbuf[i] * kRawTick;
-      while (usecs > UINT16_MAX) {  // Keep truncating till it fits.
-        result[pos++] = UINT16_MAX;
-        result[pos++] = 0;  // A 0 in a sendRaw() array basically means skip.
-        usecs -= UINT16_MAX;
-      }
-      result[pos++] = usecs;
+  const uint16_t length = getCorrectedRawLength(decode);
+  uint16_t *result = new uint16_t[length];
+  if (result != NULL)  // The memory was allocated successfully.
+    resultToRawArray(decode, result, length);
+  return result;
+}
+
+/// Convert a decode_results into a `sendRaw()` array, in a caller's buffer.
+/// @param[in] decode A ptr to a decode_results structure that contains a mesg.
+/// @param[out] result A ptr to the buffer to write the array to. It can be
+///   reused for every message. e.g. A static or global buffer.
+/// @param[in] size Nr. of uint16_t's the `result` buffer can hold.
+/// @return The nr. of entries the array needs. i.e. `getCorrectedRawLength()`
+///   The buffer is only written to if that fits in `size`, so call it with a
+///   `size` of 0 to just find out how big a buffer is needed.
+uint16_t resultToRawArray(const decode_results * const decode,
+                          uint16_t *result, const uint16_t size) {
+  const uint16_t length = getCorrectedRawLength(decode);
+  if (result == NULL || length > size) return length;
+  // Convert the decode data.
+  uint16_t pos = 0;
+  for (uint16_t i = 1; i < decode->rawlen; i++) {
+    uint32_t usecs = decode->rawbuf[i] * kRawTick;
+    while (usecs > UINT16_MAX) {  // Keep truncating till it fits.
+      result[pos++] = UINT16_MAX;
+      result[pos++] = 0;  // A 0 in a sendRaw() array basically means skip.
+      usecs -= UINT16_MAX;
     }
+    result[pos++] = usecs;
   }
-  return result;
+  return length;
+}
+
+/// Find which packed raw dictionary entry is the closest to a duration.
+/// @param[in] usecs The duration to look up.
+/// @param[in] dict A ptr to the dictionary of durations.
+/// @param[in] entries Nr. of entries in the dictionary.
+/// @return The index of the closest entry.
+static uint8_t _nearestPackedRawEntry(const uint16_t usecs,
+                                      const uint16_t * const dict,
+                                      const uint8_t entries) {
+  uint8_t best = 0;
+  uint16_t best_diff = UINT16_MAX;
+  for (uint8_t d = 0; d < entries; d++) {
+    const uint16_t diff = (usecs > dict[d]) ? usecs - dict[d] : dict[d] - usecs;
+    if (diff < best_diff) {
+      best = d;
+      best_diff = diff;
+    }
+  }
+  return best;
+}
+
+/// Compress a `sendRaw()` array into a packed raw message.
+/// Similar durations are quantised into a small dictionary, each entry is then
+/// stored as a 1, 2, or 4 bit index into it, and if the message consists of
+/// a repeating frame, only a single copy of the frame is stored.
+/// @param[in] raw A ptr to the `sendRaw()` compatible array. (usecs)
+/// @param[in] len Nr. of entries in the raw[] array.
+/// @param[in] hz The carrier frequency. (kHz < 1000; Hz >= 1000)
+/// @param[out] packed A ptr to where the packed message will be written.
+/// @param[in] size Nr. of bytes available in the packed[] array.
+/// @param[in] tolerance Percentage a duration may differ from the first
+///   duration of a group and still join it. 0 means lossless.
+/// @note Each group is replaced by its average, so a duration may change by
+///   up to twice `tolerance`.
+/// @return The nr. of bytes used in packed[]. 0 if it couldn't be packed.
+///   e.g. packed[] is too small, or too many distinct durations.
+/// @see IRsend::sendPackedRaw() for the format.
+uint16_t packRaw(const uint16_t raw[], const uint16_t len, const uint16_t hz,
+                 uint8_t *packed, const uint16_t size,
+                 const uint8_t tolerance) {
+  if (raw == NULL || packed == NULL || len == 0) return 0;
+  // Pick a seed duration for each group of durations within tolerance.
+  uint16_t seeds[kPackedRawMaxDict];
+  uint8_t entries = 0;
+  for (uint16_t i = 0; i < len; i++) {
+    uint8_t d = 0;
+    for (; d < entries; d++) {
+      const uint32_t diff = (raw[i] > seeds[d]) ? raw[i] - seeds[d]
+                                                : seeds[d] - raw[i];
+      if (diff * 100 <= (uint32_t)seeds[d] * tolerance) break;
+    }
+    if (d == entries) {  // No match, so it needs a new entry.
+      if (entries == kPackedRawMaxDict) return 0;  // Too many.
+      seeds[entries++] = raw[i];
+    }
+  }
+  // Find the shortest repeating pattern of symbols. e.g. A repeated frame.
+  uint16_t symbols = len;
+  for (uint16_t period = 1; period < len; period++) {
+    uint16_t i = period;
+    for (; i < len; i++)
+      if (_nearestPackedRawEntry(raw[i], seeds, entries) !=
+          _nearestPackedRawEntry(raw[i - period], seeds, entries)) break;
+    if (i == len) {
+      symbols = period;
+      break;
+    }
+  }
+  const uint8_t bits = (entries <= 2) ? 1 : ((entries <= 4) ? 2 : 4);
+  const uint32_t used = kPackedRawHeaderSize + entries * 2U +
+      ((uint32_t)symbols * bits + 7) / 8;
+  if (used > size) return 0;  // Not enough space.
+  // Header
+  packed[0] = kPackedRawVersion;
+  packed[1] = (hz < 1000) ? hz : (hz + 500) / 1000;  // Stored as kHz.
+  packed[2] = entries;
+  packed[3] = bits;
+  packed[4] = symbols & 0xFF;
+  packed[5] = symbols >> 8;
+  packed[6] = len & 0xFF;
+  packed[7] = len >> 8;
+  // Symbols, and the running totals for the average of each entry.
+  uint32_t total[kPackedRawMaxDict] = {0};
+  uint16_t count[kPackedRawMaxDict] = {0};
+  uint8_t *ptr = packed + kPackedRawHeaderSize + entries * 2;
+  memset(ptr, 0, used - (kPackedRawHeaderSize + entries * 2));
+  for (uint16_t i = 0; i < len; i++) {
+    const uint8_t symbol = _nearestPackedRawEntry(raw[i], seeds, entries);
+    total[symbol] += raw[i];
+    count[symbol]++;
+    if (i < symbols) {
+      const uint32_t bitpos = (uint32_t)i * bits;
+      ptr[bitpos >> 3] |= symbol << (bitpos & 7);
+    }
+  }
+  // Dictionary
+  for (uint8_t d = 0; d < entries; d++) {
+    const uint16_t usecs = count[d] ? (total[d] + count[d] / 2) / count[d]
+                                    : seeds[d];
+    packed[kPackedRawHeaderSize + d * 2] = usecs & 0xFF;
+    packed[kPackedRawHeaderSize + d * 2 + 1] = usecs >> 8;
+  }
+  return used;
+}
+
+/// Expand a packed raw message back into a `sendRaw()` compatible array.
+/// @param[in] packed A ptr to the packed raw message.
+/// @param[in] size Nr. of bytes in the packed[] array.
+/// @param[out] raw A ptr to where the raw entries will be written.
+/// @param[in] maxlen Nr. of entries available in the raw[] array.
+/// @return The nr. of entries written. 0 if invalid or raw[] is too small.
+uint16_t unpackRaw(const uint8_t packed[], const uint16_t size,
+                   uint16_t *raw, const uint16_t maxlen) {
+  const uint16_t length = IRsend::packedRawLength(packed, size);
+  if (raw == NULL || length > maxlen) return 0;
+  for (uint16_t i = 0; i < length; i++)
+    raw[i] = IRsend::packedRawEntry(packed, i);
+  return length;
 }
 
 /// Sum all the bytes of an array and return the least significant 8-bits of
@@ -450,8 +899,19 @@ uint16_t* resultToRawArray(const decode_results * const decode) {
 uint8_t sumBytes(const uint8_t * const start, const uint16_t length,
                  const uint8_t init) {
   uint8_t checksum = init;
-  const uint8_t *ptr;
-  for (ptr = start; ptr - start < length; ptr++) checksum += *ptr;
+  const uint8_t *ptr = start;
+#if IRUTILS_WORD_KERNELS
+  uint32_t sum = 0;
+  for (; length - (ptr - start) >= 8; ptr += 8) {
+    const uint64_t word = loadWord(ptr);
+    // Add the bytes in pairs, then all four 16-bit pairs at once in the top.
+    const uint64_t pairs = (word & 0x00FF00FF00FF00FFULL) +
+        ((word >> 8) & 0x00FF00FF00FF00FFULL);
+    sum += (pairs * 0x0001000100010001ULL) >> 48;
+  }
+  checksum += sum;
+#endif  // IRUTILS_WORD_KERNELS
+  for (; ptr - start < length; ptr++) checksum += *ptr;
   return checksum;
 }
 
@@ -463,8 +923,16 @@ uint8_t sumBytes(const uint8_t * const start, const uint16_t length,
 uint8_t xorBytes(const uint8_t * const start, const uint16_t length,
                  const uint8_t init) {
   uint8_t checksum = init;
-  const uint8_t *ptr;
-  for (ptr = start; ptr - start < length; ptr++) checksum ^= *ptr;
+  const uint8_t *ptr = start;
+#if IRUTILS_WORD_KERNELS
+  uint64_t word = 0;
+  for (; length - (ptr - start) >= 8; ptr += 8) word ^= loadWord(ptr);
+  word ^= word >> 32;
+  word ^= word >> 16;
+  word ^= word >> 8;
+  checksum ^= word;
+#endif  // IRUTILS_WORD_KERNELS
+  for (; ptr - start < length; ptr++) checksum ^= *ptr;
   return checksum;
 }
 
@@ -477,11 +945,18 @@ uint8_t xorBytes(const uint8_t * const start, const uint16_t length,
 uint16_t countBits(const uint8_t * const start, const uint16_t length,
                    const bool ones, const uint16_t init) {
   uint16_t count = init;
+#if IRUTILS_WORD_KERNELS
+  uint16_t offset = 0;
+  for (; length - offset >= 8; offset += 8)
+    count += __builtin_popcountll(loadWord(start + offset));
+  for (; offset < length; offset++) count += __builtin_popcount(start[offset]);
+#else  // IRUTILS_WORD_KERNELS
   for (uint16_t offset = 0; offset < length; offset++)
     for (uint8_t currentbyte = *(start + offset);
          currentbyte;
          currentbyte >>= 1)
       if (currentbyte & 1) count++;
+#endif  // IRUTILS_WORD_KERNELS
   if (ones || length == 0)
     return count;
   else
@@ -497,10 +972,15 @@ uint16_t countBits(const uint8_t * const start, const uint16_t length,
 uint16_t countBits(const uint64_t data, const uint8_t length, const bool ones,
                    const uint16_t init) {
   uint16_t count = init;
+#if IRUTILS_WORD_KERNELS
+  count += __builtin_popcountll(
+      (length < 64) ? data & ((1ULL << length) - 1) : data);
+#else  // IRUTILS_WORD_KERNELS
   uint8_t bitsSoFar = length;
   for (uint64_t remainder = data; remainder && bitsSoFar;
        remainder >>= 1, bitsSoFar--)
       if (remainder & 1) count++;
+#endif  // IRUTILS_WORD_KERNELS
   if (ones || length == 0)
     return count;
   else
@@ -596,8 +1076,18 @@ namespace irutils {
   /// @param[in] protocol The IR protocol.
   /// @param[in] model The model number for that protocol.
   /// @return The resulting String.
-  /// @note After adding a new model you should update IRac::strToModel() too.
   String modelToStr(const decode_type_t protocol, const int16_t model) {
+    return modelToText(protocol, model);
+  }
+
+  /// Find the model text for a given Protocol/Model pair, without making a
+  /// copy of it.
+  /// @param[in] protocol The IR protocol.
+  /// @param[in] model The model number for that protocol.
+  /// @return A Ptr to the model's IRtext string.
+  /// @note After adding a new model you should update kModelTexts[] in
+  ///   IRac.cpp too.
+  irtext_ptr_t modelToText(const decode_type_t protocol, const int16_t model) {
     switch (protocol) {
       case decode_type_t::FUJITSU_AC:
         switch (model) {
@@ -726,10 +1216,9 @@ namespace irutils {
     String result = "";
     // ", Model: NNN (BlahBlahEtc)" = ~40 chars for longest model name.
     result.reserve(40);
-    result += addIntToString(model, kModelStr, precomma);
-    result += kSpaceLBraceStr;
-    result += modelToStr(protocol, model);
-    return result + ')';
+    IRtextSink out(&result);
+    addModelToString(&out, protocol, model, precomma);
+    return result;
   }
 
   /// Create a String of human output for a given temperature.
@@ -742,9 +1231,9 @@ namespace irutils {
   /// @return The resulting String.
   String addTempToString(const uint16_t degrees, const bool celsius,
                          const bool precomma, const bool isSensorTemp) {
-    String result = addIntToString(degrees, (isSensorTemp)?
-                                   kSensorTempStr : kTempStr, precomma);
-    result += celsius ? 'C' : 'F';
+    String result = "";
+    IRtextSink out(&result);
+    addTempToString(&out, degrees, celsius, precomma, isSensorTemp);
     return result;
   }
 
@@ -782,16 +1271,9 @@ namespace irutils {
                          const uint8_t dry, const uint8_t fan) {
     String result = "";
     result.reserve(22);  // ", Mode: NNN (UNKNOWN)"
-    result += addIntToString(mode, kModeStr);
-    result += kSpaceLBraceStr;
-    if (mode == automatic) result += kAutoStr;
-    else if (mode == cool) result += kCoolStr;
-    else if (mode == heat) result += kHeatStr;
-    else if (mode == dry)  result += kDryStr;
-    else if (mode == fan)  result += kFanStr;
-    else
-      result += kUnknownStr;
-    return result + ')';
+    IRtextSink out(&result);
+    addModeToString(&out, mode, automatic, cool, heat, dry, fan);
+    return result;
   }
 
   /// Create a String of the 3-letter day of the week from a numerical day of
@@ -850,18 +1332,10 @@ namespace irutils {
                         const uint8_t maximum, const uint8_t medium_high) {
     String result = "";
     result.reserve(21);  // ", Fan: NNN (UNKNOWN)"
-    result += addIntToString(speed, kFanStr);
-    result += kSpaceLBraceStr;
-    if (speed == high)              result += kHighStr;
-    else if (speed == low)          result += kLowStr;
-    else if (speed == automatic)    result += kAutoStr;
-    else if (speed == quiet)        result += kQuietStr;
-    else if (speed == medium)       result += kMediumStr;
-    else if (speed == maximum)      result += kMaximumStr;
-    else if (speed == medium_high)  result += kMedHighStr;
-    else
-      result += kUnknownStr;
-    return result + ')';
+    IRtextSink out(&result);
+    addFanToString(&out, speed, high, low, automatic, quiet, medium, maximum,
+                   medium_high);
+    return result;
   }
 
   /// Create a String of human output for the given horizontal swing setting.
@@ -948,40 +1422,206 @@ namespace irutils {
                            const uint8_t breeze, const uint8_t circulate) {
     String result = "";
     result.reserve(31);  // ", Swing(V): NNN (Upper Middle)"
-    result += addIntToString(position, kSwingVStr);
-    result += kSpaceLBraceStr;
+    IRtextSink out(&result);
+    addSwingVToString(&out, position, automatic, highest, high, uppermiddle,
+                      middle, lowermiddle, low, lowest, off, swing, breeze,
+                      circulate);
+    return result;
+  }
+
+  /// Add a ", label: " prefix to a text sink.
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] label The label.
+  /// @param[in] precomma Should the output start with ", " or not?
+  static void addLabel(IRtextSink *out, const irtext_ptr_t label,
+                       const bool precomma) {
+    if (precomma) out->add(kCommaSpaceStr);
+    out->add(label);
+    out->add(kColonSpaceStr);
+  }
+
+  /// Add a colon separated flag suitable for Humans to a text sink.
+  /// e.g. "Power: On"
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] value The value to come after the label.
+  /// @param[in] label The label to precede the value.
+  /// @param[in] precomma Should the output start with ", " or not?
+  void addBoolToString(IRtextSink *out, const bool value,
+                       const irtext_ptr_t label, const bool precomma) {
+    addLabel(out, label, precomma);
+    out->add(value ? kOnStr : kOffStr);
+  }
+
+  /// Add a colon separated toggle flag suitable for Humans to a text sink.
+  /// e.g. "Light: Toggle", "Light: -"
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] toggle The value of the toggle to come after the label.
+  /// @param[in] label The label to precede the value.
+  /// @param[in] precomma Should the output start with ", " or not?
+  void addToggleToString(IRtextSink *out, const bool toggle,
+                         const irtext_ptr_t label, const bool precomma) {
+    addLabel(out, label, precomma);
+    out->add(toggle ? kToggleStr : kDashStr);
+  }
+
+  /// Add a colon separated labeled Integer suitable for Humans to a text sink.
+  /// e.g. "Foo: 23"
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] value The value to come after the label.
+  /// @param[in] label The label to precede the value.
+  /// @param[in] precomma Should the output start with ", " or not?
+  void addIntToString(IRtextSink *out, const uint16_t value,
+                      const irtext_ptr_t label, const bool precomma) {
+    addLabel(out, label, precomma);
+    out->addUint(value);
+  }
+
+  /// Add human output for a given protocol model number to a text sink.
+  /// e.g. "Model: 1 (GE6711AR2853M)"
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] protocol The IR protocol.
+  /// @param[in] model The model number for that protocol.
+  /// @param[in] precomma Should the output start with ", " or not?
+  void addModelToString(IRtextSink *out, const decode_type_t protocol,
+                        const int16_t model, const bool precomma) {
+    // Same as the String version, which treats the model as a uint16_t.
+    addIntToString(out, model, kModelStr, precomma);
+    out->add(kSpaceLBraceStr);
+    out->add(modelToText(protocol, model));
+    out->add(')');
+  }
+
+  /// Add human output for a given temperature to a text sink.
+  /// e.g. "Temp: 25C"
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] degrees The temperature in degrees.
+  /// @param[in] celsius Is the temp Celsius or Fahrenheit.
+  ///  true is C, false is F
+  /// @param[in] precomma Should the output start with ", " or not?
+  /// @param[in] isSensorTemp Is the value a room (ambient) temp. or target?
+  void addTempToString(IRtextSink *out, const uint16_t degrees,
+                       const bool celsius, const bool precomma,
+                       const bool isSensorTemp) {
+    addIntToString(out, degrees, isSensorTemp ? kSensorTempStr : kTempStr,
+                   precomma);
+    out->add(celsius ? 'C' : 'F');
+  }
+
+  /// Add human output for the given operating mode to a text sink.
+  /// e.g. "Mode: 1 (Cool)"
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] mode The operating mode to display.
+  /// @param[in] automatic The numeric value for Auto mode.
+  /// @param[in] cool The numeric value for Cool mode.
+  /// @param[in] heat The numeric value for Heat mode.
+  /// @param[in] dry The numeric value for Dry mode.
+  /// @param[in] fan The numeric value for Fan mode.
+  void addModeToString(IRtextSink *out, const uint8_t mode,
+                       const uint8_t automatic, const uint8_t cool,
+                       const uint8_t heat, const uint8_t dry,
+                       const uint8_t fan) {
+    addIntToString(out, mode, kModeStr);
+    out->add(kSpaceLBraceStr);
+    if (mode == automatic) out->add(kAutoStr);
+    else if (mode == cool) out->add(kCoolStr);
+    else if (mode == heat) out->add(kHeatStr);
+    else if (mode == dry)  out->add(kDryStr);
+    else if (mode == fan)  out->add(kFanStr);
+    else
+      out->add(kUnknownStr);
+    out->add(')');
+  }
+
+  /// Add human output for the given fan speed to a text sink.
+  /// e.g. "Fan: 0 (Auto)"
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] speed The numeric speed of the fan to display.
+  /// @param[in] high The numeric value for High speed. (second highest)
+  /// @param[in] low The numeric value for Low speed.
+  /// @param[in] automatic The numeric value for Auto speed.
+  /// @param[in] quiet The numeric value for Quiet speed.
+  /// @param[in] medium The numeric value for Medium speed.
+  /// @param[in] maximum The numeric value for Highest speed. (if > high)
+  /// @param[in] medium_high The numeric value for third-highest speed.
+  ///                        (if > medium)
+  void addFanToString(IRtextSink *out, const uint8_t speed,
+                      const uint8_t high, const uint8_t low,
+                      const uint8_t automatic, const uint8_t quiet,
+                      const uint8_t medium, const uint8_t maximum,
+                      const uint8_t medium_high) {
+    addIntToString(out, speed, kFanStr);
+    out->add(kSpaceLBraceStr);
+    if (speed == high)              out->add(kHighStr);
+    else if (speed == low)          out->add(kLowStr);
+    else if (speed == automatic)    out->add(kAutoStr);
+    else if (speed == quiet)        out->add(kQuietStr);
+    else if (speed == medium)       out->add(kMediumStr);
+    else if (speed == maximum)      out->add(kMaximumStr);
+    else if (speed == medium_high)  out->add(kMedHighStr);
+    else
+      out->add(kUnknownStr);
+    out->add(')');
+  }
+
+  /// Add human output for the given vertical swing setting to a text sink.
+  /// e.g. "Swing(V): 0 (Auto)"
+  /// @param[in,out] out The sink to add the text to.
+  /// @param[in] position The numeric position of the swing to display.
+  /// @param[in] automatic The numeric value for Auto position.
+  /// @param[in] highest The numeric value for Highest position.
+  /// @param[in] high The numeric value for High position.
+  /// @param[in] uppermiddle The numeric value for Upper Middle position.
+  /// @param[in] middle The numeric value for Middle position.
+  /// @param[in] lowermiddle The numeric value for Lower Middle position.
+  /// @param[in] low The numeric value for Low position.
+  /// @param[in] lowest The numeric value for Low position.
+  /// @param[in] off The numeric value for Off position.
+  /// @param[in] swing The numeric value for Swing setting.
+  /// @param[in] breeze The numeric value for Breeze setting.
+  /// @param[in] circulate The numeric value for Circulate setting.
+  void addSwingVToString(IRtextSink *out, const uint8_t position,
+                         const uint8_t automatic,
+                         const uint8_t highest, const uint8_t high,
+                         const uint8_t uppermiddle,
+                         const uint8_t middle,
+                         const uint8_t lowermiddle,
+                         const uint8_t low, const uint8_t lowest,
+                         const uint8_t off, const uint8_t swing,
+                         const uint8_t breeze, const uint8_t circulate) {
+    addIntToString(out, position, kSwingVStr);
+    out->add(kSpaceLBraceStr);
     if (position == automatic) {
-      result += kAutoStr;
+      out->add(kAutoStr);
     } else if (position == highest) {
-      result += kHighestStr;
+      out->add(kHighestStr);
     } else if (position == high) {
-      result += kHighStr;
+      out->add(kHighStr);
     } else if (position == middle) {
-      result += kMiddleStr;
+      out->add(kMiddleStr);
     } else if (position == low) {
-      result += kLowStr;
+      out->add(kLowStr);
     } else if (position == lowest) {
-      result += kLowestStr;
+      out->add(kLowestStr);
     } else if (position == off) {
-      result += kOffStr;
+      out->add(kOffStr);
     } else if (position == uppermiddle) {
-      result += kUpperStr;
-      result += ' ';
-      result += kMiddleStr;
+      out->add(kUpperStr);
+      out->add(' ');
+      out->add(kMiddleStr);
     } else if (position == lowermiddle) {
-      result += kLowerStr;
-      result += ' ';
-      result += kMiddleStr;
+      out->add(kLowerStr);
+      out->add(' ');
+      out->add(kMiddleStr);
     } else if (position == swing) {
-      result += kSwingStr;
+      out->add(kSwingStr);
     } else if (position == breeze) {
-      result += kBreezeStr;
+      out->add(kBreezeStr);
     } else if (position == circulate) {
-      result += kCirculateStr;
+      out->add(kCirculateStr);
     } else {
-      result += kUnknownStr;
+      out->add(kUnknownStr);
     }
-    return result + ')';
+    out->add(')');
   }
 
   /// @brief Create a String of human output for the given timer setting.
@@ -1445,4 +2085,43 @@ namespace irutils {
       result |= kEndiannessError;
     return result;
   }
+
+  /// Calculate a case-insensitive FNV-1a hash of some text.
+  /// @note Must give the same result as `irtextHash()` in IRtext.h.
+  /// @param[in] str A C-style string containing the text.
+  /// @return The hash value.
+  uint32_t textHash(const char *str) {
+    uint32_t hash = 2166136261UL;
+    for (; *str; str++) {
+      const char c = (*str >= 'A' && *str <= 'Z') ? *str + ('a' - 'A') : *str;
+      hash = (hash ^ (uint8_t)c) * 16777619UL;
+    }
+    return hash;
+  }
+
+  /// Convert some text into a value via a look up table. (Case-insensitive)
+  /// Only the entries with the same hash as the text need to be compared.
+  /// @param[in] str A C-style string containing the text to be converted.
+  /// @param[in] table A ptr to the look up table. (May be in PROGMEM)
+  /// @param[in] size The nr. of entries in the table.
+  /// @param[in] def The value to return if no conversion was possible.
+  /// @return The value of the first entry in the table that matches the text.
+  /// @note With the locale pool, the texts are in the current locale, so
+  ///   there are no compile time hashes, & every entry is compared.
+  int16_t textToValue(const char *str, const IRtextValue *table,
+                      const uint16_t size, const int16_t def) {
+#if _IR_LOCALE_POOL_
+    for (uint16_t i = 0; i < size; i++) {
+      const void *text = irtextPoolStr(pgm_read_word(&table[i].text));
+#else  // _IR_LOCALE_POOL_
+    const uint32_t hash = textHash(str);
+    for (uint16_t i = 0; i < size; i++) {
+      if (pgm_read_dword(&table[i].hash) != hash) continue;
+      const void *text = pgm_read_ptr(pgm_read_ptr(&table[i].text));
+#endif  // _IR_LOCALE_POOL_
+      if (!STRCASECMP(str, reinterpret_cast<const char *>(text)))
+        return (int16_t)pgm_read_word(&table[i].value);
+    }
+    return def;
+  }
 }  // namespace irutils
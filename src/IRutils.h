@@ -13,24 +13,112 @@
 #endif
 #include "IRremoteESP8266.h"
 #include "IRrecv.h"
+#include "IRsend.h"
+#include "IRtext.h"
+
+/// Use the word-at-a-time versions of reverseBits(), countBits(), sumBytes(),
+/// & xorBytes(). The Xtensa based ESP8266 & ESP32 have no popcount instruction
+/// & no fast unaligned loads, so they keep the simple loops unless told not to.
+#ifndef IRUTILS_WORD_KERNELS
+#if defined(ESP8266) || defined(ESP32)
+#define IRUTILS_WORD_KERNELS false
+#else  // defined(ESP8266) || defined(ESP32)
+#define IRUTILS_WORD_KERNELS true
+#endif  // defined(ESP8266) || defined(ESP32)
+#endif  // IRUTILS_WORD_KERNELS
 
 const uint8_t kNibbleSize = 4;
+/// Size of a buffer for any uint64_t as text. i.e. 64 binary digits & a NUL.
+const uint8_t kUint64TextSize = 65;
+/// Size of a buffer for any int64_t as text. i.e. A sign & a uint64_t.
+const uint8_t kInt64TextSize = kUint64TextSize + 1;
 const uint8_t kLowNibble = 0;
 const uint8_t kHighNibble = 4;
 const uint8_t kModeBitsSize = 3;
+
+#ifdef ESP8266
+typedef const __FlashStringHelper* irtext_ptr_t;  ///< Ptr to an IRtext string.
+#else  // ESP8266
+typedef const char* irtext_ptr_t;  ///< Ptr to an IRtext string.
+#endif  // ESP8266
+
+/// An entry in a look up table for converting text to a value.
+/// @see irutils::textToValue()
+struct IRtextValue {
+#if _IR_LOCALE_POOL_
+  uint16_t text;  ///< The locale pool id of the IRtext string to match.
+#else  // _IR_LOCALE_POOL_
+  uint32_t hash;  ///< The `irtextHash()` of the text.
+  IRTEXT_CONST_PTR(*text);  ///< A ptr to the IRtext string to match.
+#endif  // _IR_LOCALE_POOL_
+  int16_t value;  ///< What the text converts to.
+};
+
+/// A destination for human readable text that doesn't allocate any memory.
+/// Text goes into a caller supplied char buffer (truncated to fit, and always
+/// NUL terminated), appended to an existing String, or on Arduino, straight
+/// to a Print object. e.g. Serial, or a network/MQTT client.
+/// A NULL char buffer just counts the length of the text.
+class IRtextSink {
+ public:
+  IRtextSink(char *buffer, const size_t size);
+  explicit IRtextSink(String *str);
+#ifndef UNIT_TEST
+  explicit IRtextSink(Print *print);
+#endif  // UNIT_TEST
+  void add(const char c);
+  void add(const char *str);
+#ifndef UNIT_TEST
+  void add(const __FlashStringHelper *str);
+#endif  // UNIT_TEST
+  void add(const String &str);
+  void addUint(uint64_t value, uint8_t base = 10, const uint8_t width = 0,
+               const char pad = ' ');
+  void addInt(const int64_t value);
+  size_t length(void) const;
+  bool overflowed(void) const;
+
+ private:
+  char *_buffer;  ///< The char buffer to write to, if any.
+  size_t _size;  ///< Size of the char buffer, including the NUL.
+  String *_str;  ///< The String to append to, if any.
+#ifndef UNIT_TEST
+  Print *_print;  ///< The Print object to write to, if any.
+#endif  // UNIT_TEST
+  size_t _length;  ///< Nr. of chars written, or that we tried to write.
+};
+
 uint64_t reverseBits(uint64_t input, uint16_t nbits);
+char *uint64ToText(uint64_t input, uint8_t base, char *end);
+char *int64ToText(int64_t input, uint8_t base, char *end);
 String uint64ToString(uint64_t input, uint8_t base = 10);
 String int64ToString(int64_t input, uint8_t base = 10);
+void typeToString(IRtextSink *out, const decode_type_t protocol,
+                  const bool isRepeat = false);
 String typeToString(const decode_type_t protocol,
                     const bool isRepeat = false);
 void serialPrintUint64(uint64_t input, uint8_t base = 10);
 String resultToSourceCode(const decode_results * const results);
+void resultToSourceCode(IRtextSink *out, const decode_results * const results);
 String resultToTimingInfo(const decode_results * const results);
+void resultToTimingInfo(IRtextSink *out, const decode_results * const results);
+void traceToText(IRtextSink *out, const irtrace_event_t events[],
+                 const uint16_t count);
 String resultToHumanReadableBasic(const decode_results * const results);
+void resultToHumanReadableBasic(IRtextSink *out,
+                                const decode_results * const results);
 String resultToHexidecimal(const decode_results * const result);
+void resultToHexidecimal(IRtextSink *out, const decode_results * const result);
 bool hasACState(const decode_type_t protocol);
 uint16_t getCorrectedRawLength(const decode_results * const results);
 uint16_t *resultToRawArray(const decode_results * const decode);
+uint16_t resultToRawArray(const decode_results * const decode,
+                          uint16_t *result, const uint16_t size);
+uint16_t packRaw(const uint16_t raw[], const uint16_t len, const uint16_t hz,
+                 uint8_t *packed, const uint16_t size,
+                 const uint8_t tolerance = kPackedRawTolerance);
+uint16_t unpackRaw(const uint8_t packed[], const uint16_t size,
+                   uint16_t *raw, const uint16_t maxlen);
 uint8_t sumBytes(const uint8_t * const start, const uint16_t length,
                  const uint8_t init = 0);
 uint8_t xorBytes(const uint8_t * const start, const uint16_t length,
@@ -55,6 +143,7 @@ namespace irutils {
   String addSignedIntToString(const int16_t value, const String label,
                               const bool precomma = true);
   String modelToStr(const decode_type_t protocol, const int16_t model);
+  irtext_ptr_t modelToText(const decode_type_t protocol, const int16_t model);
   String addModelToString(const decode_type_t protocol, const int16_t model,
                           const bool precomma = true);
   String addLabeledString(const String value, const String label,
@@ -100,6 +189,35 @@ namespace irutils {
                                uint8_t iFeelReportCmd = 0xFF,
                                uint8_t timerCmd = 0xFF,
                                uint8_t configCmd = 0xFF);
+  void addBoolToString(IRtextSink *out, const bool value,
+                       const irtext_ptr_t label, const bool precomma = true);
+  void addToggleToString(IRtextSink *out, const bool toggle,
+                         const irtext_ptr_t label, const bool precomma = true);
+  void addIntToString(IRtextSink *out, const uint16_t value,
+                      const irtext_ptr_t label, const bool precomma = true);
+  void addModelToString(IRtextSink *out, const decode_type_t protocol,
+                        const int16_t model, const bool precomma = true);
+  void addTempToString(IRtextSink *out, const uint16_t degrees,
+                       const bool celsius = true, const bool precomma = true,
+                       const bool isSensorTemp = false);
+  void addModeToString(IRtextSink *out, const uint8_t mode,
+                       const uint8_t automatic, const uint8_t cool,
+                       const uint8_t heat, const uint8_t dry,
+                       const uint8_t fan);
+  void addFanToString(IRtextSink *out, const uint8_t speed,
+                      const uint8_t high, const uint8_t low,
+                      const uint8_t automatic, const uint8_t quiet,
+                      const uint8_t medium, const uint8_t maximum = 0xFF,
+                      const uint8_t medium_high = 0xFF);
+  void addSwingVToString(IRtextSink *out, const uint8_t position,
+                         const uint8_t automatic,
+                         const uint8_t highest, const uint8_t high,
+                         const uint8_t uppermiddle,
+                         const uint8_t middle,
+                         const uint8_t lowermiddle,
+                         const uint8_t low, const uint8_t lowest,
+                         const uint8_t off, const uint8_t swing,
+                         const uint8_t breeze, const uint8_t circulate);
   String dayToString(const uint8_t day_of_week, const int8_t offset = 0);
   String daysBitmaskToString(uint8_t daysBitmap, uint8_t offset = 0);
   String channelToString(const uint8_t channel);
@@ -151,5 +269,8 @@ namespace irutils {
   uint8_t * invertBytePairs(uint8_t *ptr, const uint16_t length);
   bool checkInvertedBytePairs(const uint8_t * const ptr, const uint16_t length);
   uint8_t lowLevelSanityCheck(void);
+  uint32_t textHash(const char *str);
+  int16_t textToValue(const char *str, const IRtextValue *table,
+                      const uint16_t size, const int16_t def);
 }  // namespace irutils
 #endif  // IRUTILS_H_
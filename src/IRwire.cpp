@@ -0,0 +1,349 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+/// @file
+/// @brief A compact, versioned binary format for `decode_results` and
+///   `stdAc::state_t`. See IRwire.h for the layout of the messages.
+
+#include "IRwire.h"
+#include <string.h>
+#include "IRac.h"
+#include "IRutils.h"
+
+// Bit positions of the fields in the 32-bit word of a state_t message.
+// They match the layout of stdAc::packed_state_t, but are spelt out here as
+// the order of bit-fields in a struct is up to the compiler.
+const uint8_t kIrWireProtocolOffset = 0;  ///< 8 bits
+const uint8_t kIrWireModeOffset = 8;  ///< 3 bits
+const uint8_t kIrWireFanspeedOffset = 11;  ///< 3 bits
+const uint8_t kIrWireSwingvOffset = 14;  ///< 3 bits
+const uint8_t kIrWireSwinghOffset = 17;  ///< 3 bits
+const uint8_t kIrWireCommandOffset = 20;  ///< 2 bits
+const uint8_t kIrWirePowerOffset = 22;  ///< The single bit flags start here.
+
+/// Writes varints etc. into a buffer, keeping track of whether it fitted.
+class IRwireWriter {
+ public:
+  IRwireWriter(uint8_t *buffer, const uint16_t size)
+      : _ptr(buffer), _end(buffer != NULL ? buffer + size : buffer),
+        _ok(buffer != NULL) {}
+
+  void byte(const uint8_t value) {
+    if (_ptr < _end) *_ptr++ = value; else _ok = false;
+  }
+
+  void varint(uint64_t value) {
+    while (value >= 0x80) {
+      byte((value & 0x7F) | 0x80);
+      value >>= 7;
+    }
+    byte(value);
+  }
+
+  void svarint(const int32_t value) {  // Zig-zag encoded.
+    varint(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+  }
+
+  void bytes(const uint8_t *data, const uint16_t length) {
+    if (length > _end - _ptr) {
+      _ok = false;
+      return;
+    }
+    memcpy(_ptr, data, length);
+    _ptr += length;
+  }
+
+  /// @return The nr. of bytes written, or 0 if they didn't all fit.
+  uint16_t length(const uint8_t *buffer) const {
+    return _ok ? _ptr - buffer : 0;
+  }
+
+ private:
+  uint8_t *_ptr;
+  uint8_t *_end;
+  bool _ok;
+};
+
+/// Reads varints etc. from a buffer, keeping track of whether they were valid.
+class IRwireReader {
+ public:
+  IRwireReader(const uint8_t *buffer, const uint16_t length)
+      : _ptr(buffer), _end(buffer != NULL ? buffer + length : buffer),
+        _ok(buffer != NULL) {}
+
+  uint8_t byte(void) {
+    if (_ptr < _end) return *_ptr++;
+    _ok = false;
+    return 0;
+  }
+
+  /// Read an unsigned varint, which must not be larger than `max`.
+  uint64_t varint(const uint64_t max = UINT64_MAX) {
+    uint64_t value = 0;
+    for (uint8_t shift = 0; shift < 64; shift += 7) {
+      const uint8_t b = byte();
+      value |= (uint64_t)(b & 0x7F) << shift;
+      if (!(b & 0x80)) {
+        if (value > max) _ok = false;
+        return value;
+      }
+    }
+    _ok = false;  // Too long.
+    return 0;
+  }
+
+  /// Read a zig-zag encoded varint, which must fit in an int16_t.
+  int16_t svarint16(void) {
+    const uint32_t value = varint(UINT16_MAX);
+    return (int16_t)((value >> 1) ^ -(int32_t)(value & 1));
+  }
+
+  /// Skip over some bytes.
+  /// @return A Ptr to the first byte skipped, or NULL if there aren't enough.
+  const uint8_t *skip(const uint16_t length) {
+    if (length > _end - _ptr) {
+      _ok = false;
+      return NULL;
+    }
+    const uint8_t *result = _ptr;
+    _ptr += length;
+    return result;
+  }
+
+  bool ok(void) const { return _ok; }
+  const uint8_t *ptr(void) const { return _ptr; }
+
+ private:
+  const uint8_t *_ptr;
+  const uint8_t *_end;
+  bool _ok;
+};
+
+/// Class constructor.
+/// @param[in] results The decoded message view to read the raw timings of.
+IRwireRaw::IRwireRaw(const IRwireResults &results)
+    : _ptr(results.raw), _left(results.raw != NULL ? results.rawlen : 0) {}
+
+/// Get the next raw timing.
+/// @param[out] timing Where to store the timing. (In rawbuf[] units)
+/// @return true, if there was one. false, if there are no more.
+bool IRwireRaw::next(uint16_t *timing) {
+  if (!_left) return false;
+  // The timings were all checked when the message was decoded.
+  uint16_t value = 0;
+  uint8_t shift = 0;
+  uint8_t b;
+  do {
+    b = *_ptr++;
+    value |= (uint16_t)(b & 0x7F) << shift;
+    shift += 7;
+  } while (b & 0x80);
+  *timing = value;
+  _left--;
+  return true;
+}
+
+/// How many raw timings are left to be read?
+/// @return The nr. of timings.
+uint16_t IRwireRaw::remaining(void) const { return _left; }
+
+namespace irwire {
+  /// Encode a decode_results into the compact binary format.
+  /// @param[in] results A Ptr to the decode_results to encode.
+  /// @param[out] buffer Where to write the message.
+  /// @param[in] size The size of the buffer in bytes.
+  ///   `kIrWireResultsSizeMax + kIrWireRawSizeMax * rawlen` is always enough.
+  /// @param[in] raw Include the raw timings?
+  /// @return The length of the message in bytes, or 0 if it didn't fit.
+  uint16_t encodeResults(const decode_results * const results,
+                         uint8_t *buffer, const uint16_t size,
+                         const bool raw) {
+    IRwireWriter out(buffer, size);
+    const bool state = hasACState(results->decode_type);
+    const bool address = !state && (results->address || results->command);
+    const bool timings = raw && results->rawbuf != NULL && results->rawlen;
+    out.byte((kIrWireResults << 4) | kIrWireVersion);
+    out.byte((state ? kIrWireFlagState : 0) |
+             (timings ? kIrWireFlagRaw : 0) |
+             (results->repeat ? kIrWireFlagRepeat : 0) |
+             (results->overflow ? kIrWireFlagOverflow : 0) |
+             (address ? kIrWireFlagAddress : 0));
+    out.varint(results->decode_type + 1);
+    out.varint(results->bits);
+    if (state) {
+      uint16_t length = results->bits / 8 + ((results->bits % 8) ? 1 : 0);
+      if (length > kStateSizeMax) length = kStateSizeMax;
+      out.varint(length);
+      out.bytes(results->state, length);
+    } else {
+      out.varint(results->value);
+      if (address) {
+        out.varint(results->address);
+        out.varint(results->command);
+      }
+    }
+    if (timings) {
+      out.varint(results->rawlen);
+      for (uint16_t i = 0; i < results->rawlen; i++)
+        out.varint(results->rawbuf[i]);
+    }
+    return out.length(buffer);
+  }
+
+  /// Decode a decode_results message, without copying any of it.
+  /// @param[in] buffer A Ptr to the message.
+  /// @param[in] length The nr. of bytes available in the buffer.
+  /// @param[out] results Where to store the view of the message.
+  /// @return The nr. of bytes the message used, or 0 if it wasn't valid.
+  uint16_t decodeResults(const uint8_t * const buffer, const uint16_t length,
+                         IRwireResults *results) {
+    IRwireReader in(buffer, length);
+    if (in.byte() != ((kIrWireResults << 4) | kIrWireVersion)) return 0;
+    const uint8_t flags = in.byte();
+    results->decode_type = (decode_type_t)(
+        (int16_t)in.varint(kLastDecodeType + 1) - 1);
+    results->bits = in.varint(UINT16_MAX);
+    results->repeat = flags & kIrWireFlagRepeat;
+    results->overflow = flags & kIrWireFlagOverflow;
+    results->value = 0;
+    results->address = 0;
+    results->command = 0;
+    results->state = NULL;
+    results->stateLength = 0;
+    if (flags & kIrWireFlagState) {
+      results->stateLength = in.varint(kStateSizeMax);
+      results->state = in.skip(results->stateLength);
+    } else {
+      results->value = in.varint();
+      if (flags & kIrWireFlagAddress) {
+        results->address = in.varint(UINT32_MAX);
+        results->command = in.varint(UINT32_MAX);
+      }
+    }
+    results->rawlen = 0;
+    results->raw = NULL;
+    results->rawSize = 0;
+    if (flags & kIrWireFlagRaw) {
+      results->rawlen = in.varint(UINT16_MAX);
+      results->raw = in.ptr();
+      // Check them all now, so IRwireRaw doesn't have to.
+      for (uint16_t i = 0; i < results->rawlen && in.ok(); i++)
+        in.varint(UINT16_MAX);
+      results->rawSize = in.ptr() - results->raw;
+    }
+    return in.ok() ? in.ptr() - buffer : 0;
+  }
+
+  /// Copy a decoded message view into a decode_results.
+  /// @param[in] view The decoded message.
+  /// @param[out] results Where to store the result.
+  /// @param[out] rawbuf Where to store the raw timings, if any. (Optional)
+  ///   `results->rawbuf` is pointed at it.
+  /// @param[in] rawsize The nr. of entries `rawbuf` can hold.
+  /// @return true, if everything fitted. false, if the raw timings didn't, in
+  ///   which case `results->rawlen` is 0.
+  bool copyResults(const IRwireResults &view, decode_results *results,
+                   uint16_t *rawbuf, const uint16_t rawsize) {
+    results->decode_type = view.decode_type;
+    results->bits = view.bits;
+    results->repeat = view.repeat;
+    results->overflow = view.overflow;
+    if (view.state != NULL) {
+      memset(results->state, 0, kStateSizeMax);
+      memcpy(results->state, view.state, view.stateLength);
+    } else {
+      results->value = view.value;
+      results->address = view.address;
+      results->command = view.command;
+    }
+    results->rawbuf = rawbuf;
+    results->rawlen = 0;
+    if (!view.rawlen) return true;
+    if (rawbuf == NULL || view.rawlen > rawsize) return false;
+    IRwireRaw raw(view);
+    while (raw.next(&rawbuf[results->rawlen])) results->rawlen++;
+    return true;
+  }
+
+  /// Encode a stdAc::state_t into the compact binary format.
+  /// @param[in] state The state to encode.
+  /// @param[out] buffer Where to write the message.
+  /// @param[in] size The size of the buffer in bytes.
+  ///   `kIrWireStateSizeMax` is always enough.
+  /// @return The length of the message in bytes, or 0 if it didn't fit.
+  /// @note Temperatures are kept to 1/100th of a degree. See packed_state_t.
+  uint16_t encodeState(const stdAc::state_t &state, uint8_t *buffer,
+                       const uint16_t size) {
+    const stdAc::packed_state_t packed = IRac::packState(state);
+    const uint32_t word =
+        ((uint32_t)packed.protocol << kIrWireProtocolOffset) |
+        ((uint32_t)packed.mode << kIrWireModeOffset) |
+        ((uint32_t)packed.fanspeed << kIrWireFanspeedOffset) |
+        ((uint32_t)packed.swingv << kIrWireSwingvOffset) |
+        ((uint32_t)packed.swingh << kIrWireSwinghOffset) |
+        ((uint32_t)packed.command << kIrWireCommandOffset) |
+        ((uint32_t)packed.power << kIrWirePowerOffset) |
+        ((uint32_t)packed.celsius << (kIrWirePowerOffset + 1)) |
+        ((uint32_t)packed.quiet << (kIrWirePowerOffset + 2)) |
+        ((uint32_t)packed.turbo << (kIrWirePowerOffset + 3)) |
+        ((uint32_t)packed.econo << (kIrWirePowerOffset + 4)) |
+        ((uint32_t)packed.light << (kIrWirePowerOffset + 5)) |
+        ((uint32_t)packed.filter << (kIrWirePowerOffset + 6)) |
+        ((uint32_t)packed.clean << (kIrWirePowerOffset + 7)) |
+        ((uint32_t)packed.beep << (kIrWirePowerOffset + 8)) |
+        ((uint32_t)packed.iFeel << (kIrWirePowerOffset + 9));
+    IRwireWriter out(buffer, size);
+    out.byte((kIrWireState << 4) | kIrWireVersion);
+    for (uint8_t i = 0; i < 32; i += 8) out.byte(word >> i);
+    out.svarint(packed.model);
+    out.svarint(packed.sleep);
+    out.svarint(packed.degrees);
+    out.svarint(packed.sensorTemperature);
+    out.svarint(packed.clock);
+    return out.length(buffer);
+  }
+
+  /// Decode a stdAc::state_t message.
+  /// @param[in] buffer A Ptr to the message.
+  /// @param[in] length The nr. of bytes available in the buffer.
+  /// @param[out] state Where to store the state. Unchanged if it isn't valid.
+  /// @return The nr. of bytes the message used, or 0 if it wasn't valid.
+  uint16_t decodeState(const uint8_t * const buffer, const uint16_t length,
+                       stdAc::state_t *state) {
+    IRwireReader in(buffer, length);
+    if (in.byte() != ((kIrWireState << 4) | kIrWireVersion)) return 0;
+    uint32_t word = 0;
+    for (uint8_t i = 0; i < 32; i += 8) word |= (uint32_t)in.byte() << i;
+    stdAc::packed_state_t packed;
+    for (uint8_t i = 0; i < 4; i++) packed.raw[i] = 0;
+    packed.protocol = word >> kIrWireProtocolOffset;
+    packed.mode = word >> kIrWireModeOffset;
+    packed.fanspeed = word >> kIrWireFanspeedOffset;
+    packed.swingv = word >> kIrWireSwingvOffset;
+    packed.swingh = word >> kIrWireSwinghOffset;
+    packed.command = word >> kIrWireCommandOffset;
+    packed.power = word >> kIrWirePowerOffset;
+    packed.celsius = word >> (kIrWirePowerOffset + 1);
+    packed.quiet = word >> (kIrWirePowerOffset + 2);
+    packed.turbo = word >> (kIrWirePowerOffset + 3);
+    packed.econo = word >> (kIrWirePowerOffset + 4);
+    packed.light = word >> (kIrWirePowerOffset + 5);
+    packed.filter = word >> (kIrWirePowerOffset + 6);
+    packed.clean = word >> (kIrWirePowerOffset + 7);
+    packed.beep = word >> (kIrWirePowerOffset + 8);
+    packed.iFeel = word >> (kIrWirePowerOffset + 9);
+    packed.model = in.svarint16();
+    packed.sleep = in.svarint16();
+    packed.degrees = in.svarint16();
+    packed.sensorTemperature = in.svarint16();
+    packed.clock = in.svarint16();
+    // Reject anything that isn't a valid value for its enum.
+    if (!in.ok() || packed.protocol > kLastDecodeType + 1 ||
+        packed.mode > (uint8_t)stdAc::opmode_t::kLastOpmodeEnum + 1 ||
+        packed.fanspeed > (uint8_t)stdAc::fanspeed_t::kLastFanspeedEnum ||
+        packed.swingv > (uint8_t)stdAc::swingv_t::kLastSwingvEnum + 1 ||
+        packed.swingh > (uint8_t)stdAc::swingh_t::kLastSwinghEnum + 1)
+      return 0;
+    *state = IRac::unpackState(packed);
+    return in.ptr() - buffer;
+  }
+}  // namespace irwire
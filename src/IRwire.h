@@ -0,0 +1,107 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+/// @file
+/// @brief A compact, versioned binary format for sending `decode_results` and
+///   `stdAc::state_t` between devices. e.g. From an ESP to a Linux host.
+/// Integers are stored as (LEB128) varints, signed ones zig-zag encoded first,
+/// and the A/C flags & enums are packed into a single 32-bit word.
+/// Encoding writes into a caller supplied buffer, and decoding a
+/// `decode_results` message gives a view that points into the caller's buffer,
+/// so neither allocates any memory.
+///
+/// `decode_results` message (version 1):
+///   Header byte: (kIrWireResults << 4) | kIrWireVersion
+///   Flags byte: kIrWireFlag*
+///   varint: decode_type + 1. i.e. 0 is UNKNOWN.
+///   varint: bits
+///   If kIrWireFlagState: varint length, then that many state[] bytes.
+///   Otherwise: varint value, and if kIrWireFlagAddress: varint address &
+///     varint command.
+///   If kIrWireFlagRaw: varint rawlen, then rawlen varint rawbuf[] entries.
+///
+/// `stdAc::state_t` message (version 1):
+///   Header byte: (kIrWireState << 4) | kIrWireVersion
+///   4 bytes: The enums & flags (little endian). See IRwire.cpp.
+///   zig-zag varints: model, sleep, degrees & sensorTemperature (in 1/100ths
+///     of a degree), and clock.
+
+#ifndef IRWIRE_H_
+#define IRWIRE_H_
+
+#include <stdint.h>
+#include "IRremoteESP8266.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+
+// Constants
+const uint8_t kIrWireVersion = 1;  ///< The format version we write & read.
+const uint8_t kIrWireResults = 1;  ///< Message type of a decode_results.
+const uint8_t kIrWireState = 2;  ///< Message type of a stdAc::state_t.
+const uint8_t kIrWireFlagState = 1 << 0;  ///< Has a state[] not a value.
+const uint8_t kIrWireFlagRaw = 1 << 1;  ///< Has the raw timings.
+const uint8_t kIrWireFlagRepeat = 1 << 2;  ///< Is a repeat message.
+const uint8_t kIrWireFlagOverflow = 1 << 3;  ///< The capture overflowed.
+const uint8_t kIrWireFlagAddress = 1 << 4;  ///< Has an address & command.
+/// Largest possible encoded stdAc::state_t message. (Bytes)
+const uint16_t kIrWireStateSizeMax = 1 + 4 + 5 * 3;
+/// Largest possible encoded state[] of a decode_results message. (Bytes)
+/// i.e. Its length & the bytes.
+const uint16_t kIrWireResultsStateSizeMax = 3 + kStateSizeMax;
+/// Largest possible encoded value, address & command of a decode_results
+/// message. (Bytes)
+const uint16_t kIrWireResultsValueSizeMax = 10 + 5 + 5;
+/// Largest possible encoded decode_results message, excluding the raw timings.
+/// i.e. The header, flags, protocol, bits, the larger of the state[] or the
+/// value, address & command, and the nr. of raw timings.
+const uint16_t kIrWireResultsSizeMax = 1 + 1 + 3 + 3 +
+    (kIrWireResultsStateSizeMax > kIrWireResultsValueSizeMax ?
+     kIrWireResultsStateSizeMax : kIrWireResultsValueSizeMax) + 3;
+/// Largest possible encoded size of each raw timing. (Bytes)
+const uint16_t kIrWireRawSizeMax = 3;
+
+/// A read-only view of an encoded decode_results message.
+/// Nothing is copied. `state` & `raw` point into the buffer it was decoded
+/// from, so that must stay valid while the view is used.
+struct IRwireResults {
+  decode_type_t decode_type;  ///< The protocol.
+  uint16_t bits;  ///< Nr. of bits in the message.
+  bool repeat;  ///< Is it a repeat message?
+  bool overflow;  ///< Did the capture overflow?
+  uint64_t value;  ///< The decoded value, if it has no state[].
+  uint32_t address;  ///< The decoded address, if it has no state[].
+  uint32_t command;  ///< The decoded command, if it has no state[].
+  const uint8_t *state;  ///< Ptr to the state[] bytes. NULL if there is none.
+  uint16_t stateLength;  ///< Nr. of bytes in `state`.
+  uint16_t rawlen;  ///< Nr. of raw timings. 0 if they weren't included.
+  const uint8_t *raw;  ///< Ptr to the encoded raw timings. See IRwireRaw.
+  uint16_t rawSize;  ///< Nr. of bytes of encoded raw timings.
+};
+
+/// Reads the raw timings of an IRwireResults view one at a time, without
+/// copying them all out first.
+class IRwireRaw {
+ public:
+  explicit IRwireRaw(const IRwireResults &results);
+  bool next(uint16_t *timing);
+  uint16_t remaining(void) const;
+
+ private:
+  const uint8_t *_ptr;  ///< Where the next timing is.
+  uint16_t _left;  ///< Nr. of timings left to read.
+};
+
+/// Functions for encoding & decoding the compact binary format.
+namespace irwire {
+  uint16_t encodeResults(const decode_results * const results,
+                         uint8_t *buffer, const uint16_t size,
+                         const bool raw = true);
+  uint16_t decodeResults(const uint8_t * const buffer, const uint16_t length,
+                         IRwireResults *results);
+  bool copyResults(const IRwireResults &view, decode_results *results,
+                   uint16_t *rawbuf = NULL, const uint16_t rawsize = 0);
+  uint16_t encodeState(const stdAc::state_t &state, uint8_t *buffer,
+                       const uint16_t size);
+  uint16_t decodeState(const uint8_t * const buffer, const uint16_t length,
+                       stdAc::state_t *state);
+}  // namespace irwire
+#endif  // IRWIRE_H_
@@ -10,6 +10,14 @@
 #define _IR_LOCALE_ en-AU
 #endif  // _IR_LOCALE_
 
+// Use a pool of every IRtext string, for several locales, so the locale can be
+// changed at run time with `irtextSetLocale()`. `_IR_LOCALE_` is the one used
+// at start up. The locales in the pool are set by re-generating it with
+// '../tools/generate_irtext_pool.py'.
+#ifndef _IR_LOCALE_POOL_
+#define _IR_LOCALE_POOL_ false
+#endif  // _IR_LOCALE_POOL_
+
 #define ENQUOTE_(x) #x
 #define ENQUOTE(x) ENQUOTE_(x)
 
@@ -5,6 +5,7 @@
 // Supports:
 // Brand: Bluestar,  Model: D716LXM0535A2400313 (Remote)
 
+#include "IRprotocol.h"
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
@@ -70,3 +71,21 @@ bool IRrecv::decodeBluestarHeavy(decode_results *results, uint16_t offset,
   return true;
 }
 #endif  // DECODE_BLUESTARHEAVY
+
+#if (DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY)
+/// The protocol registry entry for BluestarHeavy.
+const irprotocol_t IRprotocols::kBluestarHeavy = {
+    BLUESTARHEAVY,
+#if DECODE_BLUESTARHEAVY
+    &IRrecv::decodeBluestarHeavy, kBluestarHeavyBits, true,
+#else  // DECODE_BLUESTARHEAVY
+    NULL, 0, false,
+#endif  // DECODE_BLUESTARHEAVY
+    NULL,
+#if SEND_BLUESTARHEAVY
+    &IRsend::sendBluestarHeavy,
+#else  // SEND_BLUESTARHEAVY
+    NULL,
+#endif  // SEND_BLUESTARHEAVY
+    kNoRepeat};
+#endif  // (DECODE_BLUESTARHEAVY || SEND_BLUESTARHEAVY)
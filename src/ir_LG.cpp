@@ -12,6 +12,7 @@
 #include "ir_LG.h"
 #include <algorithm>
 #include "IRac.h"
+#include "IRprotocol.h"
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRtext.h"
@@ -26,6 +27,12 @@ using irutils::addToggleToString;
 using irutils::addSwingVToString;
 using irutils::addIntToString;
 
+#ifndef PROGMEM
+#define PROGMEM  // Pretend we have the PROGMEM macro even if we really don't.
+#endif
+#ifndef pgm_read_byte
+#define pgm_read_byte(ADDR) (*reinterpret_cast<const uint8_t *>(ADDR))
+#endif  // pgm_read_byte
 
 // Constants
 // Common timings
@@ -54,6 +61,19 @@ const uint8_t  kLgAcSwingHOffsetSize = kLgAcChecksumSize + 1;
 const uint32_t kLgAcSwingHSignature  = kLgAcSwingHOff >> kLgAcSwingHOffsetSize;
 const uint32_t kLgAcVaneSwingVBase = 0x8813200;
 
+// Native mode for each `stdAc::packed_state_t::mode`. i.e. opmode_t + 1.
+const uint8_t kLgAcPackedModeMap[8] PROGMEM = {
+    kLgAcAuto, kLgAcAuto, kLgAcCool, kLgAcHeat,  // Off, Auto, Cool, Heat,
+    kLgAcDry, kLgAcFan, kLgAcAuto, kLgAcAuto};   // Dry, Fan, n/a, n/a.
+// Native fan speed for each `stdAc::packed_state_t::fanspeed`.
+const uint8_t kLgAcPackedFanMap[8] PROGMEM = {
+    kLgAcFanAuto, kLgAcFanLowest, kLgAcFanLow, kLgAcFanMedium,
+    kLgAcFanMax, kLgAcFanMax, kLgAcFanAuto, kLgAcFanAuto};
+// Ditto, but for the AKB74955603 model which has a couple more speeds.
+const uint8_t kLgAcPackedFanMapAKB74955603[8] PROGMEM = {
+    kLgAcFanAuto, kLgAcFanLowest, kLgAcFanLowAlt, kLgAcFanMedium,
+    kLgAcFanHigh, kLgAcFanMax, kLgAcFanAuto, kLgAcFanAuto};
+
 #ifdef VANESWINGVPOS
 #undef VANESWINGVPOS
 #endif
@@ -223,6 +243,46 @@ bool IRrecv::decodeLG(decode_results *results, uint16_t offset,
 }
 #endif  // DECODE_LG
 
+#if (DECODE_LG || SEND_LG)
+/// The protocol registry entry for 28-bit LG.
+const irprotocol_t IRprotocols::kLg = {
+    LG,
+#if DECODE_LG
+    &IRrecv::decodeLG, kLgBits, true,
+#else  // DECODE_LG
+    NULL, 0, false,
+#endif  // DECODE_LG
+#if SEND_LG
+    &IRsend::sendLG,
+#else  // SEND_LG
+    NULL,
+#endif  // SEND_LG
+    NULL, kNoRepeat};
+
+/// The protocol registry entry for 32-bit LG. (Decoding only)
+/// @note LG32 should be tried before Samsung.
+const irprotocol_t IRprotocols::kLg32 = {
+    LG,
+#if DECODE_LG
+    &IRrecv::decodeLG, kLg32Bits, true,
+#else  // DECODE_LG
+    NULL, 0, false,
+#endif  // DECODE_LG
+    NULL, NULL, kNoRepeat};
+
+/// The protocol registry entry for LG2. (Sending only)
+/// @note IRrecv::decodeLG() reports LG2 messages itself.
+const irprotocol_t IRprotocols::kLg2 = {
+    LG2,
+    NULL, 0, false,
+#if SEND_LG
+    &IRsend::sendLG2,
+#else  // SEND_LG
+    NULL,
+#endif  // SEND_LG
+    NULL, kNoRepeat};
+#endif  // (DECODE_LG || SEND_LG)
+
 // LG A/C Class
 
 /// Class constructor
@@ -752,6 +812,90 @@ uint8_t IRLgAc::convertVaneSwingV(const stdAc::swingv_t swingv) {
   }
 }
 
+/// Work out the message for a common A/C state directly, without the setters.
+/// i.e. The same message `IRac::lg()` would send via a freshly reset object.
+/// @param[in] state The desired state. Only the model, power, mode, degrees,
+///   fanspeed, swingv, swingh, & light are used.
+/// @param[in] swingv_prev The previous vertical swing setting.
+/// @param[out] code Where to store the native code to send.
+/// @param[out] protocol Where to store the protocol (LG or LG2) to send it as.
+/// @return true, if the state only needs that one message. false, if the
+///   model also needs extra swing/light messages, in which case use an object.
+bool IRLgAc::encode(const stdAc::state_t state,
+                    const stdAc::swingv_t swingv_prev,
+                    uint32_t *code, decode_type_t *protocol) {
+  // Drop any fractions of a degree like `setTemp()` does, before packing the
+  // state rounds them to 1/100ths. e.g. 23.999998 is 23, not 24.
+  stdAc::state_t whole = state;
+  whole.degrees = (int16_t)state.degrees;
+  return encode(IRac::packState(whole), swingv_prev, code, protocol);
+}
+
+/// Work out the message for a common A/C state directly, without the setters.
+/// i.e. The same message `IRac::lg()` would send via a freshly reset object.
+/// @param[in] state The desired state in its packed form. Only the model,
+///   power, mode, degrees, fanspeed, swingv, swingh, & light are used.
+/// @param[in] swingv_prev The previous vertical swing setting.
+/// @param[out] code Where to store the native code to send.
+/// @param[out] protocol Where to store the protocol (LG or LG2) to send it as.
+/// @return true, if the state only needs that one message. false, if the
+///   model also needs extra swing/light messages, in which case use an object.
+/// @note A look-up table of every possible code isn't worth the flash; the
+///   code is a few fields & a nibble checksum, so it's cheaper to calculate.
+bool IRLgAc::encode(const stdAc::packed_state_t state,
+                    const stdAc::swingv_t swingv_prev,
+                    uint32_t *code, decode_type_t *protocol) {
+  lg_ac_remote_model_t model = (lg_ac_remote_model_t)state.model;
+  switch (model) {
+    case lg_ac_remote_model_t::AKB75215403:
+    case lg_ac_remote_model_t::AKB74955603:
+    case lg_ac_remote_model_t::AKB73757604:
+      *protocol = decode_type_t::LG2;
+      break;
+    case lg_ac_remote_model_t::LG6711A20083V:
+      *protocol = decode_type_t::LG;
+      break;
+    default:  // setModel() ignores anything else, so it's the default model.
+      model = lg_ac_remote_model_t::GE6711AR2853M;
+      *protocol = decode_type_t::LG;
+  }
+  if (!state.power) {
+    *code = kLgAcOffCommand;
+    return true;  // The Off command is always sent on its own.
+  }
+  LGProtocol lg;
+  lg.raw = kLgAcOffCommand;
+  lg.Power = kLgAcPowerOn;
+  lg.Mode = pgm_read_byte(kLgAcPackedModeMap + state.mode);
+  // The same clamping as setTemp(). Any fractions of a degree are dropped.
+  // Use the `state_t` version of this to drop them the same way it does.
+  int16_t degrees = state.degrees / 100;
+  degrees = std::max((int16_t)kLgAcMinTemp, degrees);
+  degrees = std::min((int16_t)kLgAcMaxTemp, degrees);
+  lg.Temp = degrees - kLgAcTempAdjust;
+  lg.Fan = pgm_read_byte(((model == lg_ac_remote_model_t::AKB74955603) ?
+                          kLgAcPackedFanMapAKB74955603 : kLgAcPackedFanMap) +
+                         state.fanspeed);
+  lg.Sum = calcChecksum(lg.raw);
+  *code = lg.raw;
+  // Do we need any of the extra messages send() adds for some models?
+  const stdAc::swingv_t swingv = (stdAc::swingv_t)((int8_t)state.swingv - 1);
+  switch (model) {
+    case lg_ac_remote_model_t::LG6711A20083V:
+      // A change to/from Off always sends a swingv toggle message.
+      return (swingv == stdAc::swingv_t::kOff) ==
+          (swingv_prev == stdAc::swingv_t::kOff) &&
+          convertSwingV(swingv) == convertSwingV(swingv_prev);
+    case lg_ac_remote_model_t::AKB74955603:
+      return state.light &&
+          convertSwingV(swingv) == convertSwingV(swingv_prev);
+    case lg_ac_remote_model_t::AKB73757604:
+      return false;  // The vane swingv messages are always sent.
+    default:
+      return true;
+  }
+}
+
 /// Convert the current internal state into its stdAc::state_t equivalent.
 /// @param[in] prev Ptr to the previous state if required.
 /// @return The stdAc equivalent of the native settings.
@@ -801,58 +945,66 @@ stdAc::state_t IRLgAc::toCommon(const stdAc::state_t *prev) const {
 String IRLgAc::toString(void) const {
   String result = "";
   result.reserve(80);  // Reserve some heap for the string to reduce fragging.
-  result += addModelToString(_protocol, getModel(), false);
+  IRtextSink out(&result);
+  toString(&out);
+  return result;
+}
+
+/// Add the current internal state, in human readable form, to a text sink.
+/// e.g. A fixed size char buffer, or a Print object. Nothing is allocated.
+/// @param[in,out] out The sink to add the text to.
+void IRLgAc::toString(IRtextSink *out) const {
+  addModelToString(out, _protocol, getModel(), false);
   if (_isNormal()) {  // A "Normal" generic settings message.
-    result += addBoolToString(getPower(), kPowerStr);
+    addBoolToString(out, getPower(), kPowerStr);
     if (getPower()) {  // Only display the rest if is in power on state.
-      result += addModeToString(_.Mode, kLgAcAuto, kLgAcCool,
-                                kLgAcHeat, kLgAcDry, kLgAcFan);
-      result += addTempToString(getTemp());
-      result += addFanToString(_.Fan, kLgAcFanHigh,
-                               _isAKB74955603() ? kLgAcFanLowAlt : kLgAcFanLow,
-                               kLgAcFanAuto, kLgAcFanLowest, kLgAcFanMedium,
-                               kLgAcFanMax);
+      addModeToString(out, _.Mode, kLgAcAuto, kLgAcCool,
+                      kLgAcHeat, kLgAcDry, kLgAcFan);
+      addTempToString(out, getTemp());
+      addFanToString(out, _.Fan, kLgAcFanHigh,
+                     _isAKB74955603() ? kLgAcFanLowAlt : kLgAcFanLow,
+                     kLgAcFanAuto, kLgAcFanLowest, kLgAcFanMedium,
+                     kLgAcFanMax);
     }
   } else {  // It must be a special single purpose code.
     if (isOffCommand()) {
-      result += addBoolToString(false, kPowerStr);
+      addBoolToString(out, false, kPowerStr);
     } else if (isLightToggle()) {
-      result += addBoolToString(true, kLightToggleStr);
+      addBoolToString(out, true, kLightToggleStr);
     } else if (isSwingH()) {
-      result += addBoolToString(_swingh, kSwingHStr);
+      addBoolToString(out, _swingh, kSwingHStr);
     } else if (isSwingV()) {
       if (isSwingVToggle())
-        result += addToggleToString(isSwingVToggle(), kSwingVStr);
+        addToggleToString(out, isSwingVToggle(), kSwingVStr);
       else
-        result += addSwingVToString((uint8_t)(_swingv >> kLgAcChecksumSize),
-                                    0,  // No Auto, See "swing". Unused
-                                    kLgAcSwingVHighest_Short,
-                                    kLgAcSwingVHigh_Short,
-                                    kLgAcSwingVUpperMiddle_Short,
-                                    kLgAcSwingVMiddle_Short,
-                                    0,  // Unused
-                                    kLgAcSwingVLow_Short,
-                                    kLgAcSwingVLowest_Short,
-                                    kLgAcSwingVOff_Short,
-                                    kLgAcSwingVSwing_Short,
-                                    0, 0);
+        addSwingVToString(out, (uint8_t)(_swingv >> kLgAcChecksumSize),
+                          0,  // No Auto, See "swing". Unused
+                          kLgAcSwingVHighest_Short,
+                          kLgAcSwingVHigh_Short,
+                          kLgAcSwingVUpperMiddle_Short,
+                          kLgAcSwingVMiddle_Short,
+                          0,  // Unused
+                          kLgAcSwingVLow_Short,
+                          kLgAcSwingVLowest_Short,
+                          kLgAcSwingVOff_Short,
+                          kLgAcSwingVSwing_Short,
+                          0, 0);
     } else if (isVaneSwingV()) {
       const uint8_t vane = getVaneCode(_.raw) / kLgAcVaneSwingVSize;
-      result += addIntToString(vane, kVaneStr);
-      result += addSwingVToString(_vaneswingv[vane],
-                                  0,  // No Auto, See "swing". Unused
-                                  kLgAcVaneSwingVHighest,
-                                  kLgAcVaneSwingVHigh,
-                                  kLgAcVaneSwingVUpperMiddle,
-                                  kLgAcVaneSwingVMiddle,
-                                  0,  // Unused
-                                  kLgAcVaneSwingVLow,
-                                  kLgAcVaneSwingVLowest,
-                                  // Rest unused
-                                  0, 0, 0, 0);
+      addIntToString(out, vane, kVaneStr);
+      addSwingVToString(out, _vaneswingv[vane],
+                        0,  // No Auto, See "swing". Unused
+                        kLgAcVaneSwingVHighest,
+                        kLgAcVaneSwingVHigh,
+                        kLgAcVaneSwingVUpperMiddle,
+                        kLgAcVaneSwingVMiddle,
+                        0,  // Unused
+                        kLgAcVaneSwingVLow,
+                        kLgAcVaneSwingVLowest,
+                        // Rest unused
+                        0, 0, 0, 0);
     }
   }
-  return result;
 }
 
 /// Check if the internal state looks like a valid LG A/C message.
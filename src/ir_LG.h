@@ -167,8 +167,15 @@ class IRLgAc {
   static uint8_t convertFan(const stdAc::fanspeed_t speed);
   static uint32_t convertSwingV(const stdAc::swingv_t swingv);
   static uint8_t convertVaneSwingV(const stdAc::swingv_t swingv);
+  static bool encode(const stdAc::state_t state,
+                     const stdAc::swingv_t swingv_prev,
+                     uint32_t *code, decode_type_t *protocol);
+  static bool encode(const stdAc::packed_state_t state,
+                     const stdAc::swingv_t swingv_prev,
+                     uint32_t *code, decode_type_t *protocol);
   stdAc::state_t toCommon(const stdAc::state_t *prev = NULL) const;
   String toString(void) const;
+  void toString(IRtextSink *out) const;
   void setModel(const lg_ac_remote_model_t model);
   lg_ac_remote_model_t getModel(void) const;
 #ifndef UNIT_TEST
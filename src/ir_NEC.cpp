@@ -10,6 +10,7 @@
 #include "ir_NEC.h"
 #include <stdint.h>
 #include <algorithm>
+#include "IRprotocol.h"
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRutils.h"
@@ -138,3 +139,40 @@ bool IRrecv::decodeNEC(decode_results *results, uint16_t offset,
 }
 #endif  // (DECODE_NEC || DECODE_SHERWOOD || DECODE_AIWA_RC_T501 ||
         // DECODE_SANYO)
+
+#if (DECODE_NEC || SEND_NEC)
+/// The protocol registry entry for strict NEC.
+const irprotocol_t IRprotocols::kNec = {
+    NEC,
+#if DECODE_NEC
+    &IRrecv::decodeNEC, kNECBits, true,
+#else  // DECODE_NEC
+    NULL, 0, false,
+#endif  // DECODE_NEC
+#if SEND_NEC
+    &IRsend::sendNEC,
+#else  // SEND_NEC
+    NULL,
+#endif  // SEND_NEC
+    NULL, kNoRepeat};
+
+/// The protocol registry entry for NEC-like codes.
+/// Some devices send NEC-like codes that don't follow the true NEC spec.
+/// This should detect those. e.g. Apple TV remote etc.
+/// @note This needs to be tried after all other codes that use strict and
+///   some other protocols that are NEC-like as well, as turning off strict may
+///   cause this to match other valid protocols.
+const irprotocol_t IRprotocols::kNecLike = {
+    NEC_LIKE,
+#if DECODE_NEC
+    &IRrecv::decodeNEC, kNECBits, false,
+#else  // DECODE_NEC
+    NULL, 0, false,
+#endif  // DECODE_NEC
+#if SEND_NEC
+    &IRsend::sendNEC,
+#else  // SEND_NEC
+    NULL,
+#endif  // SEND_NEC
+    NULL, kNoRepeat};
+#endif  // (DECODE_NEC || SEND_NEC)
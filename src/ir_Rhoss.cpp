@@ -6,6 +6,7 @@
 #include "ir_Rhoss.h"
 #include <algorithm>
 #include <cstring>
+#include "IRprotocol.h"
 #include "IRrecv.h"
 #include "IRsend.h"
 #include "IRtext.h"
@@ -100,6 +101,24 @@ bool IRrecv::decodeRhoss(decode_results *results, uint16_t offset,
 
 #endif  // DECODE_RHOSS
 
+#if (DECODE_RHOSS || SEND_RHOSS)
+/// The protocol registry entry for Rhoss.
+const irprotocol_t IRprotocols::kRhoss = {
+    RHOSS,
+#if DECODE_RHOSS
+    &IRrecv::decodeRhoss, kRhossBits, true,
+#else  // DECODE_RHOSS
+    NULL, 0, false,
+#endif  // DECODE_RHOSS
+    NULL,
+#if SEND_RHOSS
+    &IRsend::sendRhoss,
+#else  // SEND_RHOSS
+    NULL,
+#endif  // SEND_RHOSS
+    kRhossDefaultRepeat};
+#endif  // (DECODE_RHOSS || SEND_RHOSS)
+
 /// Class constructor
 /// @param[in] pin GPIO to be used when sending.
 /// @param[in] inverted Is the output signal to be inverted?
@@ -352,13 +371,21 @@ stdAc::state_t IRRhossAc::toCommon(void) const {
 String IRRhossAc::toString(void) const {
   String result = "";
   result.reserve(70);  // Reserve some heap for the string to reduce fragging.
-  result += addBoolToString(getPower(), kPowerStr, false);
-  result += addModeToString(getMode(), kRhossModeAuto, kRhossModeCool,
-                             kRhossModeHeat, kRhossModeDry, kRhossModeFan);
-  result += addTempToString(getTemp());
-  result += addFanToString(getFan(), kRhossFanMax, kRhossFanMin,
-                           kRhossFanAuto, kRhossFanAuto,
-                           kRhossFanMed);
-  result += addBoolToString(getSwing(), kSwingVStr);
+  IRtextSink out(&result);
+  toString(&out);
   return result;
 }
+
+/// Add the current internal state, in human readable form, to a text sink.
+/// e.g. A fixed size char buffer, or a Print object. Nothing is allocated.
+/// @param[in,out] out The sink to add the text to.
+void IRRhossAc::toString(IRtextSink *out) const {
+  addBoolToString(out, getPower(), kPowerStr, false);
+  addModeToString(out, getMode(), kRhossModeAuto, kRhossModeCool,
+                   kRhossModeHeat, kRhossModeDry, kRhossModeFan);
+  addTempToString(out, getTemp());
+  addFanToString(out, getFan(), kRhossFanMax, kRhossFanMin,
+                 kRhossFanAuto, kRhossFanAuto,
+                 kRhossFanMed);
+  addBoolToString(out, getSwing(), kSwingVStr);
+}
@@ -15,6 +15,7 @@
 #endif
 #include "IRremoteESP8266.h"
 #include "IRsend.h"
+#include "IRutils.h"
 #ifdef UNIT_TEST
 #include "IRsend_test.h"
 #endif
@@ -130,6 +131,7 @@ class IRRhossAc {
   static stdAc::fanspeed_t toCommonFanSpeed(const uint8_t speed);
   stdAc::state_t toCommon(void) const;
   String toString(void) const;
+  void toString(IRtextSink *out) const;
 #ifndef UNIT_TEST
 
  private:
@@ -0,0 +1,764 @@
+// Copyright 2026 IRremoteESP8266 project and others
+// The runtime switchable locale string pool. Only for inclusion by IRtext.cpp
+//
+// WARNING: Do not edit this file! This file is automatically generated by
+//          '../tools/generate_irtext_pool.py'.
+// Locales: en-AU en-US de-DE es-ES fr-FR it-IT
+
+#ifndef LOCALE_POOL_H_
+#define LOCALE_POOL_H_
+
+#include "IRtext_pool.h"
+
+/// Every locale's text for every IRtext string, de-duplicated. (5668 bytes)
+static const char kIrTextPool[] PROGMEM =
+    "Direct / Indirect Modalità\0"  // 0
+    "Vorheriger Einschaltzustand\0"  // 28
+    "Direct / Indirect Modus\0"  // 56
+    "Direct / Indirect Mode\0"  // 80
+    "Direct / Indirect Modo\0"  // 103
+    "Encendido Temporizador\0"  // 126
+    "Accensione Precedente\0"  // 149
+    "DomLunMarMerGioVenSab\0"  // 171
+    "DomLunMarMieJueVieSab\0"  // 193
+    "LunMarMerJeuVenSamDim\0"  // 215
+    "SonMonDieMitDonFreSam\0"  // 237
+    "SunMonTueWedThuFriSat\0"  // 259
+    "Apagado Temporizador\0"  // 281
+    "Chaque semaine Timer\0"  // 302
+    "Semanal Temporizador\0"  // 323
+    "ventilador_solamente\0"  // 344
+    "Accensione Pulsante\0"  // 365
+    "Display Temperatura\0"  // 385
+    "Dormir Temporizador\0"  // 405
+    "Swing(V) Umschalten\0"  // 425
+    "Accensione Alterna\0"  // 445
+    "Celsius/Fahrenheit\0"  // 464
+    "Display Temporaire\0"  // 483
+    "Esterno Silenzioso\0"  // 502
+    "Fijar Temporizador\0"  // 521
+    "Oscilar(V) Palanca\0"  // 540
+    "Sensor Temperatura\0"  // 559
+    "Swing(V) Modalità\0"  // 578
+    "Temperatura Arriba\0"  // 597
+    "Temporaire En haut\0"  // 616
+    "Wöchentlich Timer\0"  // 635
+    "Anzeigetemperatur\0"  // 654
+    "Au dessus-Moitié\0"  // 672
+    "Plein air Silence\0"  // 690
+    "Sensor Temporaire\0"  // 708
+    "Settimanale Timer\0"  // 726
+    "Temperatura Abajo\0"  // 744
+    "Temporaire En bas\0"  // 762
+    "Temporizador Modo\0"  // 780
+    "Ventillateur Only\0"  // 798
+    "Economie Bascule\0"  // 816
+    "Licht Umschalten\0"  // 833
+    "Lumière Bascule\0"  // 850
+    "Power Precedente\0"  // 867
+    "Power Umschalten\0"  // 884
+    "Swing(V) Alterna\0"  // 901
+    "Swing(V) Bascule\0"  // 918
+    "TOSHIBA REMOTE A\0"  // 935
+    "TOSHIBA REMOTE B\0"  // 952
+    "Turbo Umschalten\0"  // 969
+    "VentillateurOnly\0"  // 986
+    "Afuera Silencio\0"  // 1003
+    "Leggero Alterna\0"  // 1019
+    "Oscilar(V) Modo\0"  // 1035
+    "Superiore-Medio\0"  // 1051
+    "Swing(V) Toggle\0"  // 1067
+    "Timer Modalità\0"  // 1083
+    "TimerActiveDays\0"  // 1099
+    "Ventilador Only\0"  // 1115
+    "Absense detect\0"  // 1131
+    "Draussen Ruhig\0"  // 1146
+    "Eco Umschalten\0"  // 1161
+    "Faire circuler\0"  // 1176
+    "Poder Anterior\0"  // 1191
+    "Previous Power\0"  // 1206
+    "R-LT0541-HTA-A\0"  // 1221
+    "R-LT0541-HTA-B\0"  // 1236
+    "Schlafen Timer\0"  // 1251
+    "Superior-Medio\0"  // 1266
+    "Swing(V) Modus\0"  // 1281
+    "VentiladorOnly\0"  // 1296
+    "Econo Palanca\0"  // 1311
+    "Flujo de Aire\0"  // 1325
+    "Flusso d'aria\0"  // 1339
+    "GE6711AR2853M\0"  // 1353
+    "Imposta Timer\0"  // 1367
+    "Izquierda Max\0"  // 1381
+    "LG6711A20083V\0"  // 1395
+    "Max Izquierda\0"  // 1409
+    "Outside Quiet\0"  // 1423
+    "Poder Palanca\0"  // 1437
+    "Power Bascule\0"  // 1451
+    "Swing(V) Mode\0"  // 1465
+    "Temp Hinunter\0"  // 1479
+    "Turbo Alterna\0"  // 1493
+    "Turbo Bascule\0"  // 1507
+    "Turbo Palanca\0"  // 1521
+    "6to. Sentido\0"  // 1535
+    "Acceso Timer\0"  // 1548
+    "Commandement\0"  // 1561
+    "Display Temp\0"  // 1574
+    "Econo Toggle\0"  // 1587
+    "IFeel Report\0"  // 1600
+    "IzquierdaMax\0"  // 1613
+    "Le plus haut\0"  // 1626
+    "Light Toggle\0"  // 1639
+    "Lüfter Only\0"  // 1652
+    "Max Sinistra\0"  // 1665
+    "MaxIzquierda\0"  // 1678
+    "Mettre Timer\0"  // 1691
+    "Netzschalter\0"  // 1704
+    "PANASONICCKP\0"  // 1717
+    "PANASONICDKE\0"  // 1730
+    "PANASONICJKE\0"  // 1743
+    "PANASONICLKE\0"  // 1756
+    "PANASONICNKE\0"  // 1769
+    "PANASONICPKR\0"  // 1782
+    "PANASONICRKR\0"  // 1795
+    "Power Bouton\0"  // 1808
+    "Power Button\0"  // 1821
+    "Power Toggle\0"  // 1834
+    "Sensore Temp\0"  // 1847
+    "Setzen Timer\0"  // 1860
+    "Sinistra Max\0"  // 1873
+    "Spento Timer\0"  // 1886
+    "Turbo Toggle\0"  // 1899
+    "Upper-Middle\0"  // 1912
+    "Ventillateur\0"  // 1925
+    "Ventola Only\0"  // 1938
+    "Weekly Timer\0"  // 1951
+    "solo_ventola\0"  // 1964
+    "10C Chaleur\0"  // 1977
+    "AKB73757604\0"  // 1989
+    "AKB74955603\0"  // 2001
+    "AKB75215403\0"  // 2013
+    "Automatique\0"  // 2025
+    "Automatisch\0"  // 2037
+    "DESCONOCIDO\0"  // 2049
+    "Derecha Max\0"  // 2061
+    "Eco Alterna\0"  // 2073
+    "Le plus bas\0"  // 2085
+    "Luz Palanca\0"  // 2097
+    "LüfterOnly\0"  // 2109
+    "Max Derecha\0"  // 2121
+    "MaxSinistra\0"  // 2133
+    "Oben-Mittel\0"  // 2145
+    "Occhio Auto\0"  // 2157
+    "Pause Timer\0"  // 2169
+    "Poder Boton\0"  // 2181
+    "Répetition\0"  // 2193
+    "SCONOSCIUTO\0"  // 2205
+    "Sauvegarder\0"  // 2217
+    "Sensor Temp\0"  // 2229
+    "SinistraMax\0"  // 2241
+    "Sleep Timer\0"  // 2253
+    "Sonno Timer\0"  // 2265
+    "Temp Hinauf\0"  // 2277
+    "Timer Modus\0"  // 2289
+    "VentolaOnly\0"  // 2301
+    "Verschieben\0"  // 2313
+    "Wiederholen\0"  // 2325
+    "Zirkulieren\0"  // 2337
+    "Zona Seguir\0"  // 2349
+    "Zone Follow\0"  // 2361
+    "nur_lüfter\0"  // 2373
+    "10C Heizen\0"  // 2385
+    "8C Chaleur\0"  // 2396
+    "Accensione\0"  // 2407
+    "Automatico\0"  // 2418
+    "Bassissimo\0"  // 2429
+    "Changement\0"  // 2440
+    "Dehumidify\0"  // 2451
+    "DerechaMax\0"  // 2462
+    "Destra Max\0"  // 2473
+    "Droite Max\0"  // 2484
+    "En dessous\0"  // 2495
+    "En-dessous\0"  // 2506
+    "Gauche Max\0"  // 2517
+    "Gesundheit\0"  // 2528
+    "Maintenant\0"  // 2539
+    "Max Destra\0"  // 2550
+    "Max Droite\0"  // 2561
+    "Max Gauche\0"  // 2572
+    "Max Rechts\0"  // 2583
+    "MaxDerecha\0"  // 2594
+    "Molto alto\0"  // 2605
+    "Oscilar(H)\0"  // 2616
+    "Oscilar(V)\0"  // 2627
+    "Protocollo\0"  // 2638
+    "Rechts Max\0"  // 2649
+    "Timer Mode\0"  // 2660
+    "V9014557-A\0"  // 2671
+    "V9014557-B\0"  // 2682
+    "Ventilador\0"  // 2693
+    "10C Caldo\0"  // 2704
+    "10C Calor\0"  // 2714
+    "6ter Sens\0"  // 2724
+    "6ter Sinn\0"  // 2734
+    "6th Sense\0"  // 2744
+    "8C Heizen\0"  // 2754
+    "Abbrechen\0"  // 2764
+    "Au dessus\0"  // 2774
+    "Au-dessus\0"  // 2784
+    "Auge Auto\0"  // 2794
+    "Aus Timer\0"  // 2804
+    "Automatic\0"  // 2814
+    "Circolare\0"  // 2824
+    "Circulate\0"  // 2834
+    "DestraMax\0"  // 2844
+    "DroiteMax\0"  // 2854
+    "Ein Timer\0"  // 2864
+    "Encendido\0"  // 2874
+    "GaucheMax\0"  // 2884
+    "Humidité\0"  // 2894
+    "Inferiore\0"  // 2904
+    "Links Max\0"  // 2914
+    "Maintenir\0"  // 2924
+    "Max Links\0"  // 2934
+    "Max Right\0"  // 2944
+    "MaxDestra\0"  // 2954
+    "MaxDroite\0"  // 2964
+    "MaxGauche\0"  // 2974
+    "MaxRechts\0"  // 2984
+    "Oeil Auto\0"  // 2994
+    "Off Timer\0"  // 3004
+    "Plein air\0"  // 3014
+    "Protocole\0"  // 3024
+    "Protocolo\0"  // 3034
+    "Protokoll\0"  // 3044
+    "Puissance\0"  // 3054
+    "Purificar\0"  // 3064
+    "RechtsMax\0"  // 3074
+    "Right Max\0"  // 3084
+    "Set Timer\0"  // 3094
+    "Speichern\0"  // 3104
+    "Superiore\0"  // 3114
+    "TAC09CHSD\0"  // 3124
+    "Temp Down\0"  // 3134
+    "Temp Giù\0"  // 3144
+    "UNBEKANNT\0"  // 3154
+    "10C Heat\0"  // 3164
+    "8C Caldo\0"  // 3173
+    "8C Calor\0"  // 3182
+    "Air Flow\0"  // 3191
+    "Cancelar\0"  // 3200
+    "Circular\0"  // 3209
+    "Comenzar\0"  // 3218
+    "DG11J104\0"  // 3227
+    "DG11J13A\0"  // 3236
+    "DG11J191\0"  // 3245
+    "Draussen\0"  // 3254
+    "Economie\0"  // 3263
+    "Eye Auto\0"  // 3272
+    "Fan Only\0"  // 3281
+    "Frischen\0"  // 3290
+    "GZ055BE1\0"  // 3299
+    "Höchste\0"  // 3308
+    "Indirect\0"  // 3317
+    "Inferior\0"  // 3326
+    "KKG29AC1\0"  // 3335
+    "Left Max\0"  // 3344
+    "LinksMax\0"  // 3353
+    "Lumière\0"  // 3362
+    "Mantener\0"  // 3371
+    "Mantieni\0"  // 3380
+    "Mas Alto\0"  // 3389
+    "Mas Bajo\0"  // 3398
+    "Max Left\0"  // 3407
+    "MaxLinks\0"  // 3416
+    "MaxRight\0"  // 3425
+    "Med-Alto\0"  // 3434
+    "Med-Haut\0"  // 3443
+    "Med-High\0"  // 3452
+    "Mit-Hoch\0"  // 3461
+    "Nettoyer\0"  // 3470
+    "Ojo Auto\0"  // 3479
+    "On Timer\0"  // 3488
+    "Orologio\0"  // 3497
+    "Poderoso\0"  // 3506
+    "Powerful\0"  // 3515
+    "Protocol\0"  // 3524
+    "Purifica\0"  // 3533
+    "Purifier\0"  // 3542
+    "Reinigen\0"  // 3551
+    "RightMax\0"  // 3560
+    "Rumoroso\0"  // 3569
+    "Schedule\0"  // 3578
+    "Schimmel\0"  // 3587
+    "Schlafen\0"  // 3596
+    "Secondes\0"  // 3605
+    "Secondis\0"  // 3614
+    "Segundos\0"  // 3623
+    "Sekunden\0"  // 3632
+    "Seul_fan\0"  // 3641
+    "Soffitto\0"  // 3650
+    "Superior\0"  // 3659
+    "Swing(H)\0"  // 3668
+    "Swing(O)\0"  // 3677
+    "Swing(V)\0"  // 3686
+    "Wechseln\0"  // 3695
+    "fan-only\0"  // 3704
+    "fan_only\0"  // 3713
+    "8C Heat\0"  // 3722
+    "ARRAH2E\0"  // 3730
+    "ARREB1E\0"  // 3738
+    "ARREW4E\0"  // 3746
+    "Annuler\0"  // 3754
+    "Annulla\0"  // 3762
+    "Apagado\0"  // 3770
+    "Cambiar\0"  // 3778
+    "Ceiling\0"  // 3786
+    "Celsius\0"  // 3794
+    "Comando\0"  // 3802
+    "Comfort\0"  // 3810
+    "Command\0"  // 3818
+    "Confort\0"  // 3826
+    "Control\0"  // 3834
+    "Cooling\0"  // 3842
+    "Ebauche\0"  // 3850
+    "Esterno\0"  // 3858
+    "FanOnly\0"  // 3866
+    "Fixiert\0"  // 3874
+    "Giornos\0"  // 3882
+    "Guardar\0"  // 3890
+    "Heating\0"  // 3898
+    "Highest\0"  // 3906
+    "INCONNU\0"  // 3914
+    "Imposta\0"  // 3922
+    "KKG9AC1\0"  // 3930
+    "Komfort\0"  // 3938
+    "Kühlen\0"  // 3946
+    "Langsam\0"  // 3954
+    "LeftMax\0"  // 3962
+    "Leggero\0"  // 3970
+    "Limpiar\0"  // 3978
+    "Luftzug\0"  // 3986
+    "Lüfter\0"  // 3994
+    "Manuale\0"  // 4002
+    "Manuell\0"  // 4010
+    "Massimo\0"  // 4018
+    "MaxLeft\0"  // 4026
+    "Maximum\0"  // 4034
+    "Minimum\0"  // 4042
+    "Minuten\0"  // 4050
+    "Minutes\0"  // 4058
+    "Minutis\0"  // 4066
+    "Minutos\0"  // 4074
+    "Modello\0"  // 4082
+    "Oscilar\0"  // 4090
+    "Outside\0"  // 4098
+    "Plafond\0"  // 4106
+    "Pulizia\0"  // 4114
+    "Recycle\0"  // 4122
+    "Repetir\0"  // 4130
+    "Ruidoso\0"  // 4138
+    "Schnell\0"  // 4146
+    "Schritt\0"  // 4154
+    "Seconde\0"  // 4162
+    "Secondi\0"  // 4170
+    "Seconds\0"  // 4178
+    "Segundo\0"  // 4186
+    "Sekunde\0"  // 4194
+    "Sensore\0"  // 4202
+    "Special\0"  // 4210
+    "Stunden\0"  // 4218
+    "Temp Su\0"  // 4226
+    "Temp Up\0"  // 4234
+    "Tiefste\0"  // 4242
+    "Trocken\0"  // 4250
+    "UNKNOWN\0"  // 4258
+    "Ventola\0"  // 4266
+    "122LZF\0"  // 4274
+    "Acceso\0"  // 4281
+    "Adesso\0"  // 4288
+    "Afuera\0"  // 4295
+    "Befehl\0"  // 4302
+    "Bottom\0"  // 4309
+    "Breeze\0"  // 4316
+    "Cambia\0"  // 4323
+    "Camera\0"  // 4330
+    "Cancel\0"  // 4337
+    "Center\0"  // 4344
+    "Centre\0"  // 4351
+    "Centro\0"  // 4358
+    "Change\0"  // 4365
+    "Cierto\0"  // 4372
+    "Codice\0"  // 4379
+    "Codigo\0"  // 4386
+    "Comodo\0"  // 4393
+    "Config\0"  // 4400
+    "Cuarto\0"  // 4407
+    "Direct\0"  // 4414
+    "Dormir\0"  // 4421
+    "Drying\0"  // 4428
+    "Falsch\0"  // 4435
+    "Feucht\0"  // 4442
+    "Filter\0"  // 4449
+    "Filtro\0"  // 4456
+    "Folgen\0"  // 4463
+    "Fresco\0"  // 4470
+    "Frisch\0"  // 4477
+    "Giorno\0"  // 4484
+    "Halten\0"  // 4491
+    "Health\0"  // 4498
+    "Heures\0"  // 4505
+    "Humedo\0"  // 4512
+    "Inside\0"  // 4519
+    "Lowest\0"  // 4526
+    "Manual\0"  // 4533
+    "Manuel\0"  // 4540
+    "Maximo\0"  // 4547
+    "Medium\0"  // 4554
+    "Mettre\0"  // 4561
+    "Minimo\0"  // 4568
+    "Minute\0"  // 4575
+    "Minuti\0"  // 4582
+    "Minuto\0"  // 4589
+    "Modelo\0"  // 4596
+    "Occhio\0"  // 4603
+    "Pièce\0"  // 4610
+    "Purify\0"  // 4617
+    "Rapide\0"  // 4624
+    "Rapido\0"  // 4631
+    "Repeat\0"  // 4638
+    "Ripeti\0"  // 4645
+    "Santé\0"  // 4652
+    "Second\0"  // 4659
+    "Sensor\0"  // 4666
+    "Setzen\0"  // 4673
+    "Silent\0"  // 4680
+    "Spento\0"  // 4687
+    "Stunde\0"  // 4694
+    "Suivre\0"  // 4701
+    "Ultimo\0"  // 4708
+    "Veloce\0"  // 4715
+    "YX1FSF\0"  // 4722
+    "ARDB1\0"  // 4729
+    "ARJW2\0"  // 4735
+    "ARRY4\0"  // 4741
+    "Ahora\0"  // 4747
+    "Ancho\0"  // 4753
+    "Avvia\0"  // 4759
+    "Basso\0"  // 4765
+    "Breit\0"  // 4771
+    "Brisa\0"  // 4777
+    "Brise\0"  // 4783
+    "Clean\0"  // 4789
+    "Clock\0"  // 4795
+    "Decke\0"  // 4801
+    "Econo\0"  // 4807
+    "Etape\0"  // 4813
+    "False\0"  // 4819
+    "Falso\0"  // 4825
+    "Ferma\0"  // 4831
+    "Fijar\0"  // 4837
+    "Fisso\0"  // 4843
+    "Fixed\0"  // 4849
+    "Fixer\0"  // 4855
+    "Fondo\0"  // 4861
+    "Forte\0"  // 4867
+    "Frais\0"  // 4873
+    "Fresh\0"  // 4879
+    "Heure\0"  // 4885
+    "Horas\0"  // 4891
+    "Hours\0"  // 4897
+    "Humid\0"  // 4903
+    "IFeel\0"  // 4909
+    "Innen\0"  // 4915
+    "Jetzt\0"  // 4921
+    "Jours\0"  // 4927
+    "Knopf\0"  // 4933
+    "Large\0"  // 4939
+    "Largo\0"  // 4945
+    "Lento\0"  // 4951
+    "Licht\0"  // 4957
+    "Light\0"  // 4963
+    "Lower\0"  // 4969
+    "Mitte\0"  // 4975
+    "Model\0"  // 4981
+    "Molde\0"  // 4987
+    "Mould\0"  // 4993
+    "Moule\0"  // 4999
+    "Mover\0"  // 5005
+    "Moyen\0"  // 5011
+    "Muffa\0"  // 5017
+    "Muovi\0"  // 5023
+    "Nacht\0"  // 5029
+    "Night\0"  // 5035
+    "Noche\0"  // 5041
+    "Notte\0"  // 5047
+    "Parar\0"  // 5053
+    "Pared\0"  // 5059
+    "Passo\0"  // 5065
+    "Pause\0"  // 5071
+    "Poder\0"  // 5077
+    "Reloj\0"  // 5083
+    "Salud\0"  // 5089
+    "Salva\0"  // 5095
+    "Secco\0"  // 5101
+    "Segui\0"  // 5107
+    "Sleep\0"  // 5113
+    "Sonno\0"  // 5119
+    "Stark\0"  // 5125
+    "Start\0"  // 5131
+    "Super\0"  // 5137
+    "Swing\0"  // 5143
+    "Techo\0"  // 5149
+    "Turbo\0"  // 5155
+    "Umido\0"  // 5161
+    "Unten\0"  // 5167
+    "Upper\0"  // 5173
+    "Value\0"  // 5179
+    "WREM2\0"  // 5185
+    "WREM3\0"  // 5191
+    "YAW1F\0"  // 5197
+    "YBOFB\0"  // 5203
+    "A705\0"  // 5209
+    "A903\0"  // 5214
+    "A907\0"  // 5219
+    "Auge\0"  // 5224
+    "Beep\0"  // 5229
+    "Bits\0"  // 5234
+    "Code\0"  // 5239
+    "Cool\0"  // 5244
+    "Dias\0"  // 5249
+    "Fast\0"  // 5254
+    "Faux\0"  // 5259
+    "Fijo\0"  // 5264
+    "Fort\0"  // 5269
+    "Frio\0"  // 5274
+    "Hold\0"  // 5279
+    "Hora\0"  // 5284
+    "Hour\0"  // 5289
+    "ISee\0"  // 5294
+    "Ioni\0"  // 5299
+    "Jour\0"  // 5304
+    "Last\0"  // 5309
+    "Laut\0"  // 5314
+    "Lent\0"  // 5319
+    "Lock\0"  // 5324
+    "Loud\0"  // 5329
+    "Mold\0"  // 5334
+    "Move\0"  // 5339
+    "Muro\0"  // 5344
+    "Nein\0"  // 5349
+    "Nuit\0"  // 5354
+    "Oben\0"  // 5359
+    "Oeil\0"  // 5364
+    "Ores\0"  // 5369
+    "Paso\0"  // 5374
+    "Piep\0"  // 5379
+    "Raum\0"  // 5384
+    "Room\0"  // 5389
+    "Save\0"  // 5394
+    "Seco\0"  // 5399
+    "Slow\0"  // 5404
+    "Step\0"  // 5409
+    "Stop\0"  // 5414
+    "Tage\0"  // 5419
+    "Tief\0"  // 5424
+    "Tope\0"  // 5429
+    "True\0"  // 5434
+    "Type\0"  // 5439
+    "Vane\0"  // 5444
+    "Vero\0"  // 5449
+    "Vrai\0"  // 5454
+    "Wahr\0"  // 5459
+    "Wall\0"  // 5464
+    "Wand\0"  // 5469
+    "WiFi\0"  // 5474
+    "Wide\0"  // 5479
+    "XFan\0"  // 5484
+    "Aus\0"  // 5489
+    "Bas\0"  // 5493
+    "Bip\0"  // 5497
+    "Bit\0"  // 5501
+    "CH#\0"  // 5505
+    "Day\0"  // 5509
+    "Dia\0"  // 5513
+    "Dry\0"  // 5517
+    "Eco\0"  // 5521
+    "Ein\0"  // 5525
+    "Eye\0"  // 5529
+    "Ion\0"  // 5533
+    "Key\0"  // 5537
+    "Low\0"  // 5541
+    "Luz\0"  // 5545
+    "Med\0"  // 5549
+    "Mid\0"  // 5553
+    "Min\0"  // 5557
+    "Mit\0"  // 5561
+    "Mur\0"  // 5565
+    "N/A\0"  // 5569
+    "N/D\0"  // 5573
+    "Non\0"  // 5577
+    "Now\0"  // 5581
+    "Off\0"  // 5585
+    "Ojo\0"  // 5589
+    "Ore\0"  // 5593
+    "Oui\0"  // 5597
+    "Sec\0"  // 5601
+    "Set\0"  // 5605
+    "Sì\0"  // 5609
+    "Tag\0"  // 5613
+    "Top\0"  // 5617
+    "Uhr\0"  // 5621
+    "Yes\0"  // 5625
+    " (\0"  // 5629
+    ", \0"  // 5632
+    "3D\0"  // 5635
+    ": \0"  // 5638
+    "Hi\0"  // 5641
+    "Id\0"  // 5644
+    "Ja\0"  // 5647
+    "Lo\0"  // 5650
+    "No\0"  // 5653
+    "On\0"  // 5656
+    "Si\0"  // 5659
+    "-\0"  // 5662
+    "0\0"  // 5664
+    "H\0";  // 5666
+
+/// Offset in `kIrTextPool` of each string, per locale.
+static const uint16_t kIrTextPoolIndex[kIrTextPoolLocales][kIrTextPoolEntries]
+    PROGMEM = {
+    {  // en-AU
+        4258, 3524, 1215, 5656, 5585, 3252, 5664, 98, 1076, 5155, 5137, 5113,
+        4963, 3515, 1431, 4807, 5143, 3668, 3686, 5229, 2361, 4849, 4993, 4789,
+        4617, 317, 3488, 3004, 2660, 4795, 3818, 4400, 3834, 5484, 4498, 4981,
+        1582, 1600, 4909, 4903, 5394, 5529, 2366, 5533, 4879, 5279, 1827, 3722,
+        3164, 5294, 1131, 80, 4414, 3317, 5035, 4680, 4449, 5635, 3794, 464,
+        4234, 3134, 5131, 5414, 5339, 5605, 4337, 4239, 3139, 4365, 3810, 4666,
+        1951, 5474, 5309, 5254, 5404, 3191, 5409, 5569, 4519, 4098, 5329, 4969,
+        5173, 1912, 4316, 2834, 3786, 5464, 5389, 2744, 5439, 4210, 5644, 5444,
+        5324, 2164, 2814, 4533, 5244, 3842, 3168, 3898, 5517, 4428, 2451, 5485,
+        3704, 3713, 3281, 3866, 4122, 1391, 4034, 5557, 4042, 3452, 5549, 4554,
+        3906, 3456, 5641, 5553, 1918, 5541, 5650, 4526, 2944, 3425, 3084, 3560,
+        2948, 3411, 3407, 4026, 3344, 3962, 5479, 4351, 5617, 4309, 1587, 3272,
+        1639, 1423, 1834, 1821, 1206, 1574, 2229, 2253, 1465, 1067, 1899, 3094,
+        3578, 5505, 1099, 5537, 5179, 5629, 5632, 5638, 5662, 5509, 1110, 5289,
+        4897, 4575, 4058, 4659, 4178, 5581, 259, 5625, 5653, 5434, 4819, 4638,
+        5239, 5234, 5197, 5203, 4722, 2671, 2682, 1221, 1236, 3730, 4729, 3738,
+        4735, 4741, 3746, 1353, 2013, 2001, 1989, 1395, 3930, 3335, 1765, 1778,
+        1739, 1791, 1752, 1726, 1804, 1756, 1769, 1730, 1782, 1743, 1717, 1795,
+        5219, 5209, 5214, 3124, 3299, 4274, 3236, 3227, 3245, 5185, 5191, 935,
+        952,
+    },
+    {  // en-US
+        4258, 3524, 1215, 5656, 5585, 3252, 5664, 98, 1076, 5155, 5137, 5113,
+        4963, 3515, 1431, 4807, 5143, 3668, 3686, 5229, 2361, 4849, 5334, 4789,
+        4617, 317, 3488, 3004, 2660, 4795, 3818, 4400, 3834, 5484, 4498, 4981,
+        1582, 1600, 4909, 4903, 5394, 5529, 2366, 5533, 4879, 5279, 1827, 3722,
+        3164, 5294, 1131, 80, 4414, 3317, 5035, 4680, 4449, 5635, 3794, 464,
+        4234, 3134, 5131, 5414, 5339, 5605, 4337, 4239, 3139, 4365, 3810, 4666,
+        1951, 5474, 5309, 5254, 5404, 3191, 5409, 5569, 4519, 4098, 5329, 4969,
+        5173, 1912, 4316, 2834, 3786, 5464, 5389, 2744, 5439, 4210, 5644, 5444,
+        5324, 2164, 2814, 4533, 5244, 3842, 3168, 3898, 5517, 4428, 2451, 5485,
+        3704, 3713, 3281, 3866, 4122, 1391, 4034, 5557, 4042, 3452, 5549, 4554,
+        3906, 3456, 5641, 5553, 1918, 5541, 5650, 4526, 2944, 3425, 3084, 3560,
+        2948, 3411, 3407, 4026, 3344, 3962, 5479, 4344, 5617, 4309, 1587, 3272,
+        1639, 1423, 1834, 1821, 1206, 1574, 2229, 2253, 1465, 1067, 1899, 3094,
+        3578, 5505, 1099, 5537, 5179, 5629, 5632, 5638, 5662, 5509, 1110, 5289,
+        4897, 4575, 4058, 4659, 4178, 5581, 259, 5625, 5653, 5434, 4819, 4638,
+        5239, 5234, 5197, 5203, 4722, 2671, 2682, 1221, 1236, 3730, 4729, 3738,
+        4735, 4741, 3746, 1353, 2013, 2001, 1989, 1395, 3930, 3335, 1765, 1778,
+        1739, 1791, 1752, 1726, 1804, 1756, 1769, 1730, 1782, 1743, 1717, 1795,
+        5219, 5209, 5214, 3124, 3299, 4274, 3236, 3227, 3245, 5185, 5191, 935,
+        952,
+    },
+    {  // de-DE
+        3154, 3044, 1215, 5525, 5489, 3252, 5664, 74, 434, 5155, 5137, 3596,
+        4957, 5125, 1155, 5521, 5143, 3668, 3686, 5379, 2361, 3874, 3587, 3551,
+        3290, 317, 2864, 2804, 2289, 5621, 4302, 4400, 3834, 5484, 2528, 4981,
+        1582, 1600, 4909, 4442, 3104, 5224, 4463, 5533, 4477, 4491, 4933, 2754,
+        2385, 5294, 1131, 56, 4414, 3317, 5029, 1155, 4449, 5635, 3794, 464,
+        2277, 1479, 5131, 5414, 2313, 4673, 2764, 2282, 1484, 3695, 3938, 4666,
+        635, 5474, 5309, 4146, 3954, 3986, 4154, 5569, 4915, 3254, 5314, 5167,
+        5359, 2145, 4783, 2337, 4801, 5469, 5384, 2734, 5439, 4210, 5644, 5444,
+        5324, 2164, 2037, 4010, 3946, 3842, 2389, 3898, 4250, 4428, 2451, 3994,
+        2373, 3713, 1652, 2109, 4122, 1391, 4034, 5557, 4042, 3461, 5561, 2150,
+        3308, 3465, 5666, 1365, 2150, 5424, 3162, 4242, 2583, 2984, 2649, 3074,
+        2587, 2938, 2934, 3416, 2914, 3353, 4771, 4975, 5359, 5167, 1161, 2794,
+        833, 1146, 884, 1704, 28, 654, 2229, 1251, 1281, 425, 969, 1860, 3578,
+        5505, 1099, 5537, 5179, 5629, 5632, 5638, 5662, 5613, 5419, 4694, 4218,
+        4575, 4050, 4194, 3632, 4921, 237, 5647, 5349, 5459, 4435, 2325, 5239,
+        5234, 5197, 5203, 4722, 2671, 2682, 1221, 1236, 3730, 4729, 3738, 4735,
+        4741, 3746, 1353, 2013, 2001, 1989, 1395, 3930, 3335, 1765, 1778, 1739,
+        1791, 1752, 1726, 1804, 1756, 1769, 1730, 1782, 1743, 1717, 1795, 5219,
+        5209, 5214, 3124, 3299, 4274, 3236, 3227, 3245, 5185, 5191, 935, 952,
+    },
+    {  // es-ES
+        2049, 3034, 5077, 2874, 3770, 3252, 5664, 121, 551, 5155, 5137, 4421,
+        5545, 3506, 1010, 4807, 4090, 2616, 2627, 5497, 2349, 5264, 4987, 3978,
+        3064, 136, 126, 281, 780, 5083, 3802, 4400, 3834, 5484, 5089, 4596, 393,
+        1600, 4909, 4512, 3890, 5589, 2354, 5533, 4470, 3371, 2187, 3182, 2714,
+        5294, 1131, 103, 4414, 3317, 5041, 1010, 4456, 5635, 3794, 464, 597,
+        744, 3218, 5053, 5005, 4837, 3200, 609, 756, 3778, 4393, 4666, 323,
+        5474, 4708, 4631, 4951, 1325, 5374, 5569, 4519, 4295, 4138, 3326, 3659,
+        1266, 4777, 3209, 5149, 5059, 4407, 1535, 5439, 4210, 5644, 5444, 5324,
+        2164, 2418, 4533, 5274, 3842, 2718, 3898, 5399, 4428, 2451, 2693, 344,
+        3713, 1115, 1296, 4122, 1391, 4547, 5557, 4568, 3434, 5549, 1061, 3389,
+        3393, 3393, 1061, 1061, 3402, 3402, 3398, 2121, 2594, 2061, 2462, 2125,
+        1413, 1409, 1678, 1381, 1613, 4753, 4358, 5429, 4861, 1311, 3479, 2097,
+        1003, 1437, 2181, 1191, 385, 559, 405, 1035, 540, 1521, 521, 3578, 5505,
+        1099, 5537, 5179, 5629, 5632, 5638, 5662, 5513, 5249, 5284, 4891, 4589,
+        4074, 4186, 3623, 4747, 193, 5659, 5653, 4372, 4825, 4130, 4386, 5234,
+        5197, 5203, 4722, 2671, 2682, 1221, 1236, 3730, 4729, 3738, 4735, 4741,
+        3746, 1353, 2013, 2001, 1989, 1395, 3930, 3335, 1765, 1778, 1739, 1791,
+        1752, 1726, 1804, 1756, 1769, 1730, 1782, 1743, 1717, 1795, 5219, 5209,
+        5214, 3124, 3299, 4274, 3236, 3227, 3245, 5185, 5191, 935, 952,
+    },
+    {  // fr-FR
+        3914, 3024, 1215, 5656, 5585, 3252, 5664, 98, 825, 5155, 5137, 5071,
+        3362, 3054, 700, 3263, 5143, 3668, 3686, 5497, 2361, 4855, 4999, 3470,
+        3542, 317, 3488, 3004, 2660, 4885, 1561, 4400, 3834, 5484, 4652, 4981,
+        491, 1600, 4909, 2894, 2217, 5364, 4701, 5533, 4873, 2924, 1814, 2396,
+        1977, 5294, 1131, 80, 4414, 3317, 5354, 700, 4449, 5635, 3794, 464, 616,
+        762, 5131, 5414, 5339, 4561, 3754, 627, 773, 2440, 3826, 4666, 302,
+        5474, 5309, 4624, 5319, 3850, 4813, 5569, 4519, 3014, 5269, 2495, 2774,
+        672, 4783, 1176, 4106, 5565, 4610, 2724, 5439, 4210, 5644, 5444, 5324,
+        2164, 2025, 4540, 4873, 3842, 1981, 3898, 5601, 4428, 2451, 1925, 3641,
+        3713, 798, 986, 4122, 1391, 4034, 5557, 4042, 3443, 5549, 5011, 1626,
+        3447, 5666, 1365, 682, 5493, 967, 2085, 2561, 2964, 2484, 2854, 2565,
+        2576, 2572, 2974, 2517, 2884, 4939, 4351, 2784, 2506, 816, 2994, 850,
+        690, 1451, 1808, 867, 483, 708, 2169, 1465, 918, 1507, 1691, 3578, 5505,
+        1099, 5537, 5179, 5629, 5632, 5638, 5662, 5304, 4927, 4885, 4505, 4575,
+        4058, 4162, 3605, 2539, 215, 5597, 5577, 5454, 5259, 2193, 5239, 5234,
+        5197, 5203, 4722, 2671, 2682, 1221, 1236, 3730, 4729, 3738, 4735, 4741,
+        3746, 1353, 2013, 2001, 1989, 1395, 3930, 3335, 1765, 1778, 1739, 1791,
+        1752, 1726, 1804, 1756, 1769, 1730, 1782, 1743, 1717, 1795, 5219, 5209,
+        5214, 3124, 3299, 4274, 3236, 3227, 3245, 5185, 5191, 935, 952,
+    },
+    {  // it-IT
+        2205, 2638, 2407, 4281, 4687, 3252, 5664, 18, 456, 5155, 5137, 5119,
+        3970, 4867, 510, 5521, 5143, 3677, 3686, 5229, 2361, 4843, 5017, 4114,
+        3533, 317, 1548, 1886, 1083, 3497, 3802, 4400, 3834, 5484, 4498, 4082,
+        1582, 1600, 4909, 5161, 5095, 4603, 5107, 5299, 4470, 3380, 376, 3173,
+        2704, 5294, 1131, 0, 4414, 3317, 5047, 510, 4456, 5635, 3794, 464, 4226,
+        3144, 4759, 4831, 5023, 3922, 3762, 4231, 3149, 4323, 3810, 4202, 726,
+        5474, 4708, 4715, 4951, 1339, 5065, 5573, 4519, 3858, 3569, 2904, 3114,
+        1051, 4316, 2824, 3650, 5344, 4330, 2744, 5439, 4210, 5644, 5444, 5324,
+        2164, 2418, 4002, 4470, 3842, 2708, 3898, 5101, 4428, 2451, 4266, 1964,
+        3713, 1938, 2301, 4122, 1391, 4018, 5557, 4568, 3434, 5549, 1061, 2605,
+        3393, 5641, 5549, 1061, 4765, 5650, 2429, 2550, 2954, 2473, 2844, 2554,
+        1669, 1665, 2133, 1873, 2241, 4945, 4358, 3114, 2904, 2073, 2157, 1019,
+        502, 445, 365, 149, 1574, 1847, 2265, 578, 901, 1493, 1367, 3578, 5505,
+        1099, 5537, 5179, 5629, 5632, 5638, 5662, 4484, 3882, 5593, 5369, 4582,
+        4066, 4170, 3614, 4288, 171, 5609, 5653, 5449, 4825, 4645, 4379, 5501,
+        5197, 5203, 4722, 2671, 2682, 1221, 1236, 3730, 4729, 3738, 4735, 4741,
+        3746, 1353, 2013, 2001, 1989, 1395, 3930, 3335, 1765, 1778, 1739, 1791,
+        1752, 1726, 1804, 1756, 1769, 1730, 1782, 1743, 1717, 1795, 5219, 5209,
+        5214, 3124, 3299, 4274, 3236, 3227, 3245, 5185, 5191, 935, 952,
+    },
+};
+
+/// The name of each locale in the pool.
+static const char kIrTextPoolLocaleNames[kIrTextPoolLocales][6] PROGMEM = {
+    "en-AU", "en-US", "de-DE", "es-ES", "fr-FR", "it-IT"};
+
+#endif  // LOCALE_POOL_H_
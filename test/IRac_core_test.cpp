@@ -0,0 +1,332 @@
+// Copyright 2026 IRremoteESP8266 project and others
+// Tests for the IRac class's object pool, packed states, zones & text look
+// ups. Kept apart from IRac_test.cpp, as they only need a few A/C protocols.
+
+#include <string>
+#include "ir_LG.h"
+#include "ir_Rhoss.h"
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRrecv_test.h"
+#include "IRremoteESP8266.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "gtest/gtest.h"
+
+// Find the pooled A/C object (if any) for a protocol & model.
+IRacPoolEntry *findPooled(IRac *irac, const decode_type_t protocol,
+                          const int16_t model) {
+  for (uint8_t i = 0; i < kIrAcPoolSize; i++)
+    if (irac->_pool[i].ac != NULL && irac->_pool[i].protocol == protocol &&
+        irac->_pool[i].model == model)
+      return &irac->_pool[i];
+  return NULL;
+}
+
+TEST(TestIRac, PackedState) {
+  EXPECT_EQ(16, sizeof(stdAc::packed_state_t));
+  stdAc::state_t a, b;
+  IRac::initState(&a);
+  // Defaults survive the round trip.
+  b = IRac::unpackState(IRac::packState(a));
+  EXPECT_FALSE(IRac::cmpStates(a, b));
+  EXPECT_EQ(a.clock, b.clock);
+  EXPECT_EQ(kNoTempValue, b.sensorTemperature);
+
+  a.protocol = decode_type_t::kLastDecodeType;
+  a.model = -32768;
+  a.power = true;
+  a.mode = stdAc::opmode_t::kLastOpmodeEnum;
+  a.degrees = 77.25;
+  a.celsius = false;
+  a.fanspeed = stdAc::fanspeed_t::kLastFanspeedEnum;
+  a.swingv = stdAc::swingv_t::kLastSwingvEnum;
+  a.swingh = stdAc::swingh_t::kOff;
+  a.quiet = true;
+  a.turbo = false;
+  a.econo = true;
+  a.light = false;
+  a.filter = true;
+  a.clean = false;
+  a.beep = true;
+  a.sleep = 32767;
+  a.clock = 1439;
+  a.command = stdAc::ac_command_t::kLastAcCommandEnum;
+  a.iFeel = true;
+  a.sensorTemperature = -12.3;
+  b = IRac::unpackState(IRac::packState(a));
+  EXPECT_FALSE(IRac::cmpStates(a, b));
+  EXPECT_EQ(a.degrees, b.degrees);
+  EXPECT_EQ(a.sensorTemperature, b.sensorTemperature);
+  EXPECT_EQ(a.clock, b.clock);
+  EXPECT_EQ(a.protocol, b.protocol);
+  a.protocol = decode_type_t::UNKNOWN;
+  a.mode = stdAc::opmode_t::kOff;
+  a.swingv = stdAc::swingv_t::kOff;
+  a.swingh = stdAc::swingh_t::kLastSwinghEnum;
+  b = IRac::unpackState(IRac::packState(a));
+  EXPECT_FALSE(IRac::cmpStates(a, b));
+
+  // Packed comparisons & hashes agree with the normal comparison.
+  stdAc::packed_state_t pa = IRac::packState(a);
+  stdAc::packed_state_t pb = IRac::packState(a);
+  EXPECT_FALSE(IRac::cmpStates(pa, pb));
+  EXPECT_EQ(IRac::hashState(pa), IRac::hashState(pb));
+  b = a;
+  b.clock = 0;  // The clock is ignored.
+  pb = IRac::packState(b);
+  EXPECT_FALSE(IRac::cmpStates(pa, pb));
+  EXPECT_EQ(IRac::hashState(pa), IRac::hashState(pb));
+  b = a;
+  b.degrees = 77.5;
+  pb = IRac::packState(b);
+  EXPECT_TRUE(IRac::cmpStates(pa, pb));
+  EXPECT_NE(IRac::hashState(pa), IRac::hashState(pb));
+  b = a;
+  b.iFeel = false;
+  pb = IRac::packState(b);
+  EXPECT_TRUE(IRac::cmpStates(pa, pb));
+  EXPECT_NE(IRac::hashState(pa), IRac::hashState(pb));
+  b = a;
+  b.model = 1;
+  EXPECT_TRUE(IRac::cmpStates(pa, IRac::packState(b)));
+
+  // Temperatures that don't fit are limited.
+  a.degrees = 1000;
+  EXPECT_EQ(327.67f, IRac::unpackState(IRac::packState(a)).degrees);
+}
+
+TEST(TestIRac, ObjectPool) {
+  IRac irac(kGpioUnused);
+  stdAc::state_t lg, rhoss;
+  IRac::initState(&lg);
+  lg.protocol = decode_type_t::LG;
+  lg.model = lg_ac_remote_model_t::GE6711AR2853M;
+  lg.power = true;
+  lg.mode = stdAc::opmode_t::kCool;
+  lg.degrees = 24;
+  rhoss = lg;
+  rhoss.protocol = decode_type_t::RHOSS;
+  rhoss.model = -1;
+
+  // The unit test versions of the A/C objects are too large for the default
+  // budget, so nothing should be kept.
+  EXPECT_EQ(kIrAcPoolBudget, irac.getPoolBudget());
+  ASSERT_TRUE(irac.sendAc(lg));
+  EXPECT_EQ(0, irac.getPoolFootprint());
+
+  irac.setPoolBudget(sizeof(IRLgAc) + sizeof(IRRhossAc));
+  ASSERT_TRUE(irac.sendAc(lg));
+  EXPECT_EQ(sizeof(IRLgAc), irac.getPoolFootprint());
+  IRacPoolEntry *entry = findPooled(&irac, decode_type_t::LG, lg.model);
+  ASSERT_NE(nullptr, entry);
+  IRLgAc *pooled = static_cast<IRLgAc *>(entry->ac);
+  EXPECT_TRUE(entry->primed);
+  // Sending the same thing again should reuse the object, and produce the
+  // same message as a brand new object does.
+  IRLgAc fresh(kGpioUnused);
+  irac.lg(&fresh, lg_ac_remote_model_t::GE6711AR2853M, true,
+          stdAc::opmode_t::kCool, 24, stdAc::fanspeed_t::kAuto,
+          stdAc::swingv_t::kOff, stdAc::swingv_t::kOff,
+          stdAc::swingh_t::kOff, true);
+  pooled->_irsend.reset();
+  ASSERT_TRUE(irac.sendAc(lg));
+  EXPECT_EQ(entry, findPooled(&irac, decode_type_t::LG, lg.model));
+  EXPECT_EQ(pooled, entry->ac);
+  EXPECT_EQ(fresh._irsend.outputStr(), pooled->_irsend.outputStr());
+  // A change of state re-runs the setters on the same object.
+  lg.degrees = 25;
+  pooled->_irsend.reset();
+  ASSERT_TRUE(irac.sendAc(lg));
+  EXPECT_EQ(pooled, entry->ac);
+  EXPECT_EQ(25, pooled->getTemp());
+  pooled->_irsend.makeDecodeResult();
+  IRrecv capture(kGpioUnused);
+  ASSERT_TRUE(capture.decode(&pooled->_irsend.capture));
+  EXPECT_EQ(decode_type_t::LG, pooled->_irsend.capture.decode_type);
+
+  // Both fit.
+  ASSERT_TRUE(irac.sendAc(rhoss));
+  EXPECT_EQ(sizeof(IRLgAc) + sizeof(IRRhossAc), irac.getPoolFootprint());
+  ASSERT_NE(nullptr, findPooled(&irac, decode_type_t::RHOSS, -1));
+  // A different model is a different object, so the least recently used
+  // object (the first LG) has to go to make room for it.
+  stdAc::state_t lg2 = lg;
+  lg2.protocol = decode_type_t::LG2;
+  lg2.model = lg_ac_remote_model_t::AKB75215403;
+  ASSERT_TRUE(irac.sendAc(lg2));
+  EXPECT_EQ(nullptr, findPooled(&irac, decode_type_t::LG, lg.model));
+  EXPECT_NE(nullptr, findPooled(&irac, decode_type_t::LG2, lg2.model));
+  EXPECT_NE(nullptr, findPooled(&irac, decode_type_t::RHOSS, -1));
+  EXPECT_EQ(sizeof(IRLgAc) + sizeof(IRRhossAc), irac.getPoolFootprint());
+
+  // Shrinking the budget drops the oldest first.
+  irac.setPoolBudget(sizeof(IRLgAc));
+  EXPECT_EQ(nullptr, findPooled(&irac, decode_type_t::RHOSS, -1));
+  EXPECT_NE(nullptr, findPooled(&irac, decode_type_t::LG2, lg2.model));
+
+  // Copies don't share (or copy) the pooled objects.
+  IRac copy(irac);
+  EXPECT_EQ(sizeof(IRLgAc), copy.getPoolBudget());
+  EXPECT_EQ(0, copy.getPoolFootprint());
+  EXPECT_EQ(sizeof(IRLgAc), irac.getPoolFootprint());
+
+  irac.setPoolBudget(0);
+  EXPECT_EQ(0, irac.getPoolFootprint());
+  ASSERT_TRUE(irac.sendAc(lg));
+  EXPECT_EQ(0, irac.getPoolFootprint());
+}
+
+// Models that send extra messages based on the previous state must behave
+// exactly as if a new object was used every time.
+TEST(TestIRac, ObjectPoolWithToggles) {
+  IRac irac(kGpioUnused);
+  irac.setPoolBudget(sizeof(IRLgAc));
+  stdAc::state_t desired, prev;
+  IRac::initState(&desired);
+  desired.protocol = decode_type_t::LG2;
+  desired.model = lg_ac_remote_model_t::AKB73757604;
+  desired.power = true;
+  desired.mode = stdAc::opmode_t::kCool;
+  desired.degrees = 22;
+  desired.swingv = stdAc::swingv_t::kHigh;
+  desired.swingh = stdAc::swingh_t::kAuto;
+  prev = desired;
+  prev.swingv = stdAc::swingv_t::kOff;
+
+  IRLgAc fresh(kGpioUnused);
+  irac.lg(&fresh, lg_ac_remote_model_t::AKB73757604, true,
+          stdAc::opmode_t::kCool, 22, stdAc::fanspeed_t::kAuto,
+          stdAc::swingv_t::kHigh, stdAc::swingv_t::kOff,
+          stdAc::swingh_t::kAuto, true);
+  const std::string expected = fresh._irsend.outputStr();
+  for (uint8_t i = 0; i < 2; i++) {
+    ASSERT_TRUE(irac.sendAc(desired, &prev));
+    IRacPoolEntry *entry = findPooled(&irac, desired.protocol, desired.model);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_FALSE(entry->primed);
+    IRLgAc *pooled = static_cast<IRLgAc *>(entry->ac);
+    EXPECT_EQ(expected, pooled->_irsend.outputStr());
+  }
+}
+
+// The text look ups are hashed, so make sure case is still ignored, the
+// same text can mean different things to different parsers, & near misses
+// don't match.
+TEST(TestIRac, strToEnumsViaLookUpTables) {
+  EXPECT_EQ(stdAc::opmode_t::kAuto, IRac::strToOpmode("aUtOmAtIc"));
+  EXPECT_EQ(stdAc::opmode_t::kFan, IRac::strToOpmode("fan only"));
+  EXPECT_EQ(stdAc::opmode_t::kFan, IRac::strToOpmode("FanOnly"));
+  EXPECT_EQ(stdAc::opmode_t::kDry, IRac::strToOpmode("Dehumidify"));
+  EXPECT_EQ(stdAc::opmode_t::kAuto, IRac::strToOpmode("Dehumidif"));
+  EXPECT_EQ(stdAc::opmode_t::kAuto, IRac::strToOpmode(""));
+  EXPECT_EQ(stdAc::fanspeed_t::kMin, IRac::strToFanspeed("min"));
+  EXPECT_EQ(stdAc::fanspeed_t::kMediumHigh, IRac::strToFanspeed("med-high"));
+  EXPECT_EQ(stdAc::swingv_t::kLowest, IRac::strToSwingV("min"));
+  EXPECT_EQ(stdAc::swingv_t::kMiddle, IRac::strToSwingV("Medium"));
+  EXPECT_EQ(stdAc::swingv_t::kUpperMiddle, IRac::strToSwingV("upper-middle"));
+  EXPECT_EQ(stdAc::swingv_t::kAuto, IRac::strToSwingV("on"));
+  EXPECT_EQ(stdAc::swingh_t::kRightMax, IRac::strToSwingH("max right"));
+  EXPECT_EQ(stdAc::swingh_t::kWide, IRac::strToSwingH("wIDE"));
+  EXPECT_EQ(panasonic_ac_remote_model_t::kPanasonicDke,
+            IRac::strToModel("panasonicpkr"));
+  EXPECT_EQ(whirlpool_ac_remote_model_t::DG11J13A,
+            IRac::strToModel("dg11j104"));
+  EXPECT_EQ(lg_ac_remote_model_t::AKB73757604,
+            IRac::strToModel("Akb73757604"));
+  EXPECT_EQ(stdAc::ac_command_t::kSensorTempReport,
+            IRac::strToCommandType("ifeel"));
+  EXPECT_TRUE(IRac::strToBool("YES"));
+  EXPECT_FALSE(IRac::strToBool("false", true));
+  EXPECT_TRUE(IRac::strToBool("FOOBAR", true));
+}
+
+TEST(TestIRacZones, ChangeDetection) {
+  IRac irac(kGpioUnused);
+  IRacZone storage[3];
+  IRacZones zones(storage, 3);
+  EXPECT_EQ(3, zones.size());
+  for (uint16_t i = 0; i < zones.size(); i++)
+    EXPECT_TRUE(zones.setup(i, &irac));
+  EXPECT_FALSE(zones.setup(3, &irac));
+  stdAc::state_t state;
+  IRac::initState(&state);
+  // Nothing has changed, so there is nothing to send.
+  EXPECT_TRUE(zones.setState(0, state));
+  EXPECT_FALSE(zones.setState(3, state));
+  EXPECT_FALSE(zones.hasStateChanged(0));
+  EXPECT_EQ(0, zones.pending());
+  EXPECT_EQ(0, zones.apply());
+
+  state.protocol = decode_type_t::LG;
+  state.model = lg_ac_remote_model_t::GE6711AR2853M;
+  state.power = true;
+  state.degrees = 22;
+  EXPECT_TRUE(zones.setState(1, state));
+  EXPECT_TRUE(zones.hasStateChanged(1));
+  // Changing it again before it is sent, doesn't queue it twice.
+  state.degrees = 23;
+  EXPECT_TRUE(zones.setState(1, state));
+  EXPECT_EQ(1, zones.pending());
+  EXPECT_EQ(1, zones.apply());
+  EXPECT_EQ(0, zones.pending());
+  EXPECT_FALSE(zones.hasStateChanged(1));
+  EXPECT_EQ(23, zones.getStatePrev(1).degrees);
+  EXPECT_TRUE(zones.getStatePrev(1).power);
+  EXPECT_FALSE(zones.getStatePrev(2).power);
+
+  // Only the clock changed.
+  state.clock = 1234;
+  EXPECT_TRUE(zones.setState(1, state));
+  EXPECT_EQ(0, zones.pending());
+
+  // Changed, then changed back before it was sent.
+  state.degrees = 24;
+  EXPECT_TRUE(zones.setState(1, state));
+  state.degrees = 23;
+  EXPECT_TRUE(zones.setState(1, state));
+  EXPECT_EQ(1, zones.pending());
+  EXPECT_EQ(0, zones.apply());
+  EXPECT_EQ(0, zones.pending());
+
+  // Force it to be sent again.
+  EXPECT_TRUE(zones.resend(1));
+  EXPECT_FALSE(zones.resend(3));
+  EXPECT_EQ(1, zones.apply());
+
+  // Protocols we can't send are dropped.
+  state.protocol = decode_type_t::NEC;
+  EXPECT_TRUE(zones.setState(2, state));
+  EXPECT_EQ(1, zones.pending());
+  EXPECT_EQ(0, zones.apply());
+  EXPECT_EQ(0, zones.pending());
+  EXPECT_TRUE(zones.hasStateChanged(2));
+}
+
+TEST(TestIRacZones, PriorityOrder) {
+  IRac irac(kGpioUnused);
+  IRacZone storage[5];
+  IRacZones zones(storage, 5);
+  EXPECT_TRUE(zones.setup(0, &irac, 3));
+  EXPECT_TRUE(zones.setup(1, &irac, 1));
+  EXPECT_TRUE(zones.setup(2, &irac, 3));
+  EXPECT_TRUE(zones.setup(3, &irac, 0));
+  EXPECT_TRUE(zones.setup(4, &irac, 255));  // Clamped to the lowest priority.
+  stdAc::state_t state;
+  IRac::initState(&state);
+  state.protocol = decode_type_t::RHOSS;
+  state.power = true;
+  const uint16_t order[5] = {4, 2, 0, 1, 3};
+  for (uint16_t i = 0; i < 5; i++) EXPECT_TRUE(zones.setState(order[i], state));
+  EXPECT_EQ(5, zones.pending());
+  // Highest priority first, & in the order they changed within a priority.
+  const uint16_t expected[5] = {3, 1, 2, 0, 4};
+  for (uint16_t i = 0; i < 5; i++) {
+    EXPECT_EQ(1, zones.apply(1));
+    EXPECT_EQ(4 - i, zones.pending());
+    EXPECT_FALSE(zones.hasStateChanged(expected[i]));
+    for (uint16_t j = i + 1; j < 5; j++)
+      EXPECT_TRUE(zones.hasStateChanged(expected[j]));
+  }
+  EXPECT_EQ(0, zones.apply(1));
+}
@@ -0,0 +1,253 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+#include "IRjson.h"
+#include <string.h>
+#include <string>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRrecv_test.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+#include "ir_Rhoss.h"
+#include "gtest/gtest.h"
+
+// Helper for the tests.
+static bool jsonToState(const std::string json, stdAc::state_t *state) {
+  return irjson::jsonToState(json.c_str(), json.length(), state);
+}
+
+TEST(TestIRjson, StateToJson) {
+  stdAc::state_t state;
+  char buffer[512];
+  IRtextSink out(buffer, sizeof(buffer));
+  irjson::stateToJson(&out, state);
+  EXPECT_FALSE(out.overflowed());
+  EXPECT_EQ(
+      "{\"protocol\":\"UNKNOWN\",\"model\":-1,\"command\":\"Control\","
+      "\"power\":\"Off\",\"mode\":\"Off\",\"use_celsius\":\"On\","
+      "\"temp\":25,\"sensortemp\":-100,\"fanspeed\":\"Auto\","
+      "\"swingv\":\"Off\",\"swingh\":\"Off\",\"quiet\":\"Off\","
+      "\"ifeel\":\"Off\",\"turbo\":\"Off\",\"econo\":\"Off\","
+      "\"light\":\"Off\",\"filter\":\"Off\",\"clean\":\"Off\","
+      "\"beep\":\"Off\",\"sleep\":-1,\"clock\":-1}",
+      std::string(buffer));
+
+  IRac::initState(&state, decode_type_t::LG, lg_ac_remote_model_t::AKB74955603,
+                  true, stdAc::opmode_t::kFan, 21.5, true,
+                  stdAc::fanspeed_t::kMedium, stdAc::swingv_t::kAuto,
+                  stdAc::swingh_t::kOff, false, true, false, true, false,
+                  false, false, -1, 12 * 60 + 34);
+  state.sensorTemperature = -0.05;
+  String text;
+  IRtextSink str(&text);
+  irjson::stateToJson(&str, state, true);
+  EXPECT_EQ(
+      "{\"protocol\":\"LG\",\"model\":3,\"command\":\"Control\","
+      "\"power\":\"On\",\"mode\":\"fan_only\",\"use_celsius\":\"On\","
+      "\"temp\":21.5,\"sensortemp\":-0.05,\"fanspeed\":\"Medium\","
+      "\"swingv\":\"Auto\",\"swingh\":\"Off\",\"quiet\":\"Off\","
+      "\"ifeel\":\"Off\",\"turbo\":\"On\",\"econo\":\"Off\","
+      "\"light\":\"On\",\"filter\":\"Off\",\"clean\":\"Off\","
+      "\"beep\":\"Off\",\"sleep\":-1,\"clock\":754}",
+      text);
+  // Home Assistant wants the mode to be off when the power is off.
+  state.power = false;
+  text = "";
+  irjson::stateToJson(&str, state, true);
+  EXPECT_NE(std::string::npos,
+            text.find("\"power\":\"Off\",\"mode\":\"Off\","));
+
+  // A buffer that is too small is never overrun.
+  char small[20];
+  small[sizeof(small) - 1] = 'X';
+  IRtextSink truncated(small, sizeof(small) - 1);
+  irjson::stateToJson(&truncated, state);
+  EXPECT_TRUE(truncated.overflowed());
+  EXPECT_EQ(sizeof(small) - 2, strlen(small));
+  EXPECT_EQ('X', small[sizeof(small) - 1]);
+}
+
+TEST(TestIRjson, JsonToState) {
+  stdAc::state_t state;
+  state.protocol = decode_type_t::LG;
+  state.degrees = 18;
+  // Only the keys that are present change. Unknown keys & values are skipped.
+  EXPECT_TRUE(jsonToState(
+      " {\"power\" : \"on\", \"mode\":\"cooling\", \"temp\":23.25,\n"
+      "\t\"fanspeed\":\"Max\", \"vcc\":{\"a\":[1,2,{\"b\":null}],\"c\":\"}\"},"
+      "\"swingv\":\"Highest\", \"swingh\":\"Nonsense\", \"turbo\":true,"
+      "\"econo\":1, \"light\":\"yes\", \"sleep\":60, \"model\":\"AKB73757604\","
+      "\"command\":\"\\u0043onfig\", \"sensortemp\":-1.5e1} ",
+      &state));
+  EXPECT_EQ(decode_type_t::LG, state.protocol);
+  EXPECT_TRUE(state.power);
+  EXPECT_EQ(stdAc::opmode_t::kCool, state.mode);
+  EXPECT_EQ(23.25, state.degrees);
+  EXPECT_EQ(stdAc::fanspeed_t::kMax, state.fanspeed);
+  EXPECT_EQ(stdAc::swingv_t::kHighest, state.swingv);
+  EXPECT_EQ(stdAc::swingh_t::kOff, state.swingh);
+  EXPECT_TRUE(state.turbo);
+  EXPECT_TRUE(state.econo);
+  EXPECT_TRUE(state.light);
+  EXPECT_FALSE(state.quiet);
+  EXPECT_EQ(60, state.sleep);
+  EXPECT_EQ(lg_ac_remote_model_t::AKB73757604, state.model);
+  EXPECT_EQ(stdAc::ac_command_t::kConfigCommand, state.command);
+  EXPECT_EQ(-15, state.sensorTemperature);
+  EXPECT_TRUE(state.celsius);
+
+  // Numbers work for the protocol, model, & command too.
+  EXPECT_TRUE(jsonToState("{\"protocol\":" + std::to_string(RHOSS) +
+                          ",\"model\":2,\"command\":1}", &state));
+  EXPECT_EQ(decode_type_t::RHOSS, state.protocol);
+  EXPECT_EQ(2, state.model);
+  EXPECT_EQ(stdAc::ac_command_t::kSensorTempReport, state.command);
+  // Out of range numbers are ignored.
+  EXPECT_TRUE(jsonToState("{\"protocol\":9999,\"command\":4,\"sleep\":1e6}",
+                          &state));
+  EXPECT_EQ(decode_type_t::RHOSS, state.protocol);
+  EXPECT_EQ(stdAc::ac_command_t::kSensorTempReport, state.command);
+  EXPECT_EQ(60, state.sleep);
+  EXPECT_TRUE(jsonToState("{}", &state));
+  // It doesn't need to be NUL terminated, & may have a NUL at the end.
+  const char json[] = "{\"quiet\":\"On\"}XXXX";
+  EXPECT_FALSE(irjson::jsonToState(json, sizeof(json) - 1, &state));
+  EXPECT_TRUE(irjson::jsonToState(json, strlen(json) - 4, &state));
+  EXPECT_TRUE(state.quiet);
+  EXPECT_TRUE(jsonToState("{\"quiet\":0}", &state));
+  EXPECT_FALSE(state.quiet);
+}
+
+TEST(TestIRjson, BadJson) {
+  const char *bad[] = {
+      "", " ", "[]", "\"power\"", "{", "}", "{\"power\"}", "{\"power\":}",
+      "{\"power\":\"On\"", "{\"power\":\"On\",}", "{power:\"On\"}",
+      "{\"power\":\"On\"}}", "{\"power\":\"On\"} x", "{\"power\":On}",
+      "{\"power\":tru}", "{\"temp\":1-2}", "{\"temp\":--1}", "{\"temp\":.}",
+      "{\"mode\":\"co\nol\"}", "{\"mode\":\"\\x\"}", "{\"mode\":\"\\u12\"}",
+      "{\"a\":[1,2}", "{\"a\":[[[[[[[[[1]]]]]]]]]}", "{\"a\":{\"b\"}}",
+      "{\"a\":[1 2]}", "{\"power\":\"On\" \"mode\":\"Cool\"}"};
+  stdAc::state_t state;
+  const stdAc::packed_state_t before = IRac::packState(state);
+  for (uint8_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+    EXPECT_FALSE(jsonToState(bad[i], &state)) << bad[i];
+    EXPECT_FALSE(IRac::cmpStates(before, IRac::packState(state))) << bad[i];
+  }
+  EXPECT_FALSE(irjson::jsonToState(NULL, 10, &state));
+  // Deep nesting that's within the limit is fine.
+  EXPECT_TRUE(jsonToState("{\"a\":[[[[[[[[1]]]]]]]]}", &state));
+}
+
+TEST(TestIRjson, RoundTripFuzz) {
+  uint32_t seed = 12345;  // Same random numbers each time.
+  for (uint16_t n = 0; n < 1000; n++) {
+    uint32_t r[16];
+    for (uint8_t i = 0; i < 16; i++) {
+      seed = seed * 1103515245UL + 12345;
+      r[i] = seed >> 8;
+    }
+    stdAc::state_t state;
+    state.protocol = (decode_type_t)(r[0] % (kLastDecodeType + 2) - 1);
+    state.model = r[1] % 8 - 1;
+    state.power = r[2] & 1;
+    state.mode = (stdAc::opmode_t)(r[3] % 6 - 1);
+    state.degrees = (int16_t)(r[4] % 10000 - 5000) / 100.0f;
+    state.celsius = r[2] & 2;
+    state.fanspeed = (stdAc::fanspeed_t)(r[5] % 7);
+    state.swingv = (stdAc::swingv_t)(r[6] % 8 - 1);
+    state.swingh = (stdAc::swingh_t)(r[7] % 8 - 1);
+    state.quiet = r[2] & 4;
+    state.turbo = r[2] & 8;
+    state.econo = r[2] & 16;
+    state.light = r[2] & 32;
+    state.filter = r[2] & 64;
+    state.clean = r[2] & 128;
+    state.beep = r[2] & 256;
+    state.sleep = r[8] % 2000 - 1;
+    state.clock = r[9] % 1441 - 1;
+    state.command = (stdAc::ac_command_t)(r[10] % 4);
+    state.iFeel = r[2] & 512;
+    state.sensorTemperature = (int16_t)(r[11] % 20000 - 10000) / 100.0f;
+
+    char json[512];
+    IRtextSink out(json, sizeof(json));
+    irjson::stateToJson(&out, state);
+    ASSERT_FALSE(out.overflowed());
+    stdAc::state_t result;
+    ASSERT_TRUE(irjson::jsonToState(json, out.length(), &result)) << json;
+    EXPECT_FALSE(IRac::cmpStates(IRac::packState(state),
+                                 IRac::packState(result))) << json;
+    EXPECT_EQ(state.clock, result.clock) << json;
+
+    // Mangle it. It's unlikely to be valid, but it must never be read past
+    // the end, nor crash. (Run the tests with a sanitizer to check.)
+    const size_t length = r[12] % (out.length() + 1);
+    char *mangled = new char[length];  // Exactly the size, to catch overruns.
+    memcpy(mangled, json, length);
+    for (uint8_t i = 0; length && i < r[13] % 4; i++)
+      mangled[r[14 + i % 2] % length] ^= 1 << (r[13 + i] % 8);
+    irjson::jsonToState(mangled, length, &result);
+    delete[] mangled;
+  }
+}
+
+TEST(TestIRjson, Results) {
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x4BB640BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  char json[256];
+  IRtextSink out(json, sizeof(json));
+  irjson::resultsToJson(&out, &irsend.capture);
+  EXPECT_EQ(
+      "{\"type\":\"NEC\",\"bits\":32,\"code\":\"0x4BB640BF\","
+      "\"address\":" + std::to_string(irsend.capture.address) +
+      ",\"command\":" + std::to_string(irsend.capture.command) +
+      ",\"repeat\":false}",
+      std::string(json));
+  decode_results results;
+  ASSERT_TRUE(irjson::jsonToResults(json, out.length(), &results));
+  EXPECT_EQ(resultToHumanReadableBasic(&irsend.capture),
+            resultToHumanReadableBasic(&results));
+  EXPECT_EQ(0, results.rawlen);
+
+  const uint8_t state[kRhossStateLength] = {
+      0xAA, 0x05, 0x60, 0x00, 0x50, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x33};
+  irsend.reset();
+  irsend.sendRhoss(state);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  IRtextSink out2(json, sizeof(json));
+  irjson::resultsToJson(&out2, &irsend.capture);
+  EXPECT_EQ(
+      "{\"type\":\"RHOSS\",\"bits\":96,\"code\":\"0xAA0560005080540000000033\","
+      "\"repeat\":false}",
+      std::string(json));
+  ASSERT_TRUE(irjson::jsonToResults(json, out2.length(), &results));
+  EXPECT_EQ(decode_type_t::RHOSS, results.decode_type);
+  EXPECT_EQ(kRhossBits, results.bits);
+  EXPECT_STATE_EQ(state, results.state, kRhossBits);
+
+  // The bits default to the size of the code. Odd nr.s of digits are fine.
+  const char simple[] = "{\"protocol\":\"NEC\",\"code\":\"abc\",\"repeat\":1}";
+  ASSERT_TRUE(irjson::jsonToResults(simple, strlen(simple), &results));
+  EXPECT_EQ(decode_type_t::NEC, results.decode_type);
+  EXPECT_EQ(0xABC, results.value);
+  EXPECT_EQ(16, results.bits);
+  EXPECT_TRUE(results.repeat);
+
+  const char *bad[] = {
+      "{\"type\":\"NEC\"}", "{\"code\":\"0x12\"}",
+      "{\"type\":\"NEC\",\"code\":\"0x\"}",
+      "{\"type\":\"NEC\",\"code\":\"0x12G4\"}",
+      "{\"type\":\"NEC\",\"code\":\"0x112233445566778899\"}",
+      "{\"type\":\"NEC\",\"code\":1234}"};
+  for (uint8_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    EXPECT_FALSE(irjson::jsonToResults(bad[i], strlen(bad[i]), &results))
+        << bad[i];
+  EXPECT_EQ(0xABC, results.value);
+}
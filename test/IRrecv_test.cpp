@@ -1,6 +1,7 @@
 // Copyright 2017 David Conran
 
 #include "IRrecv_test.h"
+#include "IRprotocol.h"
 #include "IRrecv.h"
 #include "IRremoteESP8266.h"
 #include "IRsend.h"
@@ -85,8 +86,99 @@ TEST(TestIRrecv, DecodeHeapOverflow) {
   EXPECT_EQ(99, params_ptr->rawbuf[params_ptr->rawlen + 1]);
 }
 
+TEST(TestIRrecv, StateSizeMax) {
+  // Always big enough to hold a value, and every enabled decoder's state.
+  EXPECT_LE(sizeof(uint64_t), kStateSizeMax);
+  EXPECT_LE(DECODE_RHOSS ? kRhossStateLength : 0, kStateSizeMax);
+  EXPECT_LE(DECODE_BLUESTARHEAVY ? kBluestarHeavyStateLength : 0,
+            kStateSizeMax);
+  EXPECT_EQ(53, irLargestSize(8, 53, 0, 13));
+  EXPECT_EQ(8, irLargestSize(8));
+  // No padding between the members. i.e. Only (maybe) some at the end.
+  EXPECT_EQ(offsetof(decode_results, rawbuf) + sizeof(atomic_uint16_t *),
+            offsetof(decode_results, decode_type));
+  EXPECT_EQ(offsetof(decode_results, decode_type) + sizeof(decode_type_t),
+            offsetof(decode_results, bits));
+  EXPECT_EQ(offsetof(decode_results, bits) + sizeof(uint16_t),
+            offsetof(decode_results, rawlen));
+  EXPECT_EQ(offsetof(decode_results, rawlen) + sizeof(uint16_t),
+            offsetof(decode_results, overflow));
+  EXPECT_EQ(offsetof(decode_results, overflow) + sizeof(bool),
+            offsetof(decode_results, repeat));
+}
+
+// Tests for compact capture buffers.
+
+TEST(TestCompactCapture, Iterator) {
+  const uint8_t compact[] = {0, 140, kCompactEscape, 0x11, 0x94, 211,
+                             kCompactEscape, 0x08};
+  IRcompactIterator iter(compact, sizeof(compact));
+  EXPECT_FALSE(iter.done());
+  EXPECT_EQ(0, iter.next());
+  EXPECT_EQ(140 * kCompactTick, iter.next());
+  EXPECT_EQ(0x1194, iter.next());  // Escaped, so exact.
+  EXPECT_EQ(211 * kCompactTick, iter.next());
+  // A truncated escaped interval isn't returned.
+  EXPECT_TRUE(iter.done());
+  EXPECT_EQ(0, iter.next());
+  IRcompactIterator empty(compact, 0);
+  EXPECT_TRUE(empty.done());
+}
+
+#if ENABLE_COMPACT_CAPTURE
+TEST(TestCompactCapture, DecodeExpands) {
+  IRsendTest irsend(0);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x4BB640BF);
+  irsend.makeDecodeResult();
+  // Store the capture the way the interrupt handler does.
+  IRrecv irrecv(1);
+  atomic_irparams_t *params_ptr = irrecv._getParamsPtr();
+  uint8_t *compact = reinterpret_cast<uint8_t *>(params_ptr->rawbuf) +
+      irrecv.getBufSize();
+  uint16_t length = 0;
+  for (uint16_t i = 0; i < irsend.capture.rawlen; i++) {
+    const uint16_t ticks = irsend.capture.rawbuf[i];
+    const uint16_t units = (ticks + kCompactTick / 2) / kCompactTick;
+    if (units < kCompactEscape) {
+      compact[length++] = units;
+    } else {
+      compact[length++] = kCompactEscape;
+      compact[length++] = ticks >> 8;
+      compact[length++] = ticks;
+    }
+  }
+  // Only the header & the trailing gap are too long for a byte.
+  EXPECT_EQ(irsend.capture.rawlen + 3 * 2, length);
+  params_ptr->rawlen = length;
+  params_ptr->overflow = false;
+  params_ptr->rcvstate = kStopState;
+  irparams_t save;
+  save.rawbuf = new uint16_t[irrecv.getBufSize()];
+  decode_results results;
+  ASSERT_TRUE(irrecv.decode(&results, &save));
+  EXPECT_EQ(irsend.capture.rawlen, results.rawlen);
+  EXPECT_EQ(0, results.rawbuf[results.rawlen]);
+  for (uint16_t i = 1; i < results.rawlen; i++)
+    EXPECT_NEAR(irsend.capture.rawbuf[i], results.rawbuf[i], kCompactTick / 2);
+  EXPECT_EQ(NEC, results.decode_type);
+  EXPECT_EQ(kNECBits, results.bits);
+  EXPECT_EQ(0x4BB640BF, results.value);
+  // Without a save buffer, it is expanded in place. i.e. Over itself.
+  EXPECT_EQ(results.rawlen, irrecv.expandCapture(length, params_ptr->rawbuf,
+                                                 irrecv.getBufSize()));
+  for (uint16_t i = 0; i < results.rawlen; i++)
+    EXPECT_EQ(results.rawbuf[i], params_ptr->rawbuf[i]);
+  delete[] save.rawbuf;
+}
+#endif  // ENABLE_COMPACT_CAPTURE
+
 // Tests for copyIrParams()
 
+// N.B. copyIrParams() expands the compact capture data instead of copying
+// `rawbuf` when ENABLE_COMPACT_CAPTURE is set. See TestCompactCapture.
+#if !ENABLE_COMPACT_CAPTURE
 TEST(TestCopyIrParams, CopyEmpty) {
   irparams_t src;
   irparams_t dst;
@@ -150,6 +242,7 @@ TEST(TestCopyIrParams, CopyNonEmpty) {
   EXPECT_EQ(0xBEEF, dst.rawbuf[1]);
   EXPECT_EQ(0xDEAD, dst.rawbuf[test_size - 1]);
 }
+#endif  // !ENABLE_COMPACT_CAPTURE
 
 // Tests for decode().
 
@@ -491,6 +584,132 @@ TEST(TestDecode, DecodeAiwa) {
   EXPECT_EQ(0x7F, irsend.capture.value);
 }
 
+// Test finding the protocol registry entry used to send a protocol.
+TEST(TestProtocolRegistry, Find) {
+  EXPECT_EQ(&IRprotocols::kNec, irprotocolFind(NEC));
+  EXPECT_EQ(&IRprotocols::kNecLike, irprotocolFind(NEC_LIKE));
+  // The 28-bit entry, not the decode only 32-bit one.
+  EXPECT_EQ(&IRprotocols::kLg, irprotocolFind(LG));
+  EXPECT_EQ(&IRprotocols::kLg2, irprotocolFind(LG2));
+  EXPECT_EQ(&IRprotocols::kRhoss, irprotocolFind(RHOSS));
+  EXPECT_EQ(&IRprotocols::kBluestarHeavy, irprotocolFind(BLUESTARHEAVY));
+  EXPECT_EQ(NULL, irprotocolFind(UNKNOWN));
+  EXPECT_EQ(NULL, irprotocolFind(SONY));
+}
+
+// Test a non-strict registry entry reports its own protocol.
+TEST(TestProtocolRegistry, NonStrictDecode) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  // Not a valid (strict) NEC message, as the command isn't inverted.
+  irsend.sendNEC(0x12345678);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(NEC_LIKE, irsend.capture.decode_type);
+  EXPECT_EQ(kNECBits, irsend.capture.bits);
+  EXPECT_EQ(0x12345678, irsend.capture.value);
+
+  irsend.reset();
+  EXPECT_TRUE(irsend.send(NEC_LIKE, 0x12345678, kNECBits));
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(NEC_LIKE, irsend.capture.decode_type);
+}
+
+#if ENABLE_MATCH_TRACE
+// Test the match trace records what decoding a message found.
+TEST(TestMatchTrace, Decode) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x4BB640BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(NEC, irsend.capture.decode_type);
+  irtrace_event_t events[kMatchTraceSize];
+  const uint16_t nr = irtrace::read(events, kMatchTraceSize);
+  ASSERT_LT(0, nr);
+  EXPECT_LE(nr, irtrace::count());
+  // NEC is tried first, so the first thing looked at is its header mark.
+  if (irtrace::count() <= kMatchTraceSize) {
+    EXPECT_EQ(kTraceMark, events[0].type);
+    EXPECT_TRUE(events[0].result);
+    EXPECT_LE(events[0].low, events[0].value);
+    EXPECT_GE(events[0].high, events[0].value);
+  }
+  // It is cleared by the next decode.
+  irsend.reset();
+  irsend.makeDecodeResult();
+  irrecv.decode(&irsend.capture);
+  EXPECT_GE(kMatchTraceSize, irtrace::count());
+}
+
+// Test the match trace only keeps the most recent events.
+TEST(TestMatchTrace, Wraps) {
+  IRrecv irrecv(1);
+  irtrace::clear();
+  EXPECT_EQ(0, irtrace::count());
+  irtrace_event_t events[kMatchTraceSize];
+  EXPECT_EQ(0, irtrace::read(events, kMatchTraceSize));
+  // Alternate success & failure. Periods are recorded in uSecs.
+  for (uint16_t i = 0; i < kMatchTraceSize + 10; i++)
+    irrecv.match(i, i % 2 ? i * kRawTick : 10000);
+  EXPECT_EQ(kMatchTraceSize + 10, irtrace::count());
+  EXPECT_EQ(kMatchTraceSize, irtrace::read(events, kMatchTraceSize));
+  // Oldest first.
+  EXPECT_EQ(10 * kRawTick, events[0].value);
+  EXPECT_EQ(kTraceMatch, events[0].type);
+  EXPECT_FALSE(events[0].result);
+  EXPECT_EQ(11 * kRawTick, events[1].value);
+  EXPECT_TRUE(events[1].result);
+  EXPECT_EQ((kMatchTraceSize + 9) * kRawTick,
+            events[kMatchTraceSize - 1].value);
+  // Asking for fewer gives the most recent ones.
+  EXPECT_EQ(2, irtrace::read(events, 2));
+  EXPECT_EQ((kMatchTraceSize + 8) * kRawTick, events[0].value);
+  EXPECT_EQ((kMatchTraceSize + 9) * kRawTick, events[1].value);
+  irtrace::clear();
+  EXPECT_EQ(0, irtrace::count());
+}
+
+// Test a matchBytes() failure records which bit & the window it missed.
+TEST(TestMatchTrace, Bytes) {
+  IRrecv irrecv(1);
+  uint16_t rawbuf[2 * 16 + 1];
+  uint8_t result[2];
+  for (uint16_t i = 0; i < 2 * 16 + 1; i++) rawbuf[i] = 500 / kRawTick;
+  irtrace_event_t event;
+  // A space encoded bit whose space is neither a '1' nor a '0'.
+  rawbuf[10 * 2 + 1] = 1000 / kRawTick;
+  irtrace::clear();
+  EXPECT_EQ(0, irrecv.matchBytes(rawbuf, result, 2 * 16 + 1, 2,
+                                 500, 1500, 500, 500, kUseDefTol, 0));
+  ASSERT_EQ(1, irtrace::read(&event, 1));
+  EXPECT_EQ(kTraceData, event.type);
+  EXPECT_FALSE(event.result);
+  EXPECT_EQ(10, event.value);
+  // The marks matched both bits, so it's the window of either space.
+  EXPECT_GT(500, event.low);
+  EXPECT_LT(1500, event.high);
+  // A mark that is neither.
+  rawbuf[10 * 2 + 1] = 500 / kRawTick;
+  rawbuf[3 * 2] = 3000 / kRawTick;
+  irtrace::clear();
+  EXPECT_EQ(0, irrecv.matchBytes(rawbuf, result, 2 * 16 + 1, 2,
+                                 500, 1500, 500, 500, kUseDefTol, 0));
+  ASSERT_EQ(1, irtrace::read(&event, 1));
+  EXPECT_EQ(kTraceData, event.type);
+  EXPECT_EQ(3, event.value);
+  EXPECT_GT(500, event.low);
+  EXPECT_LT(500, event.high);
+  EXPECT_GT(3000, event.high);
+  irtrace::clear();
+}
+#endif  // ENABLE_MATCH_TRACE
+
 // Test matchData() on space encoded data.
 TEST(TestMatchData, SpaceEncoded) {
   IRsendTest irsend(0);
@@ -604,6 +823,78 @@ TEST(TestMatchData, ArbitraryEncoded) {
   ASSERT_FALSE(result.success);
 }
 
+// matchBytes() must give exactly the same results as decoding each byte with
+// matchData(), for all kinds of encodings, noise, & settings.
+TEST(TestMatchBytes, SameAsMatchData) {
+  IRrecv irrecv(1);
+  // {onemark, onespace, zeromark, zerospace}
+  const uint16_t timings[][4] = {
+      {500, 1500, 500, 500},     // Space encoded.
+      {1500, 500, 500, 500},     // Mark encoded.
+      {500, 1500, 1500, 500},    // Equal total bit time.
+      {3000, 800, 400, 6000},    // Arbitrary.
+      {500, 1000, 500, 1000}};   // Ambiguous. i.e. Always a '1'.
+  const uint8_t tolerances[] = {kUseDefTol, 0, 40};
+  const int16_t excesses[] = {kMarkExcess, 0, -100};
+  const uint16_t kMaxBytes = 12;
+  uint16_t rawbuf[kMaxBytes * 16 + 1];
+  uint8_t expected[kMaxBytes];
+  uint8_t result[kMaxBytes];
+  uint32_t seed = 42;
+  uint32_t matched = 0;
+  uint32_t failed = 0;
+  for (uint16_t i = 0; i < 3000; i++) {
+    const uint16_t *timing = timings[i % 5];
+    const uint16_t nbytes = 1 + (i / 5) % kMaxBytes;
+    // Every 3rd frame has noise in it that may, or may not, still match.
+    const uint8_t noise = (i % 3) ? 0 : 40;
+    for (uint16_t j = 0; j < nbytes * 16 + 1; j++) {
+      if (!(j & 1)) seed = seed * 1103515245UL + 12345;  // A new bit.
+      const bool bit = (seed >> 16) & 1;
+      const uint16_t usecs = timing[(bit ? 0 : 2) + (j & 1)];
+      const int32_t jitter = noise ? (int32_t)((seed >> (j & 1 ? 8 : 24)) %
+                                               (noise * 2 + 1)) - noise : 0;
+      rawbuf[j] = (usecs + usecs * jitter / 100) / kRawTick;
+    }
+    for (const uint8_t tolerance : tolerances)
+      for (const int16_t excess : excesses)
+        for (uint8_t msb = 0; msb < 2; msb++)
+          for (uint8_t lastspace = 0; lastspace < 2; lastspace++) {
+            volatile uint16_t *data = rawbuf;
+            uint16_t used = 0;
+            for (uint16_t byte = 0; byte < nbytes; byte++) {
+              match_result_t byteresult = irrecv.matchData(
+                  data + used, 8, timing[0], timing[1], timing[2], timing[3],
+                  tolerance, excess, msb, (byte + 1 < nbytes) || lastspace);
+              if (!byteresult.success) {
+                used = 0;
+                break;
+              }
+              expected[byte] = byteresult.data;
+              used += byteresult.used;
+            }
+            ASSERT_EQ(used, irrecv.matchBytes(
+                data, result, nbytes * 16 + 1, nbytes, timing[0], timing[1],
+                timing[2], timing[3], tolerance, excess, msb, lastspace))
+                << "Frame: " << i << " Tolerance: " << (int)tolerance
+                << " Excess: " << excess << " MSB: " << (int)msb
+                << " Last space: " << (int)lastspace;
+            if (used) {
+              matched++;
+              for (uint16_t byte = 0; byte < nbytes; byte++)
+                ASSERT_EQ(expected[byte], result[byte]) << "Frame: " << i;
+            } else {
+              failed++;
+            }
+          }
+  }
+  // Make sure we tested plenty of both outcomes.
+  EXPECT_LT(10000, matched);
+  EXPECT_LT(10000, failed);
+  // Not enough capture buffer left.
+  EXPECT_EQ(0, irrecv.matchBytes(rawbuf, result, 15, 1, 500, 1500, 500, 500));
+}
+
 TEST(TestMatchGeneric, NormalWithNoAtleast) {
   IRsendTest irsend(0);
   IRrecv irrecv(1);
@@ -0,0 +1,215 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+#include <vector>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRrecv_test.h"
+#include "IRscheduler.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRtimer.h"
+#include "IRutils.h"
+#include "gtest/gtest.h"
+
+namespace {
+// Records which tick each job ran on.
+class RecordingJob : public IRschedulerJob {
+ public:
+  RecordingJob() : IRschedulerJob(), scheduler(NULL), runs(0), last(0) {}
+  void run(void) {
+    runs++;
+    if (scheduler != NULL) last = scheduler->getTicks();
+  }
+  IRscheduler *scheduler;
+  uint32_t runs;
+  uint32_t last;
+};
+
+void countCallback(void *context) {
+  (*reinterpret_cast<uint16_t *>(context))++;
+}
+
+void cancelCallback(void *context) {
+  IRschedulerJob **jobs = reinterpret_cast<IRschedulerJob **>(context);
+  IRscheduler *scheduler = reinterpret_cast<IRscheduler *>(jobs[0]);
+  scheduler->cancel(jobs[1]);
+}
+}  // namespace
+
+TEST(TestIRscheduler, OneShot) {
+  IRscheduler scheduler(10);
+  RecordingJob job;
+  job.scheduler = &scheduler;
+  EXPECT_EQ(10, scheduler.getTickMs());
+  EXPECT_FALSE(job.isPending());
+  EXPECT_TRUE(scheduler.schedule(&job, 100));
+  EXPECT_TRUE(job.isPending());
+  EXPECT_EQ(1, scheduler.pending());
+  EXPECT_EQ(0, scheduler.advance(9));
+  EXPECT_EQ(0, job.runs);
+  EXPECT_EQ(1, scheduler.advance(1));
+  EXPECT_EQ(1, job.runs);
+  EXPECT_EQ(10, job.last);
+  EXPECT_FALSE(job.isPending());
+  EXPECT_EQ(0, scheduler.pending());
+  EXPECT_EQ(0, scheduler.advance(1000));
+  EXPECT_EQ(1, job.runs);
+
+  // Partial ticks are rounded up, and a zero delay means the next tick.
+  EXPECT_EQ(3, scheduler.msToTicks(21));
+  EXPECT_TRUE(scheduler.schedule(&job, 0));
+  EXPECT_EQ(1, scheduler.advance(1));
+  EXPECT_EQ(2, job.runs);
+}
+
+TEST(TestIRscheduler, DrivenByTimerMs) {
+  IRscheduler scheduler(10);
+  uint16_t count = 0;
+  IRschedulerJob job(countCallback, &count);
+  EXPECT_TRUE(scheduler.schedule(&job, 45 * 60 * 1000));  // 45 minutes.
+  EXPECT_EQ(0, scheduler.run());
+  TimerMs::add(9);
+  EXPECT_EQ(0, scheduler.run());
+  TimerMs::add(2);  // 11ms, so one tick & 1ms carried over.
+  EXPECT_EQ(0, scheduler.run());
+  EXPECT_EQ(1, scheduler.getTicks());
+  TimerMs::add(45 * 60 * 1000 - 20);
+  EXPECT_EQ(0, scheduler.run());
+  EXPECT_EQ(0, count);
+  TimerMs::add(9);  // Plus the carried 1ms makes exactly 45 minutes.
+  EXPECT_EQ(1, scheduler.run());
+  EXPECT_EQ(1, count);
+  EXPECT_EQ(270000, scheduler.getTicks());
+}
+
+TEST(TestIRscheduler, Periodic) {
+  IRscheduler scheduler(1);
+  RecordingJob job;
+  job.scheduler = &scheduler;
+  EXPECT_TRUE(scheduler.schedule(&job, 5, 100));
+  EXPECT_EQ(100, job.period);
+  scheduler.advance(5);
+  EXPECT_EQ(1, job.runs);
+  EXPECT_EQ(5, job.last);
+  EXPECT_TRUE(job.isPending());
+  scheduler.advance(1000);
+  EXPECT_EQ(11, job.runs);
+  EXPECT_EQ(1005, job.last);
+  EXPECT_TRUE(scheduler.cancel(&job));
+  EXPECT_FALSE(scheduler.cancel(&job));
+  scheduler.advance(1000);
+  EXPECT_EQ(11, job.runs);
+}
+
+TEST(TestIRscheduler, Reschedule) {
+  IRscheduler scheduler(1);
+  RecordingJob job;
+  job.scheduler = &scheduler;
+  EXPECT_TRUE(scheduler.schedule(&job, 5000));
+  EXPECT_TRUE(scheduler.schedule(&job, 50));
+  EXPECT_EQ(1, scheduler.pending());
+  scheduler.advance(10000);
+  EXPECT_EQ(1, job.runs);
+  EXPECT_EQ(50, job.last);
+}
+
+TEST(TestIRscheduler, Limits) {
+  IRscheduler scheduler(1);
+  RecordingJob job;
+  EXPECT_FALSE(scheduler.schedule(NULL, 1));
+  EXPECT_FALSE(scheduler.schedule(&job, kSchedulerMaxTicks + 1));
+  EXPECT_FALSE(scheduler.schedule(&job, 1, kSchedulerMaxTicks + 1));
+  EXPECT_FALSE(job.isPending());
+  EXPECT_TRUE(scheduler.schedule(&job, kSchedulerMaxTicks));
+  scheduler.advance(kSchedulerMaxTicks - 1);
+  EXPECT_EQ(0, job.runs);
+  scheduler.advance(1);
+  EXPECT_EQ(1, job.runs);
+}
+
+// Lots of jobs, spread over every level of the wheel, must all run on exactly
+// the right tick.
+TEST(TestIRscheduler, ManyJobs) {
+  const uint16_t kJobs = 5000;
+  IRscheduler scheduler(1);
+  std::vector<RecordingJob> jobs(kJobs);
+  std::vector<uint32_t> due(kJobs);
+  scheduler.advance(12345);  // Start somewhere awkward.
+  uint32_t seed = 1;
+  for (uint16_t i = 0; i < kJobs; i++) {
+    seed = seed * 1103515245 + 12345;
+    const uint32_t delay = (seed >> 8) % (1 << (6 * (i % 4 + 1)));
+    jobs[i].scheduler = &scheduler;
+    ASSERT_TRUE(scheduler.schedule(&jobs[i], delay));
+    due[i] = scheduler.getTicks() + (delay ? delay : 1);
+  }
+  EXPECT_EQ(kJobs, scheduler.pending());
+  uint32_t ran = 0;
+  for (uint32_t tick = 0; tick < (1 << 24) && scheduler.pending(); tick += 997)
+    ran += scheduler.advance(997);
+  EXPECT_EQ(kJobs, ran);
+  for (uint16_t i = 0; i < kJobs; i++) {
+    EXPECT_EQ(1, jobs[i].runs);
+    EXPECT_EQ(due[i], jobs[i].last);
+  }
+}
+
+TEST(TestIRscheduler, CancelFromAnotherJob) {
+  IRscheduler scheduler(1);
+  RecordingJob victim;
+  IRschedulerJob *context[2] = {
+      reinterpret_cast<IRschedulerJob *>(&scheduler), &victim};
+  IRschedulerJob killer(cancelCallback, context);
+  // Both due on the same tick, so they share a slot. The victim is run after
+  // the killer as it was added first.
+  EXPECT_TRUE(scheduler.schedule(&victim, 10));
+  EXPECT_TRUE(scheduler.schedule(&killer, 10));
+  EXPECT_EQ(1, scheduler.advance(10));
+  EXPECT_EQ(0, victim.runs);
+  EXPECT_EQ(0, scheduler.pending());
+}
+
+TEST(TestIRsendJob, SendAtTheRightTime) {
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+  irsend.reset();
+  IRscheduler scheduler;
+  IRsendJob job(&irsend, decode_type_t::NEC, 0x4BB640BF, kNECBits);
+  EXPECT_TRUE(scheduler.schedule(&job, 1000));
+  scheduler.advance(99);
+  EXPECT_EQ("", irsend.outputStr());
+  scheduler.advance(1);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  EXPECT_EQ(decode_type_t::NEC, irsend.capture.decode_type);
+  EXPECT_EQ(0x4BB640BF, irsend.capture.value);
+}
+
+TEST(TestIRacJob, OffTimerAndKeepAlive) {
+  IRac ac(kGpioUnused);
+  stdAc::state_t on;
+  IRac::initState(&on);
+  on.protocol = decode_type_t::LG;
+  on.model = lg_ac_remote_model_t::GE6711AR2853M;
+  on.power = true;
+  on.mode = stdAc::opmode_t::kCool;
+  on.degrees = 21;
+  ac.next = on;
+  ASSERT_TRUE(ac.sendAc());
+  IRscheduler scheduler;
+  // Resend the current state every minute, & turn it off in 45 minutes.
+  IRacJob keepalive(&ac);
+  stdAc::state_t off = on;
+  off.power = false;
+  IRacJob offtimer(&ac, off);
+  EXPECT_TRUE(scheduler.schedule(&keepalive, 60 * 1000, 60 * 1000));
+  EXPECT_TRUE(scheduler.schedule(&offtimer, 45 * 60 * 1000));
+  scheduler.advance(45 * 60 * 100 - 1);
+  EXPECT_TRUE(ac.getStatePrev().power);
+  scheduler.advance(1);
+  EXPECT_FALSE(ac.getStatePrev().power);
+  EXPECT_FALSE(ac.next.power);
+  EXPECT_TRUE(keepalive.isPending());
+  EXPECT_FALSE(offtimer.isPending());
+}
@@ -232,6 +232,86 @@ TEST(TestSendRaw, NoTrailingGap) {
   EXPECT_EQ(kNECBits, irsend.capture.bits);
 }
 
+// Sending straight from a capture buffer is the same as converting it first.
+TEST(TestSendRawTicks, SameAsSendRaw) {
+  IRsendTest irsend(4);
+  irsend.begin();
+
+  irsend.reset();
+  uint16_t rawData[11] = {9000, 4500, 650, 550, 650, 1650, 600, 550, 650, 550,
+                          600};
+  irsend.sendRaw(rawData, 11, 38);
+  irsend.makeDecodeResult();
+  irsend.capture.rawbuf[4] = 60000;  // Too long for a single sendRaw() entry.
+  irsend.capture.rawbuf[7] = 50000;  // Ditto, but a mark.
+  const uint16_t length = getCorrectedRawLength(&irsend.capture);
+  ASSERT_EQ(11 + 2 * 2, length);
+  uint16_t array[11 + 2 * 2];
+  ASSERT_EQ(length, resultToRawArray(&irsend.capture, array, length));
+
+  IRsendTest direct(4);  // irsend.reset() would clear the capture buffer.
+  direct.begin();
+  direct.reset();
+  direct.sendRaw(array, length, 38);
+  const std::string expected = direct.outputStr();
+  EXPECT_EQ(
+      "f38000d50"
+      "m9000s4500m650s65535m0s54465m650s1650m65535s0m34465s550m650s550m600",
+      expected);
+  direct.reset();
+  direct.sendRawTicks(irsend.capture.rawbuf + kStartOffset,
+                      irsend.capture.rawlen - kStartOffset, 38, kRawTick);
+  EXPECT_EQ(expected, direct.outputStr());
+}
+
+// Test typical use of sendPackedRaw().
+TEST(TestSendPackedRaw, GeneralUse) {
+  IRsendTest irsend(4);
+  IRrecv irrecv(0);
+  irsend.begin();
+
+  // NEC C3E0E0E8 as measured in #204
+  uint16_t rawData[67] = {
+      8950, 4500, 550, 1650, 600, 1650, 550, 550,  600, 500,  600, 550,
+      550,  550,  600, 1650, 550, 1650, 600, 1650, 600, 1650, 550, 1700,
+      550,  550,  600, 550,  550, 550,  600, 500,  600, 550,  550, 1650,
+      600,  1650, 600, 1650, 550, 550,  600, 500,  600, 500,  600, 550,
+      550,  550,  600, 1650, 550, 1650, 600, 1650, 600, 500,  650, 1600,
+      600,  500,  600, 550,  550, 550,  600};
+  uint8_t packed[64];
+  const uint16_t size = packRaw(rawData, 67, 38, packed, sizeof(packed));
+  ASSERT_LT(0, size);
+  EXPECT_GT(sizeof(rawData) / 2, size);  // It is less than half the size.
+
+  irsend.reset();
+  ASSERT_TRUE(irsend.sendPackedRaw(packed, size));
+  EXPECT_EQ(
+      "f38000d50"
+      "m8950s4500"
+      "m564s1650m564s1650m564s564m564s564m564s564m564s564m564s1650m564s1650"
+      "m564s1650m564s1650m564s1650m564s564m564s564m564s564m564s564m564s564"
+      "m564s1650m564s1650m564s1650m564s564m564s564m564s564m564s564m564s564"
+      "m564s1650m564s1650m564s1650m564s564m650s1650m564s564m564s564m564s564"
+      "m564",
+      irsend.outputStr());
+
+  irsend.reset();
+  ASSERT_TRUE(irsend.sendPackedRaw(packed, size));
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decodeNEC(&irsend.capture, kStartOffset, kNECBits, false));
+  EXPECT_EQ(NEC, irsend.capture.decode_type);
+  EXPECT_EQ(32, irsend.capture.bits);
+  EXPECT_EQ(0xC3E0E0E8, irsend.capture.value);
+
+  // Invalid/corrupt input is rejected, and nothing is sent.
+  irsend.reset();
+  EXPECT_FALSE(irsend.sendPackedRaw(packed, size - 1));
+  EXPECT_FALSE(irsend.sendPackedRaw(NULL, size));
+  packed[3] = 3;  // Unsupported nr. of bits per symbol.
+  EXPECT_FALSE(irsend.sendPackedRaw(packed, size));
+  EXPECT_EQ("", irsend.outputStr());
+}
+
 TEST(TestLowLevelSend, MarkFrequencyModulationAt38kHz) {
   IRsendLowLevelTest irsend(0);
 
@@ -313,6 +393,75 @@ TEST(TestLowLevelSend, MarkFrequencyModulationAt40kHz) {
   EXPECT_EQ("[On]1000usecs[Off]", irsend.low_level_sequence);
 }
 
+// mark() should only read the clock a few times per mark, not every period, so
+// a slow clock (e.g. `micros()`) doesn't stretch the carrier periods.
+TEST(TestLowLevelSend, MarkWithSlowClockReads) {
+  IRsendLowLevelTest irsend(0);
+
+  irsend.begin();
+  // Nothing costs anything, so it doesn't need an offset.
+  EXPECT_EQ(0, irsend.calibrate());
+  irsend.enableIROut(38000, 50);
+  // A free clock first, as a baseline.
+  _IRtimer_unittest_read_cost = 0;
+  _IRtimer_unittest_reads = 0;
+  uint32_t start = _IRtimer_unittest_now;
+  EXPECT_NEAR(346, irsend.mark(9000), 1);  // 9000us of 26us periods.
+  EXPECT_EQ(9000, _IRtimer_unittest_now - start);
+  EXPECT_GE(12, _IRtimer_unittest_reads);
+
+  // Now a clock that takes 2us each time it is read.
+  _IRtimer_unittest_read_cost = 2;
+  _IRtimer_unittest_reads = 0;
+  start = _IRtimer_unittest_now;
+  EXPECT_NEAR(346, irsend.mark(9000), 2);  // No carrier periods were lost.
+  EXPECT_GE(12, _IRtimer_unittest_reads);
+  // Only a few reads worth of error.
+  EXPECT_NEAR(9000, _IRtimer_unittest_now - start, 2 * 2);
+  _IRtimer_unittest_read_cost = 0;
+}
+
+// Toggling the LED costs time each carrier cycle, even when the clock isn't
+// read. mark() must not overrun because of it, & calibrate() should learn to
+// absorb it.
+TEST(TestLowLevelSend, MarkWithSlowLedToggles) {
+  IRsendLowLevelTest irsend(0);
+
+  irsend.begin();
+  irsend.led_cost = 1;  // i.e. 2us per carrier cycle.
+  irsend.enableIROut(38000, 50);
+  // Uncalibrated, the carrier is a little off, but the mark's length isn't.
+  uint32_t start = _IRtimer_unittest_now;
+  irsend.mark(9000);
+  EXPECT_NEAR(9000, _IRtimer_unittest_now - start, 2);
+  // Once calibrated, the carrier period is right too.
+  EXPECT_EQ(-2, irsend.calibrate());
+  irsend.enableIROut(38000, 50);
+  start = _IRtimer_unittest_now;
+  EXPECT_NEAR(346, irsend.mark(9000), 2);
+  EXPECT_NEAR(9000, _IRtimer_unittest_now - start, 2);
+  start = _IRtimer_unittest_now;
+  EXPECT_NEAR(21, irsend.mark(560), 1);
+  EXPECT_NEAR(560, _IRtimer_unittest_now - start, 2);
+  // A mark doesn't change the calibration.
+  EXPECT_EQ(-2, irsend.getPeriodOffset());
+
+  // A cost far bigger than the offset allows for still can't overrun much.
+  IRsendLowLevelTest slow(0);
+  slow.begin();
+  slow.led_cost = 4;  // 8us per cycle. Far more than kPeriodOffset.
+  slow.enableIROut(38000, 50);
+  start = _IRtimer_unittest_now;
+  slow.mark(9000);
+  EXPECT_NEAR(9000, _IRtimer_unittest_now - start, 2 * 4);
+  EXPECT_EQ(kPeriodOffset, slow.getPeriodOffset());
+  EXPECT_EQ(-8, slow.calibrate());
+  slow.enableIROut(38000, 50);
+  start = _IRtimer_unittest_now;
+  EXPECT_NEAR(346, slow.mark(9000), 2);
+  EXPECT_NEAR(9000, _IRtimer_unittest_now - start, 2 * 4);
+}
+
 TEST(TestLowLevelSend, MarkNoModulation) {
   IRsendLowLevelTest irsend(0, false, false);
 
@@ -18,6 +18,9 @@
 #ifdef UNIT_TEST
 // Used to help simulate elapsed time in unit tests.
 extern uint32_t _IRtimer_unittest_now;
+// Used to help simulate the cost of reading the system clock in unit tests.
+extern uint32_t _IRtimer_unittest_reads;
+extern uint32_t _IRtimer_unittest_read_cost;
 #endif  // UNIT_TEST
 
 class IRsendTest : public IRsend {
@@ -130,12 +133,15 @@ class IRsendTest : public IRsend {
 class IRsendLowLevelTest : public IRsend {
  public:
   std::string low_level_sequence;
+  uint32_t led_cost;  // Nr. of usecs it takes to turn the LED on or off.
 
   explicit IRsendLowLevelTest(uint16_t x, bool i = false, bool j = true)
-      : IRsend(x, i, j) {
+      : IRsend(x, i, j), led_cost(0) {
     reset();
   }
 
+  int8_t getPeriodOffset(void) const { return periodOffset; }
+
   void reset() { low_level_sequence = ""; }
 
  protected:
@@ -146,9 +152,15 @@ class IRsendLowLevelTest : public IRsend {
     low_level_sequence += Convert.str() + "usecs";
   }
 
-  void ledOff() { low_level_sequence += "[Off]"; }
+  void ledOff() {
+    low_level_sequence += "[Off]";
+    _IRtimer_unittest_now += led_cost;
+  }
 
-  void ledOn() { low_level_sequence += "[On]"; }
+  void ledOn() {
+    low_level_sequence += "[On]";
+    _IRtimer_unittest_now += led_cost;
+  }
 };
 #endif  // UNIT_TEST
 
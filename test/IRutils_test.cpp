@@ -1,7 +1,12 @@
 // Copyright 2017-2019 David Conran
 
 #include "IRutils.h"
+#include <ctype.h>
 #include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+#include <vector>
 #include "IRrecv.h"
 #include "IRrecv_test.h"
 #include "IRsend.h"
@@ -296,6 +301,88 @@ TEST(TestResultToTimingInfo, General) {
       resultToTimingInfo(&irsend.capture));
 }
 
+TEST(TestResultToTextSink, SameAsStrings) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  irsend.begin();
+  char buffer[1024];
+
+  irsend.reset();
+  irsend.sendNEC(irsend.encodeNEC(0x10, 0x20));
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  IRtextSink code(buffer, sizeof(buffer));
+  resultToSourceCode(&code, &irsend.capture);
+  EXPECT_EQ(resultToSourceCode(&irsend.capture), buffer);
+  EXPECT_FALSE(code.overflowed());
+  IRtextSink timing(buffer, sizeof(buffer));
+  resultToTimingInfo(&timing, &irsend.capture);
+  EXPECT_EQ(resultToTimingInfo(&irsend.capture), buffer);
+  IRtextSink basic(buffer, sizeof(buffer));
+  resultToHumanReadableBasic(&basic, &irsend.capture);
+  EXPECT_EQ(resultToHumanReadableBasic(&irsend.capture), buffer);
+  IRtextSink hex(buffer, sizeof(buffer));
+  resultToHexidecimal(&hex, &irsend.capture);
+  EXPECT_STREQ("0x8F704FB", buffer);
+
+  const uint8_t state[kRhossStateLength] = {
+      0xAA, 0x05, 0x60, 0x00, 0x50, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x33};
+  irsend.reset();
+  irsend.sendRhoss(state);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  IRtextSink ac(buffer, sizeof(buffer));
+  resultToHexidecimal(&ac, &irsend.capture);
+  EXPECT_STREQ("0xAA0560005080540000000033", buffer);
+  EXPECT_EQ(resultToHexidecimal(&irsend.capture), buffer);
+  IRtextSink acbasic(buffer, sizeof(buffer));
+  resultToHumanReadableBasic(&acbasic, &irsend.capture);
+  EXPECT_EQ(resultToHumanReadableBasic(&irsend.capture), buffer);
+
+  // A buffer that is too small is truncated, but we know how much we needed.
+  char small[16];
+  IRtextSink truncated(small, sizeof(small));
+  resultToSourceCode(&truncated, &irsend.capture);
+  EXPECT_STREQ("uint16_t rawDat", small);
+  EXPECT_TRUE(truncated.overflowed());
+  EXPECT_EQ(resultToSourceCode(&irsend.capture).length(), truncated.length());
+  // A NULL buffer only counts.
+  IRtextSink counter(NULL, 0);
+  resultToSourceCode(&counter, &irsend.capture);
+  EXPECT_EQ(truncated.length(), counter.length());
+  EXPECT_FALSE(counter.overflowed());
+}
+
+TEST(TestTraceToText, General) {
+  const irtrace_event_t events[] = {
+      {kTraceMark, 1, 8990, 7650, 10350},
+      {kTraceSpace, 0, 1200, 3825, 5175},
+      {kTraceHeader, 0, 1, 0, 0},
+      {kTraceMatch, 1, 560, 476, 644},
+      {kTraceAtLeast, 1, 40000, 9520, UINT16_MAX},
+      {kTraceData, 0, 7, 0, 0},
+      {kTraceFooter, 0, 0, 0, 0},
+      {0, 1, 0, 0, 0}};
+  char buffer[256];
+  IRtextSink text(buffer, sizeof(buffer));
+  traceToText(&text, events, sizeof(events) / sizeof(events[0]));
+  EXPECT_STREQ(
+      "MARK 8990 [7650..10350] ok\n"
+      "SPACE 1200 [3825..5175] failed\n"
+      "HEADER space failed\n"
+      "MATCH 560 [476..644] ok\n"
+      "ATLEAST 40000 >= 9520 ok\n"
+      "DATA bit 7 failed\n"
+      "FOOTER mark failed\n"
+      "UNKNOWN 0 ok\n",
+      buffer);
+  EXPECT_FALSE(text.overflowed());
+  // Nothing to report.
+  IRtextSink empty(buffer, sizeof(buffer));
+  traceToText(&empty, events, 0);
+  EXPECT_STREQ("", buffer);
+}
+
 TEST(TestResultToHumanReadableBasic, SimpleCodes) {
   IRsendTest irsend(0);
   IRrecv irrecv(1);
@@ -397,12 +484,187 @@ TEST(TestCountBits, Integer) {
   ASSERT_EQ(0, countBits(data, 64, false));
 }
 
+// The simple, one bit/byte at a time, versions of the kernels, to check the
+// word-at-a-time ones against.
+uint64_t bitByBitReverse(uint64_t input, uint16_t nbits) {
+  if (nbits <= 1) return input;
+  if (nbits > 64) nbits = 64;
+  uint64_t output = 0;
+  for (uint16_t i = 0; i < nbits; i++, input >>= 1)
+    output = (output << 1) | (input & 1);
+  return (nbits < 64) ? (input << nbits) | output : output;
+}
+
+uint16_t bitByBitCount(const uint64_t data, const uint8_t length) {
+  uint16_t count = 0;
+  for (uint8_t i = 0; i < length && i < 64; i++) count += (data >> i) & 1;
+  return count;
+}
+
+// A simple & repeatable pseudo random number generator for the tests.
+uint64_t nextRandom(uint64_t *seed) {
+  *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  return *seed ^ (*seed >> 29);
+}
+
+TEST(ReverseBitsTest, SameAsBitByBit) {
+  // Every 16-bit value, for every nr. of bits that affects it.
+  for (uint32_t value = 0; value <= UINT16_MAX; value++)
+    for (uint16_t nbits = 0; nbits <= 17; nbits++)
+      ASSERT_EQ(bitByBitReverse(value, nbits), reverseBits(value, nbits))
+          << "Value: " << value << " nbits: " << nbits;
+  uint64_t seed = 1;
+  for (uint16_t i = 0; i < 2000; i++) {
+    const uint64_t value = nextRandom(&seed);
+    for (uint16_t nbits = 0; nbits <= 70; nbits++)
+      ASSERT_EQ(bitByBitReverse(value, nbits), reverseBits(value, nbits))
+          << "Value: " << value << " nbits: " << nbits;
+  }
+}
+
+TEST(TestCountBits, SameAsBitByBit) {
+  uint64_t seed = 2;
+  for (uint16_t i = 0; i < 2000; i++) {
+    const uint64_t value = (i < 3) ? (i == 1) * UINT64_MAX : nextRandom(&seed);
+    for (uint16_t length = 0; length <= UINT8_MAX; length++) {
+      const uint16_t ones = bitByBitCount(value, length);
+      ASSERT_EQ(ones + 5, countBits(value, length, true, 5));
+      ASSERT_EQ(length ? length - ones : 0,
+                countBits(value, length, false));
+    }
+  }
+  // Every byte value, and every length & alignment of an array.
+  uint8_t data[80];
+  for (uint16_t value = 0; value <= UINT8_MAX; value++) {
+    data[0] = value;
+    ASSERT_EQ(bitByBitCount(value, 8), countBits(data, 1));
+  }
+  for (uint16_t i = 0; i < 50; i++) {
+    for (uint8_t j = 0; j < sizeof(data); j++) data[j] = nextRandom(&seed);
+    for (uint8_t start = 0; start < 8; start++)
+      for (uint8_t length = 0; start + length <= sizeof(data); length++) {
+        uint16_t ones = 0;
+        for (uint8_t j = start; j < start + length; j++)
+          ones += bitByBitCount(data[j], 8);
+        ASSERT_EQ(ones + 7, countBits(data + start, length, true, 7));
+        ASSERT_EQ(length ? length * 8 - ones : 0,
+                  countBits(data + start, length, false));
+      }
+  }
+}
+
+TEST(TestUtils, SumAndXorBytesSameAsByteByByte) {
+  uint8_t data[80];
+  uint64_t seed = 3;
+  for (uint16_t i = 0; i < 100; i++) {
+    // Include the all ones & all zeros cases for the worst carries.
+    for (uint8_t j = 0; j < sizeof(data); j++)
+      data[j] = (i < 2) ? i * 0xFF : nextRandom(&seed);
+    for (uint8_t start = 0; start < 8; start++)
+      for (uint8_t length = 0; start + length <= sizeof(data); length++) {
+        uint8_t sum = i;
+        uint8_t xored = i;
+        for (uint8_t j = start; j < start + length; j++) {
+          sum += data[j];
+          xored ^= data[j];
+        }
+        ASSERT_EQ(sum, sumBytes(data + start, length, i));
+        ASSERT_EQ(xored, xorBytes(data + start, length, i));
+      }
+  }
+}
+
+// The simple, one digit at a time, way of formatting a number.
+std::string digitByDigit(uint64_t value, uint8_t base) {
+  std::string result;
+  do {
+    const char c = value % base;
+    value /= base;
+    result.insert(result.begin(), (c < 10) ? c + '0' : c + 'A' - 10);
+  } while (value);
+  return result;
+}
+
+TEST(TestUint64ToString, SameAsDigitByDigit) {
+  // Values around every power of every base, plus some random ones.
+  std::vector<uint64_t> values = {0, UINT32_MAX, UINT32_MAX + 1ULL,
+                                  UINT64_MAX};
+  for (uint8_t base = 2; base <= 36; base++)
+    for (uint64_t power = 1; ; power *= base) {
+      values.push_back(power - 1);
+      values.push_back(power);
+      values.push_back(power + 1);
+      if (power > UINT64_MAX / base) break;
+    }
+  uint64_t seed = 4;
+  for (uint16_t i = 0; i < 2000; i++)
+    values.push_back(nextRandom(&seed) >> (i % 64));
+  char buffer[1 + kUint64TextSize + 1];
+  char * const end = buffer + 1 + kUint64TextSize;
+  for (const uint64_t value : values)
+    for (uint8_t base = 2; base <= 36; base++) {
+      const std::string expected = digitByDigit(value, base);
+      ASSERT_EQ(expected, uint64ToString(value, base))
+          << "Value: " << value << " base: " << (int)base;
+      // The text ends just before `end`, & nothing either side is touched.
+      memset(buffer, 'x', sizeof(buffer));
+      const char *ptr = uint64ToText(value, base, end);
+      EXPECT_EQ(expected, ptr);
+      EXPECT_EQ(end - 1 - expected.size(), ptr);
+      EXPECT_EQ('x', buffer[0]);
+      EXPECT_EQ('x', *end);
+    }
+  // A sink pads it out the same way.
+  char text[32];
+  IRtextSink out(text, sizeof(text));
+  out.addUint(0xA, 16, 2, '0');
+  out.addUint(123456, 10, 8);
+  out.addUint(UINT64_MAX, 10, 4);
+  EXPECT_STREQ("0A  12345618446744073709551615", text);
+  EXPECT_EQ("-9223372036854775808", int64ToString(INT64_MIN));
+  EXPECT_EQ("-7B", int64ToString(-123, 16));
+  // A sink's signed integers are the same text.
+  IRtextSink sint(text, sizeof(text));
+  sint.addInt(INT64_MIN);
+  EXPECT_STREQ(int64ToString(INT64_MIN).c_str(), text);
+  char signed_text[kInt64TextSize];
+  EXPECT_STREQ("9223372036854775807",
+               int64ToText(INT64_MAX, 10, signed_text + sizeof(signed_text)));
+}
+
 TEST(TestStrToDecodeType, strToDecodeType) {
   EXPECT_EQ(decode_type_t::NEC, strToDecodeType("NEC"));
   EXPECT_EQ(decode_type_t::KELVINATOR, strToDecodeType("KELVINATOR"));
   EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("foo"));
 }
 
+// The name tables must give the same answers as walking every name.
+TEST(TestStrToDecodeType, SameAsLinearScan) {
+  std::vector<std::string> names;
+  for (const char *ptr = kAllProtocolNamesStr; *ptr; ptr += strlen(ptr) + 1)
+    names.push_back(ptr);
+  ASSERT_EQ(kLastDecodeType + 1, names.size());
+  for (int i = 0; i <= kLastDecodeType; i++) {
+    EXPECT_EQ(names[i], typeToString((decode_type_t)i));
+    int first = 0;
+    while (strcasecmp(names[first].c_str(), names[i].c_str())) first++;
+    std::string lower = names[i];
+    for (size_t c = 0; c < lower.size(); c++) lower[c] = tolower(lower[c]);
+    EXPECT_EQ(first, strToDecodeType(names[i].c_str())) << names[i];
+    EXPECT_EQ(first, strToDecodeType(lower.c_str())) << lower;
+    EXPECT_EQ(first ? first : decode_type_t::UNKNOWN,
+              strToDecodeType(uint64ToString(i).c_str())) << i;
+  }
+  EXPECT_EQ(decode_type_t::NEC, strToDecodeType("nEc"));
+  EXPECT_EQ(decode_type_t::NEC, strToDecodeType("3"));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("NEC "));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType(""));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("0"));
+  EXPECT_EQ(decode_type_t::UNKNOWN, strToDecodeType("-1"));
+  EXPECT_EQ(decode_type_t::UNKNOWN,
+            strToDecodeType(uint64ToString(kLastDecodeType + 1).c_str()));
+}
+
 TEST(TestUtils, htmlEscape) {
   EXPECT_EQ("", irutils::htmlEscape(""));
   EXPECT_EQ("No Changes", irutils::htmlEscape("No Changes"));
@@ -492,6 +754,114 @@ TEST(TestResultToRawArray, LargeValues) {
   if (result != NULL) delete[] result;
 }
 
+TEST(TestResultToRawArray, CallerBuffer) {
+  IRsendTest irsend(0);
+  IRrecv irrecv(1);
+  uint16_t test_data[9] = {10, 20, 30, 40, 50, 60, 70, 80, 90};
+  irsend.begin();
+  irsend.reset();
+  irsend.sendRaw(test_data, 9, 38000);
+  irsend.makeDecodeResult();
+  irrecv.decode(&irsend.capture);
+  irsend.capture.rawbuf[3] = 60000;  // Needs splitting. i.e. 11 entries.
+  uint16_t large_test_data[11] = {
+      10, 20, 65535, 0, 54465, 40, 50, 60, 70, 80, 90};
+  uint16_t buffer[12] = {0};
+  // Just asking for the size.
+  EXPECT_EQ(11, resultToRawArray(&irsend.capture, NULL, 0));
+  // Too small a buffer is left untouched.
+  EXPECT_EQ(11, resultToRawArray(&irsend.capture, buffer, 10));
+  EXPECT_EQ(0, buffer[0]);
+  // Big enough. (Only the needed entries are used.)
+  buffer[11] = 1234;
+  EXPECT_EQ(11, resultToRawArray(&irsend.capture, buffer, 12));
+  EXPECT_STATE_EQ(large_test_data, buffer, 11);
+  EXPECT_EQ(1234, buffer[11]);
+  // The same buffer can be reused for the next message.
+  irsend.capture.rawbuf[3] = 30 / kRawTick;
+  EXPECT_EQ(9, resultToRawArray(&irsend.capture, buffer, 12));
+  EXPECT_STATE_EQ(test_data, buffer, 9);
+}
+
+TEST(TestPackRaw, Lossless) {
+  uint16_t rawData[9] = {10, 20, 30, 40, 50, 60, 70, 80, 90};
+  uint8_t packed[64];
+  uint16_t size = packRaw(rawData, 9, 38000, packed, sizeof(packed), 0);
+  // Header + 9 entry dictionary + 9 x 4 bit symbols.
+  ASSERT_EQ(kPackedRawHeaderSize + 9 * 2 + 5, size);
+  EXPECT_EQ(kPackedRawVersion, packed[0]);
+  EXPECT_EQ(38, packed[1]);
+  EXPECT_EQ(9, packed[2]);
+  EXPECT_EQ(4, packed[3]);
+  EXPECT_EQ(9, IRsend::packedRawLength(packed, size));
+  uint16_t result[9] = {0};
+  ASSERT_EQ(9, unpackRaw(packed, size, result, 9));
+  EXPECT_STATE_EQ(rawData, result, 9 * 8);
+  // Too small an output buffer for the result.
+  EXPECT_EQ(0, unpackRaw(packed, size, result, 8));
+  // Truncated input.
+  EXPECT_EQ(0, IRsend::packedRawLength(packed, size - 1));
+  EXPECT_EQ(0, unpackRaw(packed, size - 1, result, 9));
+}
+
+TEST(TestPackRaw, QuantisedAndRepeated) {
+  // NEC C3E0E0E8 as measured in #204, sent twice with a message gap.
+  uint16_t frame[68] = {
+      8950, 4500, 550, 1650, 600, 1650, 550, 550,  600, 500,  600, 550,
+      550,  550,  600, 1650, 550, 1650, 600, 1650, 600, 1650, 550, 1700,
+      550,  550,  600, 550,  550, 550,  600, 500,  600, 550,  550, 1650,
+      600,  1650, 600, 1650, 550, 550,  600, 500,  600, 500,  600, 550,
+      550,  550,  600, 1650, 550, 1650, 600, 1650, 600, 500,  600, 1650,
+      600,  500,  600, 550,  550, 550,  600, 40000};
+  uint16_t rawData[135];
+  for (uint16_t i = 0; i < 135; i++) rawData[i] = frame[i % 68];
+  uint8_t packed[64];
+  uint16_t size = packRaw(rawData, 135, 38, packed, sizeof(packed));
+  // 5 distinct durations, so 4 bits per symbol, and only a single frame.
+  ASSERT_EQ(kPackedRawHeaderSize + 5 * 2 + 34, size);
+  EXPECT_EQ(5, packed[2]);
+  EXPECT_EQ(4, packed[3]);
+  EXPECT_EQ(68, packed[4] | (packed[5] << 8));
+  EXPECT_EQ(135, IRsend::packedRawLength(packed, size));
+  uint16_t result[135] = {0};
+  ASSERT_EQ(135, unpackRaw(packed, size, result, 135));
+  for (uint16_t i = 0; i < 135; i++) {
+    // Group members are within tolerance of the first one seen, so the
+    // average of the group can be up to twice that from any one member.
+    EXPECT_NEAR(rawData[i], result[i],
+                rawData[i] * 2 * kPackedRawTolerance / 100)
+        << "Entry " << i << " was quantised too far.";
+    EXPECT_EQ(result[i % 68], result[i]);
+  }
+  EXPECT_EQ(40000, result[67]);
+
+  // A tighter tolerance needs more dictionary entries.
+  uint16_t lossless = packRaw(rawData, 135, 38, packed, sizeof(packed), 0);
+  ASSERT_GT(lossless, size);
+  EXPECT_EQ(8, packed[2]);
+  ASSERT_EQ(135, unpackRaw(packed, lossless, result, 135));
+  EXPECT_STATE_EQ(rawData, result, 135 * 8);
+}
+
+TEST(TestPackRaw, Failures) {
+  uint16_t rawData[17] = {100, 200, 300, 400, 500, 600, 700, 800, 900, 1000,
+                          1100, 1200, 1300, 1400, 1500, 1600, 1700};
+  uint8_t packed[64];
+  // Too many distinct durations.
+  EXPECT_EQ(0, packRaw(rawData, 17, 38, packed, sizeof(packed), 0));
+  // Fewer distinct durations is fine.
+  EXPECT_LT(0, packRaw(rawData, 16, 38, packed, sizeof(packed), 0));
+  // Not enough room for the output.
+  EXPECT_EQ(0, packRaw(rawData, 16, 38, packed, kPackedRawHeaderSize, 0));
+  // Nothing to pack.
+  EXPECT_EQ(0, packRaw(rawData, 0, 38, packed, sizeof(packed)));
+  EXPECT_EQ(0, packRaw(NULL, 16, 38, packed, sizeof(packed)));
+  // Bad version.
+  ASSERT_LT(0, packRaw(rawData, 16, 38, packed, sizeof(packed), 0));
+  packed[0] = kPackedRawVersion + 1;
+  EXPECT_EQ(0, IRsend::packedRawLength(packed, sizeof(packed)));
+}
+
 TEST(TestUtils, TypeStringConversionRangeTests) {
   ASSERT_EQ("UNKNOWN", typeToString((decode_type_t)(kLastDecodeType + 1)));
   ASSERT_EQ("UNKNOWN", typeToString(decode_type_t::UNKNOWN));
@@ -777,6 +1147,67 @@ TEST(TestUtils, InvertedBytePairs) {
   EXPECT_STATE_EQ(correct, wrong, 6 * 8);
 }
 
+#if _IR_LOCALE_POOL_
+// Only when built with the runtime switchable locale pool.
+TEST(TestUtils, LocalePool) {
+  const uint8_t start = irtextGetLocale();
+  EXPECT_STREQ(ENQUOTE(_IR_LOCALE_), irtextLocaleName(start));
+  EXPECT_STREQ(D_STR_COOL, kCoolStr);
+  const IRtextValue table[] = {{kCoolStrId, 1}, {kOffStrId, 2}};
+  ASSERT_TRUE(irtextSetLocale("de-de"));  // Case insensitive.
+  EXPECT_STREQ("de-DE", irtextLocaleName(irtextGetLocale()));
+  EXPECT_STREQ("Kühlen", kCoolStr);
+  EXPECT_STREQ("Aus", kOffStr);
+  EXPECT_EQ(2, irutils::textToValue("aus", table, 2, 0));
+  ASSERT_TRUE(irtextSetLocale("fr-FR"));
+  EXPECT_STREQ("Frais", kCoolStr);
+  EXPECT_EQ(1, irutils::textToValue("FRAIS", table, 2, 0));
+  EXPECT_EQ(0, irutils::textToValue("Kühlen", table, 2, 0));
+  // Nothing changes for locales that aren't in the pool.
+  EXPECT_FALSE(irtextSetLocale("xx-XX"));
+  EXPECT_FALSE(irtextSetLocale("fr-FRX"));
+  EXPECT_FALSE(irtextSetLocale("fr"));
+  EXPECT_FALSE(irtextSetLocale(kIrTextPoolLocales));
+  EXPECT_FALSE(irtextSetLocale(static_cast<const char *>(NULL)));
+  EXPECT_STREQ("Frais", kCoolStr);
+  EXPECT_EQ(NULL, irtextLocaleName(kIrTextPoolLocales));
+  EXPECT_STREQ(kUnknownStr, irtextPoolStr(kIrTextPoolEntries));
+  ASSERT_TRUE(irtextSetLocale(start));
+  EXPECT_STREQ(D_STR_COOL, kCoolStr);
+}
+#endif  // _IR_LOCALE_POOL_
+
+TEST(TestUtils, IRtextSink) {
+  char buffer[8];
+  IRtextSink out(buffer, sizeof(buffer));
+  EXPECT_STREQ("", buffer);
+  out.add("Foo");
+  out.add(':');
+  out.addInt(-42);
+  EXPECT_STREQ("Foo:-42", buffer);
+  EXPECT_EQ(7, out.length());
+  EXPECT_FALSE(out.overflowed());
+  out.addUint(UINT64_MAX);
+  EXPECT_STREQ("Foo:-42", buffer);
+  EXPECT_EQ(27, out.length());
+  EXPECT_TRUE(out.overflowed());
+
+  String text = "";
+  IRtextSink str(&text);
+  str.addUint(0);
+  str.add(String(" & "));
+  str.addUint(UINT64_MAX);
+  EXPECT_EQ("0 & 18446744073709551615", text);
+  EXPECT_FALSE(str.overflowed());
+
+  // Same as the String versions.
+  IRtextSink fan(&text);
+  text = "";
+  irutils::addFanToString(&fan, 3, 1, 2, 3, 4, 5);
+  EXPECT_EQ(irutils::addFanToString(3, 1, 2, 3, 4, 5), text);
+  EXPECT_EQ(", Fan: 3 (Auto)", text);
+}
+
 TEST(TestUtils, lowLevelSanityCheck) {
   ASSERT_EQ(0, irutils::lowLevelSanityCheck());
 }
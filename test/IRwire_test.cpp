@@ -0,0 +1,225 @@
+// Copyright 2026 IRremoteESP8266 project and others
+
+#include "IRwire.h"
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRrecv_test.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+#include "ir_Rhoss.h"
+#include "gtest/gtest.h"
+
+TEST(TestIRwire, SimpleResults) {
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+  irsend.reset();
+  irsend.sendNEC(0x4BB640BF);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+
+  uint8_t buffer[kIrWireResultsSizeMax + kIrWireRawSizeMax * kRawBuf];
+  const uint16_t length = irwire::encodeResults(&irsend.capture, buffer,
+                                                sizeof(buffer));
+  ASSERT_NE(0, length);
+  // The raw timings dominate, but it's still a fraction of them as text.
+  EXPECT_GT(resultToSourceCode(&irsend.capture).length() / 3, length);
+  // Without them it's tiny.
+  EXPECT_GT(16, irwire::encodeResults(&irsend.capture, buffer, sizeof(buffer),
+                                      false));
+
+  IRwireResults view;
+  EXPECT_EQ(length, irwire::encodeResults(&irsend.capture, buffer,
+                                          sizeof(buffer)));
+  EXPECT_EQ(length, irwire::decodeResults(buffer, length, &view));
+  EXPECT_EQ(decode_type_t::NEC, view.decode_type);
+  EXPECT_EQ(kNECBits, view.bits);
+  EXPECT_EQ(0x4BB640BF, view.value);
+  EXPECT_EQ(irsend.capture.address, view.address);
+  EXPECT_EQ(irsend.capture.command, view.command);
+  EXPECT_FALSE(view.repeat);
+  EXPECT_EQ(NULL, view.state);
+  EXPECT_EQ(irsend.capture.rawlen, view.rawlen);
+  // The raw timings are read straight out of the buffer.
+  EXPECT_GE(view.raw, buffer);
+  EXPECT_EQ(buffer + length, view.raw + view.rawSize);
+  IRwireRaw raw(view);
+  EXPECT_EQ(irsend.capture.rawlen, raw.remaining());
+  uint16_t timing;
+  for (uint16_t i = 0; i < irsend.capture.rawlen; i++) {
+    ASSERT_TRUE(raw.next(&timing));
+    EXPECT_EQ(irsend.capture.rawbuf[i], timing);
+  }
+  EXPECT_FALSE(raw.next(&timing));
+
+  // Copy it back into a decode_results.
+  decode_results copy;
+  uint16_t rawbuf[kRawBuf];
+  EXPECT_FALSE(irwire::copyResults(view, &copy, rawbuf, view.rawlen - 1));
+  EXPECT_EQ(0, copy.rawlen);
+  EXPECT_TRUE(irwire::copyResults(view, &copy, rawbuf, kRawBuf));
+  EXPECT_EQ(resultToSourceCode(&irsend.capture), resultToSourceCode(&copy));
+  EXPECT_EQ(resultToHumanReadableBasic(&irsend.capture),
+            resultToHumanReadableBasic(&copy));
+}
+
+TEST(TestIRwire, StateResults) {
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+  const uint8_t state[kRhossStateLength] = {
+      0xAA, 0x05, 0x60, 0x00, 0x50, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x33};
+  irsend.reset();
+  irsend.sendRhoss(state);
+  irsend.makeDecodeResult();
+  ASSERT_TRUE(irrecv.decode(&irsend.capture));
+  ASSERT_EQ(decode_type_t::RHOSS, irsend.capture.decode_type);
+
+  uint8_t buffer[kIrWireResultsSizeMax];
+  // No raw timings: header, flags, protocol, bits, length, & the state.
+  const uint16_t length = irwire::encodeResults(&irsend.capture, buffer,
+                                                sizeof(buffer), false);
+  EXPECT_EQ(2 + 1 + 1 + 1 + kRhossStateLength, length);
+  IRwireResults view;
+  EXPECT_EQ(length, irwire::decodeResults(buffer, length, &view));
+  EXPECT_EQ(decode_type_t::RHOSS, view.decode_type);
+  EXPECT_EQ(kRhossBits, view.bits);
+  EXPECT_EQ(kRhossStateLength, view.stateLength);
+  EXPECT_EQ(buffer + length - kRhossStateLength, view.state);
+  EXPECT_EQ(0, view.rawlen);
+  EXPECT_EQ(NULL, view.raw);
+
+  decode_results copy;
+  EXPECT_TRUE(irwire::copyResults(view, &copy));
+  EXPECT_EQ(0, copy.rawlen);
+  EXPECT_STATE_EQ(state, copy.state, kRhossBits);
+  EXPECT_EQ(IRAcUtils::resultAcToString(&irsend.capture),
+            IRAcUtils::resultAcToString(&copy));
+}
+
+TEST(TestIRwire, BadResults) {
+  decode_results results;
+  uint16_t rawbuf[3] = {100, 200, 300};
+  results.decode_type = decode_type_t::NEC;
+  results.bits = kNECBits;
+  results.value = 0x12345678;
+  results.address = 0;
+  results.command = 0;
+  results.repeat = true;
+  results.overflow = false;
+  results.rawbuf = rawbuf;
+  results.rawlen = 3;
+  uint8_t buffer[32];
+  const uint16_t length = irwire::encodeResults(&results, buffer,
+                                                sizeof(buffer));
+  ASSERT_EQ(2 + 1 + 1 + 5 + 1 + 1 + 2 + 2, length);
+  // Too small a buffer is never overrun.
+  for (uint16_t size = 0; size < length; size++) {
+    buffer[size] = 0xEE;
+    EXPECT_EQ(0, irwire::encodeResults(&results, buffer, size));
+    EXPECT_EQ(0xEE, buffer[size]);
+  }
+  ASSERT_EQ(length, irwire::encodeResults(&results, buffer, length));
+  IRwireResults view;
+  ASSERT_EQ(length, irwire::decodeResults(buffer, length, &view));
+  EXPECT_TRUE(view.repeat);
+  // A truncated message is rejected.
+  for (uint16_t size = 0; size < length; size++)
+    EXPECT_EQ(0, irwire::decodeResults(buffer, size, &view));
+  // Trailing data is left for the next message.
+  EXPECT_EQ(length, irwire::decodeResults(buffer, sizeof(buffer), &view));
+  // Other versions & message types are rejected.
+  buffer[0]++;
+  EXPECT_EQ(0, irwire::decodeResults(buffer, length, &view));
+  buffer[0] = (kIrWireState << 4) | kIrWireVersion;
+  EXPECT_EQ(0, irwire::decodeResults(buffer, length, &view));
+  // A raw timing that's too big is rejected.
+  ASSERT_EQ(length, irwire::encodeResults(&results, buffer, length));
+  buffer[length - 1] = 0x80 | buffer[length - 1];
+  buffer[length] = 0x7F;
+  EXPECT_EQ(0, irwire::decodeResults(buffer, length + 1, &view));
+  EXPECT_EQ(0, irwire::decodeResults(NULL, length, &view));
+}
+
+// The documented size is always enough, even for the biggest non-state message.
+TEST(TestIRwire, WorstCaseResults) {
+  const uint16_t kRawLen = 200;
+  decode_results results;
+  uint16_t rawbuf[kRawLen];
+  for (uint16_t i = 0; i < kRawLen; i++) rawbuf[i] = UINT16_MAX;
+  results.decode_type = decode_type_t::NEC;
+  results.bits = UINT16_MAX;
+  results.value = UINT64_MAX;
+  results.address = UINT32_MAX;
+  results.command = UINT32_MAX;
+  results.repeat = true;
+  results.overflow = true;
+  results.rawbuf = rawbuf;
+  results.rawlen = kRawLen;
+  uint8_t buffer[kIrWireResultsSizeMax + kIrWireRawSizeMax * kRawLen];
+  const uint16_t length = irwire::encodeResults(&results, buffer,
+                                                sizeof(buffer));
+  ASSERT_NE(0, length);
+  IRwireResults view;
+  ASSERT_EQ(length, irwire::decodeResults(buffer, length, &view));
+  EXPECT_EQ(UINT64_MAX, view.value);
+  EXPECT_EQ(UINT32_MAX, view.address);
+  EXPECT_EQ(UINT32_MAX, view.command);
+  EXPECT_EQ(kRawLen, view.rawlen);
+  // & the biggest state[] message.
+  results.decode_type = decode_type_t::RHOSS;
+  results.bits = kStateSizeMax * 8;
+  for (uint16_t i = 0; i < kStateSizeMax; i++) results.state[i] = 0xFF;
+  ASSERT_NE(0, irwire::encodeResults(&results, buffer, sizeof(buffer)));
+  ASSERT_NE(0, irwire::decodeResults(buffer, sizeof(buffer), &view));
+  EXPECT_EQ(kStateSizeMax, view.stateLength);
+}
+
+TEST(TestIRwire, State) {
+  stdAc::state_t state;
+  uint8_t buffer[kIrWireStateSizeMax];
+  // The default state.
+  EXPECT_EQ(13, irwire::encodeState(state, buffer, sizeof(buffer)));
+  const uint8_t expected[13] = {
+      0x21,  // Header
+      0x00, 0x00, 0x80, 0x00,  // Enums & flags. i.e. Only celsius is set.
+      0x01,  // model
+      0x01,  // sleep
+      0x88, 0x27,  // degrees
+      0x9F, 0x9C, 0x01,  // sensorTemperature
+      0x01};  // clock
+  EXPECT_STATE_EQ(expected, buffer, 13 * 8);
+  stdAc::state_t result;
+  result.power = true;
+  EXPECT_EQ(13, irwire::decodeState(buffer, sizeof(buffer), &result));
+  EXPECT_FALSE(result.power);
+
+  IRac::initState(&state, decode_type_t::LG, lg_ac_remote_model_t::AKB74955603,
+                  true, stdAc::opmode_t::kHeat, 21.5, true,
+                  stdAc::fanspeed_t::kMediumHigh, stdAc::swingv_t::kHighest,
+                  stdAc::swingh_t::kWide, false, true, false, true, false,
+                  true, true, 120, 23 * 60 + 59);
+  state.command = stdAc::ac_command_t::kConfigCommand;
+  state.iFeel = true;
+  state.sensorTemperature = -12.25;
+  const uint16_t length = irwire::encodeState(state, buffer, sizeof(buffer));
+  EXPECT_GE(kIrWireStateSizeMax, length);
+  EXPECT_EQ(length, irwire::decodeState(buffer, length, &result));
+  EXPECT_FALSE(IRac::cmpStates(IRac::packState(state),
+                               IRac::packState(result)));
+  EXPECT_EQ(state.clock, result.clock);
+  EXPECT_EQ(21.5, result.degrees);
+  EXPECT_EQ(-12.25, result.sensorTemperature);
+  EXPECT_EQ(stdAc::swingh_t::kWide, result.swingh);
+  EXPECT_TRUE(result.iFeel);
+
+  for (uint16_t size = 0; size < length; size++) {
+    EXPECT_EQ(0, irwire::encodeState(state, buffer, size));
+    EXPECT_EQ(0, irwire::decodeState(buffer, size, &result));
+  }
+  // An invalid enum value is rejected.
+  ASSERT_EQ(length, irwire::encodeState(state, buffer, sizeof(buffer)));
+  buffer[2] |= 0x07;  // mode
+  EXPECT_EQ(0, irwire::decodeState(buffer, length, &result));
+}
@@ -1,6 +1,7 @@
 // Copyright 2017, 2019 David Conran
 
 #include "ir_LG.h"
+#include <vector>
 #include "IRac.h"
 #include "IRsend.h"
 #include "IRsend_test.h"
@@ -916,6 +917,44 @@ TEST(TestIRLgAcClass, DifferentModels) {
   ASSERT_TRUE(IRAcUtils::decodeToState(&ac._irsend.capture, &r, &p));
 }
 
+TEST(TestIRLgAcClass, ToStringSink) {
+  IRLgAc ac(kGpioUnused);
+  IRrecv capture(kGpioUnused);
+  ac.setRaw(0x8800347);
+  ac.setModel(lg_ac_remote_model_t::GE6711AR2853M);
+  ac.send();
+  const char expected[] =
+      "Model: 1 (GE6711AR2853M), "
+      "Power: On, Mode: 0 (Cool), Temp: 18C, Fan: 4 (Maximum)";
+  char buffer[100];
+  IRtextSink out(buffer, sizeof(buffer));
+  ac.toString(&out);
+  EXPECT_STREQ(expected, buffer);
+  EXPECT_EQ(strlen(expected), out.length());
+  EXPECT_FALSE(out.overflowed());
+
+  // Too small, so it is truncated.
+  char small[20];
+  IRtextSink truncated(small, sizeof(small));
+  ac.toString(&truncated);
+  EXPECT_STREQ("Model: 1 (GE6711AR2", small);
+  EXPECT_EQ(strlen(expected), truncated.length());
+  EXPECT_TRUE(truncated.overflowed());
+
+  ac._irsend.makeDecodeResult();
+  EXPECT_TRUE(capture.decode(&ac._irsend.capture));
+  IRtextSink result(buffer, sizeof(buffer));
+  EXPECT_TRUE(IRAcUtils::resultAcToString(&result, &ac._irsend.capture));
+  EXPECT_STREQ(expected, buffer);
+
+  // Not an A/C message we understand.
+  ac._irsend.capture.decode_type = decode_type_t::NEC;
+  IRtextSink none(buffer, sizeof(buffer));
+  EXPECT_FALSE(IRAcUtils::resultAcToString(&none, &ac._irsend.capture));
+  EXPECT_STREQ("", buffer);
+  EXPECT_EQ(0, none.length());
+}
+
 TEST(TestIRLgAcClass, FanSpeedIssue1214) {
   EXPECT_EQ(kLgAcFanLowest, IRLgAc::convertFan(stdAc::fanspeed_t::kMin));
   EXPECT_EQ(kLgAcFanLow, IRLgAc::convertFan(stdAc::fanspeed_t::kLow));
@@ -1190,3 +1229,116 @@ TEST(TestIRLgAcClass, SwingVToggle) {
   EXPECT_EQ(ac._swingv, kLgAcSwingVToggle);
   EXPECT_NE(ac._swingv_prev, kLgAcSwingVToggle);
 }
+
+// Every message IRLgAc::encode() says it can do on its own must be exactly
+// what IRac::lg() sends with a new object.
+TEST(TestIRLgAcClass, Encode) {
+  const int16_t models[] = {
+      -1, lg_ac_remote_model_t::GE6711AR2853M,
+      lg_ac_remote_model_t::LG6711A20083V, lg_ac_remote_model_t::AKB75215403,
+      lg_ac_remote_model_t::AKB74955603, lg_ac_remote_model_t::AKB73757604};
+  IRac irac(kGpioUnused);
+  IRLgAc ac(kGpioUnused);  // Reset before each use. i.e. As good as new.
+  IRsendTest irsend(kGpioUnused);
+  irsend.begin();
+  stdAc::state_t state;
+  IRac::initState(&state);
+  uint32_t code;
+  decode_type_t protocol;
+  uint32_t total = 0;
+  uint32_t single = 0;
+  for (const int16_t model : models) {
+    state.model = model;
+    for (uint8_t power = 0; power < 2; power++) {
+      state.power = power;
+      // Everything in the message itself.
+      for (int8_t mode = -1; mode <= (int8_t)stdAc::opmode_t::kLastOpmodeEnum;
+           mode++) {
+        state.mode = (stdAc::opmode_t)mode;
+        // Whole & half degrees, plus some a F to C conversion might give.
+        std::vector<float> temps = {20.3, 23.999998, 29.99};
+        for (float degrees = 14; degrees <= 32; degrees += 0.5)
+          temps.push_back(degrees);
+        for (const float degrees : temps) {
+          state.degrees = degrees;
+          for (uint8_t fan = 0;
+               fan <= (uint8_t)stdAc::fanspeed_t::kLastFanspeedEnum; fan++) {
+            state.fanspeed = (stdAc::fanspeed_t)fan;
+            const bool ok = IRLgAc::encode(state, stdAc::swingv_t::kOff,
+                                           &code, &protocol);
+            // Don't let the simulated clock wrap around mid-message.
+            _IRtimer_unittest_now = 0;
+            ac.stateReset();
+            ac._irsend.reset();
+            irac.lg(&ac, (lg_ac_remote_model_t)model, state.power,
+                    state.mode, state.degrees, state.fanspeed,
+                    state.swingv, stdAc::swingv_t::kOff, state.swingh,
+                    state.light);
+            irsend.reset();
+            irsend.send(protocol, code, kLgBits);
+            total++;
+            const std::string expected = ac._irsend.outputStr();
+            const std::string encoded = irsend.outputStr();
+            if (ok) {
+              single++;
+              ASSERT_EQ(expected, encoded)
+                  << "Model: " << model << " Power: " << state.power
+                  << " Mode: " << (int)mode << " Temp: " << degrees
+                  << " Fan: " << (int)fan;
+            } else {  // It must need more than just the one message.
+              ASSERT_NE(expected, encoded);
+              ASSERT_EQ(0, expected.find(encoded));
+            }
+          }
+        }
+      }
+      state.mode = stdAc::opmode_t::kCool;
+      state.degrees = 23;
+      state.fanspeed = stdAc::fanspeed_t::kAuto;
+      // The extra messages some models need.
+      for (int8_t swingv = -1;
+           swingv <= (int8_t)stdAc::swingv_t::kLastSwingvEnum; swingv++) {
+        state.swingv = (stdAc::swingv_t)swingv;
+        for (int8_t prev = -1;
+             prev <= (int8_t)stdAc::swingv_t::kLastSwingvEnum; prev++) {
+          // Only Off or not matters for SwingH.
+          for (int8_t swingh = -1; swingh <= 0; swingh++) {
+            state.swingh = (stdAc::swingh_t)swingh;
+            for (uint8_t light = 0; light < 2; light++) {
+              state.light = light;
+              const bool ok = IRLgAc::encode(state, (stdAc::swingv_t)prev,
+                                             &code, &protocol);
+              _IRtimer_unittest_now = 0;
+              ac.stateReset();
+              ac._irsend.reset();
+              irac.lg(&ac, (lg_ac_remote_model_t)model, state.power,
+                      state.mode, state.degrees, state.fanspeed,
+                      state.swingv, (stdAc::swingv_t)prev, state.swingh,
+                      state.light);
+              irsend.reset();
+              irsend.send(protocol, code, kLgBits);
+              total++;
+              const std::string expected = ac._irsend.outputStr();
+              const std::string encoded = irsend.outputStr();
+              if (ok) {
+                single++;
+                ASSERT_EQ(expected, encoded)
+                    << "Model: " << model << " Power: " << state.power
+                    << " SwingV: " << (int)swingv << " Prev: " << (int)prev
+                    << " SwingH: " << (int)swingh << " Light: " << state.light;
+              } else {
+                ASSERT_NE(expected, encoded);
+                ASSERT_EQ(0, expected.find(encoded));
+              }
+            }
+          }
+        }
+      }
+      state.swingv = stdAc::swingv_t::kOff;
+      state.swingh = stdAc::swingh_t::kOff;
+      state.light = true;
+    }
+  }
+  // Most states are a single message.
+  EXPECT_LT(total / 2, single);
+}
@@ -353,6 +353,26 @@ TEST(TestRhossAcClass, Swing) {
   EXPECT_TRUE(ac.getSwing());
 }
 
+TEST(TestRhossAcClass, ToStringSink) {
+  IRRhossAc ac(kGpioUnused);
+  ac.begin();
+  ac.setPower(true);
+  ac.setMode(kRhossModeCool);
+  ac.setTemp(24);
+  ac.setSwing(true);
+  char buffer[80];
+  IRtextSink out(buffer, sizeof(buffer));
+  ac.toString(&out);
+  EXPECT_EQ(ac.toString(), buffer);
+  EXPECT_FALSE(out.overflowed());
+  // Appending to an existing String.
+  String text = "Rhoss: ";
+  IRtextSink append(&text);
+  ac.toString(&append);
+  EXPECT_EQ("Rhoss: " + ac.toString(), text);
+  EXPECT_EQ(ac.toString().length(), append.length());
+}
+
 TEST(TestRhossAcClass, Checksums) {
   uint8_t state[kRhossStateLength] = {
     0xAA, 0x05, 0x60, 0x00, 0x50, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x33 };
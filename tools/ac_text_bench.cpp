@@ -0,0 +1,313 @@
+// Quick and dirty tool to compare the speed of the IRac text to enum parsers
+// with the old way of comparing the text against every possibility in turn.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Every known text (in a few different cases) plus some that aren't known are
+// checked against the old behaviour first.
+//
+// Usage example:
+//   ./ac_text_bench
+//   ./ac_text_bench --loops 1000
+
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <string>
+#include <vector>
+#include "IRac.h"
+#include "IRtext.h"
+#include "IRutils.h"
+
+const uint32_t kDefaultLoops = 2000;
+
+// The old if/else chains, as lists in the same order.
+struct OldText {
+  template <typename T>
+  OldText(const char *text, const T value)
+      : text(text), value((int16_t)value) {}
+  const char *text;
+  int16_t value;
+};
+
+const OldText kOldOpmode[] = {
+    {kAutoStr, stdAc::opmode_t::kAuto},
+    {kAutomaticStr, stdAc::opmode_t::kAuto},
+    {kOffStr, stdAc::opmode_t::kOff},
+    {kStopStr, stdAc::opmode_t::kOff},
+    {kCoolStr, stdAc::opmode_t::kCool},
+    {kCoolingStr, stdAc::opmode_t::kCool},
+    {kHeatStr, stdAc::opmode_t::kHeat},
+    {kHeatingStr, stdAc::opmode_t::kHeat},
+    {kDryStr, stdAc::opmode_t::kDry},
+    {kDryingStr, stdAc::opmode_t::kDry},
+    {kDehumidifyStr, stdAc::opmode_t::kDry},
+    {kFanStr, stdAc::opmode_t::kFan},
+    {kFanOnlyStr, stdAc::opmode_t::kFan},
+    {kFan_OnlyStr, stdAc::opmode_t::kFan},
+    {kFanOnlyWithSpaceStr, stdAc::opmode_t::kFan},
+    {kFanOnlyNoSpaceStr, stdAc::opmode_t::kFan},
+};
+
+const OldText kOldFanspeed[] = {
+    {kAutoStr, stdAc::fanspeed_t::kAuto},
+    {kAutomaticStr, stdAc::fanspeed_t::kAuto},
+    {kMinStr, stdAc::fanspeed_t::kMin},
+    {kMinimumStr, stdAc::fanspeed_t::kMin},
+    {kLowestStr, stdAc::fanspeed_t::kMin},
+    {kLowStr, stdAc::fanspeed_t::kLow},
+    {kLoStr, stdAc::fanspeed_t::kLow},
+    {kMedStr, stdAc::fanspeed_t::kMedium},
+    {kMediumStr, stdAc::fanspeed_t::kMedium},
+    {kMidStr, stdAc::fanspeed_t::kMedium},
+    {kHighStr, stdAc::fanspeed_t::kHigh},
+    {kHiStr, stdAc::fanspeed_t::kHigh},
+    {kMaxStr, stdAc::fanspeed_t::kMax},
+    {kMaximumStr, stdAc::fanspeed_t::kMax},
+    {kHighestStr, stdAc::fanspeed_t::kMax},
+    {kMedHighStr, stdAc::fanspeed_t::kMediumHigh},
+};
+
+const OldText kOldSwingV[] = {
+    {kAutoStr, stdAc::swingv_t::kAuto},
+    {kAutomaticStr, stdAc::swingv_t::kAuto},
+    {kOnStr, stdAc::swingv_t::kAuto},
+    {kSwingStr, stdAc::swingv_t::kAuto},
+    {kOffStr, stdAc::swingv_t::kOff},
+    {kStopStr, stdAc::swingv_t::kOff},
+    {kMinStr, stdAc::swingv_t::kLowest},
+    {kMinimumStr, stdAc::swingv_t::kLowest},
+    {kLowestStr, stdAc::swingv_t::kLowest},
+    {kBottomStr, stdAc::swingv_t::kLowest},
+    {kDownStr, stdAc::swingv_t::kLowest},
+    {kLowStr, stdAc::swingv_t::kLow},
+    {kMidStr, stdAc::swingv_t::kMiddle},
+    {kMiddleStr, stdAc::swingv_t::kMiddle},
+    {kMedStr, stdAc::swingv_t::kMiddle},
+    {kMediumStr, stdAc::swingv_t::kMiddle},
+    {kCentreStr, stdAc::swingv_t::kMiddle},
+    {kUpperMiddleStr, stdAc::swingv_t::kUpperMiddle},
+    {kHighStr, stdAc::swingv_t::kHigh},
+    {kHiStr, stdAc::swingv_t::kHigh},
+    {kHighestStr, stdAc::swingv_t::kHighest},
+    {kMaxStr, stdAc::swingv_t::kHighest},
+    {kMaximumStr, stdAc::swingv_t::kHighest},
+    {kTopStr, stdAc::swingv_t::kHighest},
+    {kUpStr, stdAc::swingv_t::kHighest},
+};
+
+const OldText kOldSwingH[] = {
+    {kAutoStr, stdAc::swingh_t::kAuto},
+    {kAutomaticStr, stdAc::swingh_t::kAuto},
+    {kOnStr, stdAc::swingh_t::kAuto},
+    {kSwingStr, stdAc::swingh_t::kAuto},
+    {kOffStr, stdAc::swingh_t::kOff},
+    {kStopStr, stdAc::swingh_t::kOff},
+    {kLeftMaxNoSpaceStr, stdAc::swingh_t::kLeftMax},
+    {kLeftMaxStr, stdAc::swingh_t::kLeftMax},
+    {kMaxLeftNoSpaceStr, stdAc::swingh_t::kLeftMax},
+    {kMaxLeftStr, stdAc::swingh_t::kLeftMax},
+    {kLeftStr, stdAc::swingh_t::kLeft},
+    {kMidStr, stdAc::swingh_t::kMiddle},
+    {kMiddleStr, stdAc::swingh_t::kMiddle},
+    {kMedStr, stdAc::swingh_t::kMiddle},
+    {kMediumStr, stdAc::swingh_t::kMiddle},
+    {kCentreStr, stdAc::swingh_t::kMiddle},
+    {kRightStr, stdAc::swingh_t::kRight},
+    {kRightMaxNoSpaceStr, stdAc::swingh_t::kRightMax},
+    {kRightMaxStr, stdAc::swingh_t::kRightMax},
+    {kMaxRightNoSpaceStr, stdAc::swingh_t::kRightMax},
+    {kMaxRightStr, stdAc::swingh_t::kRightMax},
+    {kWideStr, stdAc::swingh_t::kWide},
+};
+
+const OldText kOldModel[] = {
+    {kYaw1fStr, gree_ac_remote_model_t::YAW1F},
+    {kYbofbStr, gree_ac_remote_model_t::YBOFB},
+    {kYx1fsfStr, gree_ac_remote_model_t::YX1FSF},
+    {kV9014557AStr, haier_ac176_remote_model_t::V9014557_A},
+    {kV9014557BStr, haier_ac176_remote_model_t::V9014557_B},
+    {kRlt0541htaaStr, hitachi_ac1_remote_model_t::R_LT0541_HTA_A},
+    {kRlt0541htabStr, hitachi_ac1_remote_model_t::R_LT0541_HTA_B},
+    {kArrah2eStr, fujitsu_ac_remote_model_t::ARRAH2E},
+    {kArdb1Str, fujitsu_ac_remote_model_t::ARDB1},
+    {kArreb1eStr, fujitsu_ac_remote_model_t::ARREB1E},
+    {kArjw2Str, fujitsu_ac_remote_model_t::ARJW2},
+    {kArry4Str, fujitsu_ac_remote_model_t::ARRY4},
+    {kArrew4eStr, fujitsu_ac_remote_model_t::ARREW4E},
+    {kGe6711ar2853mStr, lg_ac_remote_model_t::GE6711AR2853M},
+    {kAkb75215403Str, lg_ac_remote_model_t::AKB75215403},
+    {kAkb74955603Str, lg_ac_remote_model_t::AKB74955603},
+    {kAkb73757604Str, lg_ac_remote_model_t::AKB73757604},
+    {kLg6711a20083vStr, lg_ac_remote_model_t::LG6711A20083V},
+    {kLkeStr, panasonic_ac_remote_model_t::kPanasonicLke},
+    {kPanasonicLkeStr, panasonic_ac_remote_model_t::kPanasonicLke},
+    {kNkeStr, panasonic_ac_remote_model_t::kPanasonicNke},
+    {kPanasonicNkeStr, panasonic_ac_remote_model_t::kPanasonicNke},
+    {kDkeStr, panasonic_ac_remote_model_t::kPanasonicDke},
+    {kPanasonicDkeStr, panasonic_ac_remote_model_t::kPanasonicDke},
+    {kPkrStr, panasonic_ac_remote_model_t::kPanasonicDke},
+    {kPanasonicPkrStr, panasonic_ac_remote_model_t::kPanasonicDke},
+    {kJkeStr, panasonic_ac_remote_model_t::kPanasonicJke},
+    {kPanasonicJkeStr, panasonic_ac_remote_model_t::kPanasonicJke},
+    {kCkpStr, panasonic_ac_remote_model_t::kPanasonicCkp},
+    {kPanasonicCkpStr, panasonic_ac_remote_model_t::kPanasonicCkp},
+    {kRkrStr, panasonic_ac_remote_model_t::kPanasonicRkr},
+    {kPanasonicRkrStr, panasonic_ac_remote_model_t::kPanasonicRkr},
+    {kA907Str, sharp_ac_remote_model_t::A907},
+    {kA705Str, sharp_ac_remote_model_t::A705},
+    {kA903Str, sharp_ac_remote_model_t::A903},
+    {kTac09chsdStr, tcl_ac_remote_model_t::TAC09CHSD},
+    {kGz055be1Str, tcl_ac_remote_model_t::GZ055BE1},
+    {k122lzfStr, voltas_ac_remote_model_t::kVoltas122LZF},
+    {kDg11j13aStr, whirlpool_ac_remote_model_t::DG11J13A},
+    {kDg11j104Str, whirlpool_ac_remote_model_t::DG11J13A},
+    {kDg11j191Str, whirlpool_ac_remote_model_t::DG11J191},
+    {kArgoWrem2Str, argo_ac_remote_model_t::SAC_WREM2},
+    {kArgoWrem3Str, argo_ac_remote_model_t::SAC_WREM3},
+};
+
+#define OLD_TEXT_COUNT(TABLE) (sizeof(TABLE) / sizeof(TABLE[0]))
+
+int16_t oldTextToValue(const char *str, const OldText *table,
+                       const size_t size, const int16_t def) {
+  for (size_t i = 0; i < size; i++)
+    if (!strcasecmp(str, table[i].text)) return table[i].value;
+  return def;
+}
+
+int16_t oldStrToModel(const char *str, const int16_t def) {
+  for (size_t i = 0; i < OLD_TEXT_COUNT(kOldModel); i++)
+    if (!strcasecmp(str, kOldModel[i].text)) return kOldModel[i].value;
+  int16_t number = atoi(str);
+  return (number > 0) ? number : def;
+}
+
+struct Parser {
+  const char *name;
+  const OldText *table;
+  size_t size;
+  int16_t (*parse)(const char *str);
+  int16_t (*old)(const char *str);
+};
+
+int16_t newOpmode(const char *str) {
+  return (int16_t)IRac::strToOpmode(str, stdAc::opmode_t::kOff);
+}
+int16_t oldOpmode(const char *str) {
+  return oldTextToValue(str, kOldOpmode, OLD_TEXT_COUNT(kOldOpmode),
+                        (int16_t)stdAc::opmode_t::kOff);
+}
+int16_t newFanspeed(const char *str) {
+  return (int16_t)IRac::strToFanspeed(str, stdAc::fanspeed_t::kMin);
+}
+int16_t oldFanspeed(const char *str) {
+  return oldTextToValue(str, kOldFanspeed, OLD_TEXT_COUNT(kOldFanspeed),
+                        (int16_t)stdAc::fanspeed_t::kMin);
+}
+int16_t newSwingV(const char *str) {
+  return (int16_t)IRac::strToSwingV(str, stdAc::swingv_t::kOff);
+}
+int16_t oldSwingV(const char *str) {
+  return oldTextToValue(str, kOldSwingV, OLD_TEXT_COUNT(kOldSwingV),
+                        (int16_t)stdAc::swingv_t::kOff);
+}
+int16_t newSwingH(const char *str) {
+  return (int16_t)IRac::strToSwingH(str, stdAc::swingh_t::kOff);
+}
+int16_t oldSwingH(const char *str) {
+  return oldTextToValue(str, kOldSwingH, OLD_TEXT_COUNT(kOldSwingH),
+                        (int16_t)stdAc::swingh_t::kOff);
+}
+int16_t newModel(const char *str) { return IRac::strToModel(str, -1); }
+int16_t oldModel(const char *str) { return oldStrToModel(str, -1); }
+
+const Parser kParsers[] = {
+    {"strToOpmode", kOldOpmode, OLD_TEXT_COUNT(kOldOpmode), newOpmode,
+     oldOpmode},
+    {"strToFanspeed", kOldFanspeed, OLD_TEXT_COUNT(kOldFanspeed), newFanspeed,
+     oldFanspeed},
+    {"strToSwingV", kOldSwingV, OLD_TEXT_COUNT(kOldSwingV), newSwingV,
+     oldSwingV},
+    {"strToSwingH", kOldSwingH, OLD_TEXT_COUNT(kOldSwingH), newSwingH,
+     oldSwingH},
+    {"strToModel", kOldModel, OLD_TEXT_COUNT(kOldModel), newModel, oldModel},
+};
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+// Time a parser over a set of inputs. Returns the avg. nSeconds per call.
+double timeIt(int16_t (*parse)(const char *str),
+              const std::vector<std::string> &inputs, const uint32_t loops,
+              uint64_t *check) {
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++)
+    for (size_t i = 0; i < inputs.size(); i++)
+      *check += parse(inputs[i].c_str());
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - begin).count() /
+      ((double)loops * inputs.size());
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  uint64_t check = 0;  // Use the results, so the calls aren't optimised out.
+  printf("// %" PRIu32 " loops per parser.\n", loops);
+  printf("%-16s %7s %10s %10s %8s\n", "// Parser", "Inputs", "Old ns",
+         "New ns", "Speedup");
+  for (size_t p = 0; p < sizeof(kParsers) / sizeof(kParsers[0]); p++) {
+    const Parser &parser = kParsers[p];
+    std::vector<std::string> inputs;
+    for (size_t i = 0; i < parser.size; i++) {
+      std::string text = parser.table[i].text;
+      inputs.push_back(text);
+      for (size_t c = 0; c < text.length(); c++) text[c] = tolower(text[c]);
+      inputs.push_back(text);
+      for (size_t c = 0; c < text.length(); c++) text[c] = toupper(text[c]);
+      inputs.push_back(text);
+    }
+    inputs.push_back("FOOBAR");
+    inputs.push_back("");
+    inputs.push_back("3");
+    for (size_t i = 0; i < inputs.size(); i++) {
+      if (parser.parse(inputs[i].c_str()) != parser.old(inputs[i].c_str())) {
+        printf("// %s(\"%s\"): MISMATCH!\n", parser.name, inputs[i].c_str());
+        return 1;
+      }
+    }
+    const double old_ns = timeIt(parser.old, inputs, loops, &check);
+    const double new_ns = timeIt(parser.parse, inputs, loops, &check);
+    printf("%-16s %7zu %10.1f %10.1f %7.2fx\n", parser.name, inputs.size(),
+           old_ns, new_ns, new_ns ? old_ns / new_ns : 0.0);
+  }
+  printf("// check: %" PRIu64 "\n", check);
+  return 0;
+}
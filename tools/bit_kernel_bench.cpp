@@ -0,0 +1,149 @@
+// Quick and dirty tool to compare the word-at-a-time reverseBits(),
+// countBits(), sumBytes(), & xorBytes() with the old bit/byte at a time loops.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Usage example:
+//   ./bit_kernel_bench
+//   ./bit_kernel_bench --loops 1000000
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include "IRutils.h"
+
+const uint32_t kDefaultLoops = 200000;
+// The largest A/C state there is, whatever protocols this build decodes.
+const uint16_t kMaxBytes = kHitachiAc2StateLength;
+
+// The old, one bit/byte at a time, versions.
+uint64_t oldReverseBits(uint64_t input, uint16_t nbits) {
+  if (nbits <= 1) return input;
+  if (nbits > 64) nbits = 64;
+  uint64_t output = 0;
+  for (uint16_t i = 0; i < nbits; i++) {
+    output <<= 1;
+    output |= (input & 1);
+    input >>= 1;
+  }
+  return (nbits < 64) ? (input << nbits) | output : output;
+}
+
+uint16_t oldCountBits(const uint8_t * const start, const uint16_t length) {
+  uint16_t count = 0;
+  for (uint16_t offset = 0; offset < length; offset++)
+    for (uint8_t currentbyte = *(start + offset); currentbyte;
+         currentbyte >>= 1)
+      if (currentbyte & 1) count++;
+  return count;
+}
+
+uint8_t oldSumBytes(const uint8_t * const start, const uint16_t length) {
+  uint8_t checksum = 0;
+  for (const uint8_t *ptr = start; ptr - start < length; ptr++)
+    checksum += *ptr;
+  return checksum;
+}
+
+uint8_t oldXorBytes(const uint8_t * const start, const uint16_t length) {
+  uint8_t checksum = 0;
+  for (const uint8_t *ptr = start; ptr - start < length; ptr++)
+    checksum ^= *ptr;
+  return checksum;
+}
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+double nsPerLoop(const std::chrono::steady_clock::time_point begin,
+                 const uint32_t loops) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - begin).count() / loops;
+}
+
+void report(const char *name, const double old_ns, const double new_ns) {
+  printf("%-22s %10.1f %10.1f %7.1fx\n", name, old_ns, new_ns,
+         old_ns / new_ns);
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  // Some typical A/C state sized data. Volatile, so it is read every time.
+  uint8_t state[kMaxBytes];
+  for (uint16_t i = 0; i < kMaxBytes; i++) state[i] = i * 37 + 11;
+  const uint8_t * volatile data = state;
+  volatile uint64_t value = 0x4BB640BF;
+  volatile uint16_t length = kMaxBytes;
+  uint32_t checksum = 0;  // Stops the compiler optimising the loops away.
+
+  printf("// %" PRIu32 " loops each. (%u byte arrays, %s)\n", loops,
+         kMaxBytes, IRUTILS_WORD_KERNELS ? "word kernels" : "scalar");
+  printf("%-22s %10s %10s %8s\n", "// Function", "Old ns", "New ns",
+         "Faster");
+  const uint16_t kNbits[] = {8, 32, 64};
+  for (const uint16_t nbits : kNbits) {
+    if (oldReverseBits(value, nbits) != reverseBits(value, nbits)) return 1;
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < loops; i++)
+      checksum += oldReverseBits(value + i, nbits);
+    const double old_ns = nsPerLoop(begin, loops);
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < loops; i++)
+      checksum += reverseBits(value + i, nbits);
+    char name[32];
+    snprintf(name, sizeof(name), "reverseBits(x, %u)", nbits);
+    report(name, old_ns, nsPerLoop(begin, loops));
+  }
+
+  if (oldCountBits(data, length) != countBits(data, length) ||
+      oldSumBytes(data, length) != sumBytes(data, length) ||
+      oldXorBytes(data, length) != xorBytes(data, length))
+    return 1;
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) checksum += oldCountBits(data, length);
+  double old_ns = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) checksum += countBits(data, length);
+  report("countBits(array)", old_ns, nsPerLoop(begin, loops));
+
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) checksum += oldSumBytes(data, length);
+  old_ns = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) checksum += sumBytes(data, length);
+  report("sumBytes(array)", old_ns, nsPerLoop(begin, loops));
+
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) checksum += oldXorBytes(data, length);
+  old_ns = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) checksum += xorBytes(data, length);
+  report("xorBytes(array)", old_ns, nsPerLoop(begin, loops));
+  printf("// Checksum: %" PRIu32 "\n", checksum);
+  return 0;
+}
@@ -11,12 +11,15 @@
 #include "IRsend_test.h"
 #include "IRutils.h"
 
+// The largest A/C state (in bytes) we can be asked to send. This is not
+// kStateSizeMax, which only covers the protocols we can decode.
+const uint16_t kSendStateSizeMax = kHitachiAc2StateLength;
 
 void usage_error(char *name) {
   std::cerr << "Usage: " << name
             << " --protocol PROTOCOL_NAME"
             << " --code <hexidecimal>"
-            << " [--bits 1-" << kStateSizeMax * 8 << "]"
+            << " [--bits 1-" << kSendStateSizeMax * 8 << "]"
             << " [--timinginfo]"
             << std::endl;
 }
@@ -25,7 +28,7 @@ int main(int argc, char *argv[]) {
   int argv_offset = 1;
   int repeats = 0;
   uint64_t code = 0;
-  uint8_t state[kStateSizeMax] = {0};  // All array elements are set to 0.
+  uint8_t state[kSendStateSizeMax] = {0};  // All array elements are set to 0.
   decode_type_t input_type = decode_type_t::UNKNOWN;
   bool timinginfo = false;
 
@@ -56,6 +59,11 @@ int main(int argc, char *argv[]) {
 
   uint16_t nbits = IRsend::defaultBits(input_type);
   uint16_t stateSize = nbits / 8;
+  if (stateSize > kSendStateSizeMax) {
+    std::cerr << "The protocol's state is larger than this program can send."
+              << std::endl;
+    return 1;
+  }
   if (strncmp("--code", argv[argv_offset], 7) == 0) {
     argv_offset++;
     String hexstr = String(argv[argv_offset]);
@@ -64,10 +72,17 @@ int main(int argc, char *argv[]) {
 
     // Calculate how many hexadecimal characters there are.
     uint64_t hexstrlength = hexstr.length() - strOffset;
+    // Nr. of bytes the code can fill. Simple protocols use at most a uint64_t.
+    uint16_t codeSize = hasACState(input_type) ? stateSize : sizeof(code);
+    if (hexstrlength > codeSize * 2) {
+      std::cerr << "Code " << argv[argv_offset]
+                << " is too large for the protocol." << std::endl;
+      return 3;
+    }
 
     // Ptr to the least significant byte of the resulting state for this
     // protocol.
-    uint8_t *statePtr = &state[stateSize - 1];
+    uint8_t *statePtr = &state[codeSize - 1];
 
     // Convert the string into a state array of the correct length.
     for (uint16_t i = 0; i < hexstrlength; i++) {
@@ -98,7 +113,7 @@ int main(int argc, char *argv[]) {
   if (argc - argv_offset > 0 && strncmp("--bits", argv[argv_offset], 7) == 0) {
     argv_offset++;
     nbits = std::stoul(argv[argv_offset], nullptr, 10);
-    if (nbits == 0 && (nbits <= kStateSizeMax * 8)) {
+    if (nbits == 0 || nbits > kSendStateSizeMax * 8) {
       std::cerr << "Nr. of bits " << argv[argv_offset]
                 << " is invalid." << std::endl;
       return 1;
@@ -0,0 +1,110 @@
+#!/usr/bin/python3
+"""Report the size of decode_results for various build configurations.
+
+   Each configuration is compiled (not linked or run) with the given compiler,
+   so cross compilers work too. e.g. --compiler xtensa-lx106-elf-g++
+   The sizes are read back out of the object file with `nm`.
+
+   The "Old" column is what the layout used to be: the members in declaration
+   order, with the state sized for Hitachi AC2 whenever any A/C was enabled.
+
+   e.g. ./decode_results_footprint.py
+        ./decode_results_footprint.py --cflags=-m32
+        ./decode_results_footprint.py --config "Rhoss only" \
+            -D_IR_ENABLE_DEFAULT_=false -DDECODE_RHOSS=true
+"""
+#
+# Copyright 2026 IRremoteESP8266 project and others
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+SRC_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+                       "src")
+ONLY = "-D_IR_ENABLE_DEFAULT_=false"
+CONFIGS = [
+    ("Everything (default)", []),
+    ("NEC & LG", [ONLY, "-DDECODE_NEC=true", "-DDECODE_LG=true"]),
+    ("NEC, LG & Rhoss", [ONLY, "-DDECODE_NEC=true", "-DDECODE_LG=true",
+                         "-DDECODE_RHOSS=true"]),
+    ("NEC, LG, Rhoss & BluestarHeavy",
+     [ONLY, "-DDECODE_NEC=true", "-DDECODE_LG=true", "-DDECODE_RHOSS=true",
+      "-DDECODE_BLUESTARHEAVY=true"]),
+]
+# Each array's size is the value we want to know.
+PROBE = """\
+#include "IRrecv.h"
+
+class old_decode_results {
+ public:
+  decode_type_t decode_type;
+  union {
+    struct {
+      uint64_t value;
+      uint32_t address;
+      uint32_t command;
+    };
+    uint8_t state[DECODE_AC ? kHitachiAc2StateLength : sizeof(uint64_t)];
+  };
+  uint16_t bits;
+  atomic_uint16_t *rawbuf;
+  uint16_t rawlen;
+  bool overflow;
+  bool repeat;
+};
+
+char probe_state[kStateSizeMax];
+char probe_new[sizeof(decode_results)];
+char probe_old[sizeof(old_decode_results)];
+"""
+
+
+def measure(flags, args):
+  """Compile the probe with some flags & return the sizes it found."""
+  with tempfile.TemporaryDirectory() as tmp:
+    source = os.path.join(tmp, "probe.cpp")
+    obj = os.path.join(tmp, "probe.o")
+    with open(source, "w", encoding="utf-8") as out:
+      out.write(PROBE)
+    subprocess.run([args.compiler, "-c", "-std=gnu++11", "-DUNIT_TEST",
+                    f"-I{SRC_DIR}", *args.cflags.split(), *flags, source,
+                    "-o", obj], check=True)
+    symbols = subprocess.run([args.nm, "-S", obj], check=True,
+                             capture_output=True, text=True).stdout
+  sizes = {}
+  for line in symbols.splitlines():
+    fields = line.split()
+    if len(fields) == 4 and fields[3].startswith("probe_"):
+      sizes[fields[3][len("probe_"):]] = int(fields[1], 16)
+  return sizes
+
+
+def main():
+  """Parse the arguments & report the sizes."""
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument("--compiler", default=os.environ.get("CXX", "g++"),
+                      help="The C++ compiler to use.")
+  parser.add_argument("--nm", default="nm", help="The nm to read sizes with.")
+  parser.add_argument("--cflags", default="",
+                      help="Extra compiler flags for every configuration.")
+  parser.add_argument("--config", nargs=argparse.REMAINDER, default=[],
+                      help="Report only this one: a name, then its flags.")
+  args = parser.parse_args()
+  configs = [(args.config[0], args.config[1:])] if args.config else CONFIGS
+
+  print(f"// sizeof(decode_results) with {args.compiler} {args.cflags}")
+  print(f"{'// Configuration':<32} {'State':>6} {'Old':>6} {'New':>6} "
+        f"{'Saved':>6}")
+  for name, flags in configs:
+    try:
+      sizes = measure(flags, args)
+    except subprocess.CalledProcessError:
+      sys.exit(f"Unable to compile the '{name}' configuration.")
+    print(f"{name:<32} {sizes['state']:>6} {sizes['old']:>6} "
+          f"{sizes['new']:>6} {sizes['old'] - sizes['new']:>6}")
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,180 @@
+// Quick and dirty tool to compare the digit pair integer formatting with the
+// old one digit at a time way, for a full-size capture dump.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Usage example:
+//   ./dump_bench
+//   ./dump_bench --loops 10000
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include "IRrecv.h"
+#include "IRtext.h"
+#include "IRutils.h"
+
+const uint32_t kDefaultLoops = 2000;
+const uint16_t kCaptureSize = 1024;  // Same as IRrecvDumpV2's capture buffer.
+
+// How uint64ToString() used to do it.
+String oldUint64ToString(uint64_t input, uint8_t base) {
+  String result = "";
+  result.reserve(16);
+  do {
+    char c = input % base;
+    input /= base;
+    c += (c < 10) ? '0' : 'A' - 10;
+    result = c + result;
+  } while (input);
+  return result;
+}
+
+// How IRtextSink::addUint() used to do it.
+void oldAddUint(IRtextSink *out, uint64_t value, uint8_t base = 10,
+                const uint8_t width = 0, const char pad = ' ') {
+  char digits[65];
+  char *ptr = digits + sizeof(digits) - 1;
+  *ptr = '\0';
+  do {
+    const char c = value % base;
+    value /= base;
+    *--ptr = (c < 10) ? c + '0' : c + 'A' - 10;
+  } while (value);
+  for (uint8_t len = digits + sizeof(digits) - 1 - ptr; len < width; len++)
+    out->add(pad);
+  out->add(ptr);
+}
+
+// resultToTimingInfo() & the state part of resultToSourceCode(), done with
+// the old formatting.
+void oldDump(IRtextSink *out, const decode_results * const results) {
+  out->add("Raw Timing[");
+  oldAddUint(out, results->rawlen - 1);
+  out->add("]:\n");
+  for (uint16_t i = 1; i < results->rawlen; i++) {
+    out->add((i % 2 == 0) ? kDashStr : "   +");
+    oldAddUint(out, results->rawbuf[i] * kRawTick, 10, 6);
+    if (i < results->rawlen - 1) out->add(kCommaSpaceStr);
+    if (!(i % 8)) out->add('\n');
+  }
+  out->add('\n');
+  for (uint16_t i = 0; i < results->bits / 8; i++) {
+    out->add("0x");
+    oldAddUint(out, results->state[i], 16, 2, '0');
+  }
+}
+
+// The same, with the current formatting.
+void newDump(IRtextSink *out, const decode_results * const results) {
+  resultToTimingInfo(out, results);
+  for (uint16_t i = 0; i < results->bits / 8; i++) {
+    out->add("0x");
+    out->addUint(results->state[i], 16, 2, '0');
+  }
+}
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+double nsPerLoop(const std::chrono::steady_clock::time_point begin,
+                 const uint32_t loops) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - begin).count() / loops;
+}
+
+void report(const char *name, const double old_ns, const double new_ns) {
+  printf("%-24s %12.0f %12.0f %7.1fx\n", name, old_ns, new_ns,
+         old_ns / new_ns);
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  // A full capture buffer of typical marks & spaces, and a full A/C state.
+  static uint16_t rawbuf[kCaptureSize];
+  decode_results results;
+  results.rawbuf = rawbuf;
+  results.rawlen = kCaptureSize;
+  results.bits = kStateSizeMax * 8;
+  uint32_t seed = 1;
+  for (uint16_t i = 0; i < kCaptureSize; i++) {
+    seed = seed * 1103515245UL + 12345;
+    rawbuf[i] = ((i % 2) ? 560 : (seed >> 16) % 2 ? 1690 : 560) / kRawTick;
+    if (i < kStateSizeMax) results.state[i] = seed >> 24;
+  }
+  rawbuf[1] = 9000 / kRawTick;
+
+  static char old_text[kCaptureSize * 12];
+  static char new_text[kCaptureSize * 12];
+  IRtextSink old_out(old_text, sizeof(old_text));
+  IRtextSink new_out(new_text, sizeof(new_text));
+  oldDump(&old_out, &results);
+  newDump(&new_out, &results);
+  if (old_out.overflowed() || strcmp(old_text, new_text)) {
+    printf("// MISMATCH!\n");
+    return 1;
+  }
+  const size_t length = new_out.length();
+
+  size_t checksum = 0;  // Stops the compiler optimising the loops away.
+  printf("// %" PRIu32 " loops of a %u entry capture. (%zu chars)\n", loops,
+         kCaptureSize, length);
+  printf("%-24s %12s %12s %8s\n", "// Op", "Old ns", "New ns", "Faster");
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++) {
+    IRtextSink out(old_text, sizeof(old_text));
+    oldDump(&out, &results);
+    checksum += out.length();
+  }
+  const double old_dump = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++) {
+    IRtextSink out(new_text, sizeof(new_text));
+    newDump(&out, &results);
+    checksum += out.length();
+  }
+  report("Capture dump", old_dump, nsPerLoop(begin, loops));
+
+  const uint8_t kBases[] = {10, 16};
+  for (const uint8_t base : kBases) {
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t loop = 0; loop < loops; loop++)
+      for (uint16_t i = 0; i < kCaptureSize; i++)
+        checksum += oldUint64ToString(rawbuf[i] * 0x10001ULL * i, base).size();
+    const double old_ns = nsPerLoop(begin, loops * kCaptureSize);
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t loop = 0; loop < loops; loop++)
+      for (uint16_t i = 0; i < kCaptureSize; i++)
+        checksum += uint64ToString(rawbuf[i] * 0x10001ULL * i, base).size();
+    char name[32];
+    snprintf(name, sizeof(name), "uint64ToString(x, %u)", base);
+    report(name, old_ns, nsPerLoop(begin, loops * kCaptureSize));
+  }
+  printf("// Checksum: %zu\n", checksum);
+  return 0;
+}
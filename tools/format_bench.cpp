@@ -0,0 +1,187 @@
+// Quick and dirty tool to compare the heap usage & speed of the String and
+// IRtextSink versions of the decode_results text formatters.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Every heap allocation made while formatting is counted by replacing the
+// global operator new. The String versions are expected to allocate, the sink
+// versions writing into a char buffer should not allocate at all.
+//
+// Usage example:
+//   ./format_bench
+//   ./format_bench --loops 100000
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <new>
+#include <string>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+static uint64_t allocations = 0;
+
+void *operator new(size_t size) {
+  allocations++;
+  void *ptr = malloc(size ? size : 1);
+  if (ptr == NULL) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+
+const uint32_t kDefaultLoops = 20000;
+const uint16_t kLongRawLength = 299;  // An odd nr. so it ends with a mark.
+
+typedef String (*StringFormatter)(const decode_results * const);
+typedef void (*SinkFormatter)(IRtextSink *, const decode_results * const);
+
+struct Formatter {
+  const char *name;
+  StringFormatter str;
+  SinkFormatter sink;
+};
+
+// Wrappers so the A/C description has the same shape as the others.
+String acToString(const decode_results * const results) {
+  return IRAcUtils::resultAcToString(results);
+}
+
+void acToSink(IRtextSink *out, const decode_results * const results) {
+  IRAcUtils::resultAcToString(out, results);
+}
+
+const Formatter kFormatters[] = {
+    {"resultToSourceCode", resultToSourceCode, resultToSourceCode},
+    {"resultToTimingInfo", resultToTimingInfo, resultToTimingInfo},
+    {"resultToHumanReadableBasic", resultToHumanReadableBasic,
+     resultToHumanReadableBasic},
+    {"resultToHexidecimal", resultToHexidecimal, resultToHexidecimal},
+    {"resultAcToString", acToString, acToSink},
+};
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+// Time a formatter, and count how many allocations it makes per call.
+void measure(const char *sample, const Formatter &f,
+             const decode_results * const results, const uint32_t loops) {
+  static char buffer[16384];
+  // Check both versions produce the same text.
+  IRtextSink check(buffer, sizeof(buffer));
+  f.sink(&check, results);
+  if (check.overflowed() || f.str(results) != buffer) {
+    printf("// %s %s: OUTPUT MISMATCH!\n", sample, f.name);
+    exit(1);
+  }
+
+  uint64_t before = allocations;
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) {
+    String text = f.str(results);
+    if (text.empty() && check.length()) exit(1);  // Keep the call.
+  }
+  auto end = std::chrono::steady_clock::now();
+  const double str_allocs = (double)(allocations - before) / loops;
+  const double str_ns = std::chrono::duration<double, std::nano>(
+      end - begin).count() / loops;
+
+  before = allocations;
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) {
+    IRtextSink out(buffer, sizeof(buffer));
+    f.sink(&out, results);
+  }
+  end = std::chrono::steady_clock::now();
+  const double sink_allocs = (double)(allocations - before) / loops;
+  const double sink_ns = std::chrono::duration<double, std::nano>(
+      end - begin).count() / loops;
+
+  printf("%-8s %-27s %6zu %10.2f %10.0f %10.2f %10.0f %7.2fx\n", sample,
+         f.name, check.length(), str_allocs, str_ns, sink_allocs, sink_ns,
+         sink_ns ? str_ns / sink_ns : 0.0);
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+
+  // A simple protocol.
+  irsend.reset();
+  irsend.sendNEC(0x4BB640BF);
+  irsend.makeDecodeResult();
+  irrecv.decode(&irsend.capture);
+  decode_results simple = irsend.capture;
+  static uint16_t simple_raw[kRawBuf];
+  memcpy(simple_raw, (const void *)irsend.capture.rawbuf,
+         simple.rawlen * sizeof(simple_raw[0]));
+  simple.rawbuf = reinterpret_cast<atomic_uint16_t *>(simple_raw);
+
+  // An A/C protocol with a state[].
+  const uint8_t state[kRhossStateLength] = {
+      0xAA, 0x05, 0x60, 0x00, 0x50, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x33};
+  irsend.reset();
+  irsend.sendRhoss(state);
+  irsend.makeDecodeResult();
+  irrecv.decode(&irsend.capture);
+  decode_results ac = irsend.capture;
+  static uint16_t ac_raw[kRawBuf];
+  memcpy(ac_raw, (const void *)irsend.capture.rawbuf,
+         ac.rawlen * sizeof(ac_raw[0]));
+  ac.rawbuf = reinterpret_cast<atomic_uint16_t *>(ac_raw);
+
+  // A long message we don't understand.
+  static uint16_t timings[kLongRawLength];
+  uint32_t seed = 1;
+  for (uint16_t i = 0; i < kLongRawLength; i++) {
+    seed = seed * 1103515245 + 12345;
+    timings[i] = 300 + (seed >> 16) % 3000;
+  }
+  irsend.reset();
+  irsend.sendRaw(timings, kLongRawLength, 38);
+  irsend.makeDecodeResult();
+  irrecv.decode(&irsend.capture);
+  decode_results unknown = irsend.capture;
+
+  printf("// %" PRIu32 " loops per formatter.\n", loops);
+  printf("%-8s %-27s %6s %10s %10s %10s %10s %8s\n", "// Mesg", "Formatter",
+         "Chars", "Str alloc", "Str ns", "Sink alloc", "Sink ns", "Speedup");
+  for (size_t i = 0; i < sizeof(kFormatters) / sizeof(kFormatters[0]); i++)
+    measure("NEC", kFormatters[i], &simple, loops);
+  for (size_t i = 0; i < sizeof(kFormatters) / sizeof(kFormatters[0]); i++)
+    measure("RHOSS", kFormatters[i], &ac, loops);
+  for (size_t i = 0; i < sizeof(kFormatters) / sizeof(kFormatters[0]); i++)
+    measure("UNKNOWN", kFormatters[i], &unknown, loops);
+  return 0;
+}
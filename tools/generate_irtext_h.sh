@@ -19,6 +19,7 @@ cat >${OUTPUT} << EOF
 #ifndef IRTEXT_H_
 #define IRTEXT_H_
 
+#include <stdint.h>
 #include "i18n.h"
 
 // Constant text to be shared across all object files.
@@ -34,13 +35,49 @@ class __FlashStringHelper;
 #define IRTEXT_CONST_PTR(NAME) const char* const NAME
 #endif  // ESP8266
 
+/// Calculate a case-insensitive FNV-1a hash of some text at compile time.
+/// @note Must give the same result as \`irutils::textHash()\` does at run time.
+/// @param[in] str The text.
+/// @param[in] hash The hash so far.
+/// @return The hash value.
+constexpr uint32_t irtextHash(const char *str,
+                              const uint32_t hash = 2166136261UL) {
+  return *str ? irtextHash(str + 1,
+                           (hash ^ (uint8_t)((*str >= 'A' && *str <= 'Z') ?
+                                             *str + ('a' - 'A') : *str)) *
+                           16777619UL)
+              : hash;
+}
+
+#if _IR_LOCALE_POOL_
+// The strings are in a pool of several locales, so they are looked up.
+#include "IRtext_pool.h"
+#ifdef ESP8266
+#define IRTEXT_POOL_PTR const __FlashStringHelper*
+#else  // ESP8266
+#define IRTEXT_POOL_PTR const char*
+#endif  // ESP8266
+IRTEXT_POOL_PTR irtextPoolStr(const uint16_t id);
+bool irtextSetLocale(const uint8_t locale);
+bool irtextSetLocale(const char *name);
+uint8_t irtextGetLocale(void);
+IRTEXT_POOL_PTR irtextLocaleName(const uint8_t locale);
+#endif  // _IR_LOCALE_POOL_
+
 EOF
 
 # Parse and output contents of INPUT file.
-sed 's/ PROGMEM//' ${INPUT} | egrep "^(const )?char" | cut -f1 -d= |
+# Skip function definitions. i.e. A '(' before any '='.
+sed 's/ PROGMEM//' ${INPUT} | egrep "^(const )?(char|uint(8|16|32)_t) " |
+    egrep -v "^[^=]*\(" | cut -f1 -d= |
     sed 's/ $/;/;s/^/extern /' | sort -u >> ${OUTPUT}
+echo "#if _IR_LOCALE_POOL_" >> ${OUTPUT}
+egrep '^\s{,10}IRTEXT_CONST_STRING\(' ${INPUT} | cut -f2 -d\( | cut -f1 -d, |
+    sed 's/.*/#define & irtextPoolStr(&Id)/' | sort -u >> ${OUTPUT}
+echo "#else  // _IR_LOCALE_POOL_" >> ${OUTPUT}
 egrep '^\s{,10}IRTEXT_CONST_STRING\(' ${INPUT} | cut -f2 -d\( | cut -f1 -d, |
     sed 's/^/extern IRTEXT_CONST_PTR\(/;s/$/\);/' | sort -u >> ${OUTPUT}
+echo "#endif  // _IR_LOCALE_POOL_" >> ${OUTPUT}
 egrep '^\s{,10}IRTEXT_CONST_BLOB_DECL\(' ${INPUT} |
     cut -f2 -d\( | cut -f1 -d\) |
     sed 's/^/extern IRTEXT_CONST_PTR\(/;s/$/\);/' | sort -u >> ${OUTPUT}
@@ -0,0 +1,246 @@
+#!/usr/bin/python3
+"""Generate the runtime switchable locale string pool for IRtext.
+
+   Every IRTEXT_CONST_STRING() in src/IRtext.cpp is expanded for each of the
+   requested locales (via the C preprocessor, so the locale files are used
+   exactly as a normal build would), then all the texts are de-duplicated into
+   a single NUL separated blob. A text that is the tail end of another text
+   (e.g. "Timer" & "On Timer") shares its storage too. Each locale then only
+   needs a uint16_t offset per string.
+
+   Writes src/IRtext_pool.h & src/locale/pool.h. Run it from the tools dir.
+   e.g. ./generate_irtext_pool.py en-AU de-DE fr-FR
+"""
+#
+# Copyright 2026 IRremoteESP8266 project and others
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+SRC_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+                       "src")
+MARKER = "IRTEXT_POOL_ENTRY"
+GENERATED = """\
+// WARNING: Do not edit this file! This file is automatically generated by
+//          '../tools/generate_irtext_pool.py'.
+// Locales: {args}"""
+
+
+def get_names(irtext_cpp):
+  """Return the (name, value macro) of each IRtext string, in file order."""
+  with open(irtext_cpp, encoding="utf-8") as source:
+    return re.findall(r"^\s{,10}IRTEXT_CONST_STRING\((\w+),\s*([^)]+)\);",
+                      source.read(), re.MULTILINE)
+
+
+def decode_literals(text):
+  """Decode a run of adjacent C string literals into bytes."""
+  result = bytearray()
+  for literal in re.findall(r'"((?:[^"\\]|\\.)*)"', text):
+    raw = literal.encode("utf-8")
+    i = 0
+    while i < len(raw):
+      char = raw[i:i + 1]
+      i += 1
+      if char != b"\\":
+        result += char
+        continue
+      esc = raw[i:i + 1]
+      i += 1
+      if esc == b"x":
+        digits = re.match(rb"[0-9a-fA-F]+", raw[i:]).group(0)
+        result.append(int(digits, 16) & 0xFF)
+        i += len(digits)
+      elif esc in b"01234567":
+        digits = re.match(rb"[0-7]{1,3}", raw[i - 1:]).group(0)
+        result.append(int(digits, 8) & 0xFF)
+        i += len(digits) - 1
+      else:
+        result += {b"n": b"\n", b"t": b"\t", b"r": b"\r"}.get(esc, esc)
+  return bytes(result)
+
+
+def expand_locale(names, locale, compiler):
+  """Return the text of every IRtext string for a locale."""
+  with tempfile.NamedTemporaryFile("w", suffix=".cpp") as source:
+    source.write('#include "i18n.h"\n')
+    for name, value in names:
+      source.write(f"{MARKER} {name} {value}\n")
+    source.flush()
+    output = subprocess.run(
+        [compiler, "-E", "-P", "-DUNIT_TEST", f"-D_IR_LOCALE_={locale}",
+         f"-I{SRC_DIR}", source.name],
+        check=True, capture_output=True, text=True).stdout
+  texts = {}
+  for line in output.splitlines():
+    if line.startswith(MARKER):
+      _, name, value = line.split(" ", 2)
+      texts[name] = decode_literals(value)
+  return [texts[name] for name, _ in names]
+
+
+def build_pool(texts):
+  """De-duplicate the texts into a blob.
+
+  Returns:
+    The texts stored in the blob, in order, & the offset of every text.
+  """
+  offsets = {}
+  stored = []
+  size = 0
+  # Longest first, so shorter texts can share the end of a longer one.
+  for text in sorted(set(texts), key=lambda t: (-len(t), t)):
+    if text in offsets:
+      continue
+    stored.append(text)
+    for i in range(len(text) + 1):  # Every tail end, including "".
+      offsets.setdefault(text[i:], size + i)
+    size += len(text) + 1
+  return stored, offsets
+
+
+def c_literal(text):
+  """Format some bytes as a C string literal, with a trailing NUL."""
+  result = ""
+  for char in text.decode("utf-8"):
+    if char in '"\\':
+      result += "\\" + char
+    elif ord(char) < 0x20:
+      result += f"\\{ord(char):03o}"
+    else:
+      result += char
+  return f'"{result}\\0"'
+
+
+def write_files(names, locales, pool):
+  """Write the generated header files."""
+  stored, offsets, tables = pool
+  size = sum(len(text) + 1 for text in stored)
+  header = GENERATED.format(args=" ".join(locales))
+  ids = "\n".join(f"  {name}Id," for name, _ in names)
+  finds = "".join(
+      f"irtextHash(name) == irtextHash(\"{locale}\") ? {index} :\n         "
+      for index, locale in enumerate(locales))
+  with open(os.path.join(SRC_DIR, "IRtext_pool.h"), "w",
+            encoding="utf-8") as out:
+    out.write(f"""// Copyright 2026 IRremoteESP8266 project and others
+// The ids of the IRtext strings in the runtime switchable locale string pool.
+//
+{header}
+
+#ifndef IRTEXT_POOL_H_
+#define IRTEXT_POOL_H_
+
+#include <stdint.h>
+
+/// An id for each IRtext string. e.g. `kPowerStrId` for `kPowerStr`.
+enum irtext_id_t {{
+{ids}
+  kIrTextPoolEntries  ///< Nr. of strings in the pool.
+}};
+
+/// Nr. of locales in the pool.
+const uint8_t kIrTextPoolLocales = {len(locales)};
+
+/// Find a locale in the pool at compile time. e.g. For `_IR_LOCALE_`
+/// @param[in] name The name of the locale. e.g. "de-DE"
+/// @return The index of the locale, or `kIrTextPoolLocales` if it isn't there.
+constexpr uint8_t irtextPoolLocale(const char *name) {{
+  return {finds}kIrTextPoolLocales;
+}}
+
+#endif  // IRTEXT_POOL_H_
+""")
+
+  blob_lines = []
+  offset = 0
+  for i, text in enumerate(stored):
+    end = ";" if i == len(stored) - 1 else ""
+    blob_lines.append(f"    {c_literal(text)}{end}  // {offset}")
+    offset += len(text) + 1
+  index_rows = []
+  for locale, table in zip(locales, tables):
+    values = [str(offsets[text]) for text in table]
+    rows = []
+    line = "       "
+    for value in values:
+      if len(line) + len(value) + 2 > 80:
+        rows.append(line.rstrip())
+        line = "       "
+      line += f" {value},"
+    rows.append(line.rstrip())
+    index_rows.append(f"    {{  // {locale}\n" + "\n".join(rows) + "\n    },")
+  names_list = ", ".join(f'"{locale}"' for locale in locales)
+  with open(os.path.join(SRC_DIR, "locale", "pool.h"), "w",
+            encoding="utf-8") as out:
+    out.write(f"""// Copyright 2026 IRremoteESP8266 project and others
+// The runtime switchable locale string pool. Only for inclusion by IRtext.cpp
+//
+{header}
+
+#ifndef LOCALE_POOL_H_
+#define LOCALE_POOL_H_
+
+#include "IRtext_pool.h"
+
+/// Every locale's text for every IRtext string, de-duplicated. ({size} bytes)
+static const char kIrTextPool[] PROGMEM =
+{chr(10).join(blob_lines)}
+
+/// Offset in `kIrTextPool` of each string, per locale.
+static const uint16_t kIrTextPoolIndex[kIrTextPoolLocales][kIrTextPoolEntries]
+    PROGMEM = {{
+{chr(10).join(index_rows)}
+}};
+
+/// The name of each locale in the pool.
+static const char kIrTextPoolLocaleNames[kIrTextPoolLocales][6] PROGMEM = {{
+    {names_list}}};
+
+#endif  // LOCALE_POOL_H_
+""")
+
+
+def report(names, locales, pool, output=sys.stdout):
+  """Compare the flash used by the pool with the one locale per build way."""
+  stored, _, tables = pool
+  size = sum(len(text) + 1 for text in stored)
+  ptr_size = 4
+  output.write(f"// {len(names)} strings, {len(locales)} locale(s).\n")
+  output.write(f"{'// Locale':<10} {'Unique':>8} {'Single':>8}\n")
+  for locale, table in zip(locales, tables):
+    single = sum(len(text) + 1 for text in table) + ptr_size * len(table)
+    output.write(f"{locale:<10} {len(set(table)):>8} {single:>8}\n")
+  index = 2 * len(names) * len(locales)
+  output.write(f"// Pool: {size} byte blob + {index} byte index = "
+               f"{size + index} bytes.\n")
+
+
+def main():
+  """Parse the arguments & generate the pool."""
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument("locales", nargs="+",
+                      help="The locales to include. e.g. en-AU de-DE. "
+                      "_IR_LOCALE_ must be one of them.")
+  parser.add_argument("--compiler", default=os.environ.get("CXX", "g++"),
+                      help="The C++ compiler to preprocess with.")
+  parser.add_argument("--report", action="store_true",
+                      help="Only report the sizes. Don't write any files.")
+  args = parser.parse_args()
+  names = get_names(os.path.join(SRC_DIR, "IRtext.cpp"))
+  tables = [expand_locale(names, locale, args.compiler)
+            for locale in args.locales]
+  stored, offsets = build_pool([text for table in tables for text in table])
+  if sum(len(text) + 1 for text in stored) > 0xFFFF:
+    sys.exit("The pool is too big for uint16_t offsets. Use fewer locales.")
+  pool = (stored, offsets, tables)
+  report(names, args.locales, pool)
+  if not args.report:
+    write_files(names, args.locales, pool)
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,199 @@
+// Quick and dirty tool to compare the allocation-free JSON writer & reader
+// with building/picking apart the same JSON with Strings & IRac's helpers.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Usage example:
+//   ./json_bench
+//   ./json_bench --loops 100000
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <string>
+#include "IRac.h"
+#include "IRjson.h"
+#include "IRutils.h"
+
+const uint32_t kDefaultLoops = 20000;
+
+String quoted(const char *key, const String &value) {
+  return String(",\"") + key + "\":\"" + value + "\"";
+}
+
+String number(const char *key, const String &value) {
+  return String(",\"") + key + "\":" + value;
+}
+
+// The String concatenation way of making the same JSON as stateToJson().
+String oldStateToJson(const stdAc::state_t &state) {
+  return "{\"protocol\":\"" + typeToString(state.protocol) + "\"" +
+      number("model", int64ToString(state.model)) +
+      quoted("command", IRac::commandTypeToString(state.command)) +
+      quoted("power", IRac::boolToString(state.power)) +
+      quoted("mode", IRac::opmodeToString(state.mode)) +
+      quoted("use_celsius", IRac::boolToString(state.celsius)) +
+      number("temp", String(std::to_string(state.degrees))) +
+      number("sensortemp", String(std::to_string(state.sensorTemperature))) +
+      quoted("fanspeed", IRac::fanspeedToString(state.fanspeed)) +
+      quoted("swingv", IRac::swingvToString(state.swingv)) +
+      quoted("swingh", IRac::swinghToString(state.swingh)) +
+      quoted("quiet", IRac::boolToString(state.quiet)) +
+      quoted("ifeel", IRac::boolToString(state.iFeel)) +
+      quoted("turbo", IRac::boolToString(state.turbo)) +
+      quoted("econo", IRac::boolToString(state.econo)) +
+      quoted("light", IRac::boolToString(state.light)) +
+      quoted("filter", IRac::boolToString(state.filter)) +
+      quoted("clean", IRac::boolToString(state.clean)) +
+      quoted("beep", IRac::boolToString(state.beep)) +
+      number("sleep", int64ToString(state.sleep)) +
+      number("clock", int64ToString(state.clock)) + "}";
+}
+
+// Find the value of a key with String searches. e.g. {"key":"value"}
+bool oldValue(const String &json, const char *key, String *value) {
+  const String find = String("\"") + key + "\":";
+  size_t start = json.find(find);
+  if (start == std::string::npos) return false;
+  start += find.length();
+  if (json[start] == '"') {
+    const size_t end = json.find('"', ++start);
+    if (end == std::string::npos) return false;
+    *value = json.substr(start, end - start);
+  } else {
+    *value = json.substr(start, json.find_first_of(",}", start) - start);
+  }
+  return true;
+}
+
+// The String way of reading the same JSON back in, one key at a time.
+stdAc::state_t oldJsonToState(const String &json) {
+  stdAc::state_t state;
+  String value;
+  if (oldValue(json, "protocol", &value))
+    state.protocol = strToDecodeType(value.c_str());
+  if (oldValue(json, "model", &value))
+    state.model = IRac::strToModel(value.c_str(), state.model);
+  if (oldValue(json, "command", &value))
+    state.command = IRac::strToCommandType(value.c_str());
+  if (oldValue(json, "power", &value))
+    state.power = IRac::strToBool(value.c_str());
+  if (oldValue(json, "mode", &value))
+    state.mode = IRac::strToOpmode(value.c_str());
+  if (oldValue(json, "use_celsius", &value))
+    state.celsius = IRac::strToBool(value.c_str());
+  if (oldValue(json, "temp", &value)) state.degrees = atof(value.c_str());
+  if (oldValue(json, "sensortemp", &value))
+    state.sensorTemperature = atof(value.c_str());
+  if (oldValue(json, "fanspeed", &value))
+    state.fanspeed = IRac::strToFanspeed(value.c_str());
+  if (oldValue(json, "swingv", &value))
+    state.swingv = IRac::strToSwingV(value.c_str());
+  if (oldValue(json, "swingh", &value))
+    state.swingh = IRac::strToSwingH(value.c_str());
+  if (oldValue(json, "quiet", &value))
+    state.quiet = IRac::strToBool(value.c_str());
+  if (oldValue(json, "ifeel", &value))
+    state.iFeel = IRac::strToBool(value.c_str());
+  if (oldValue(json, "turbo", &value))
+    state.turbo = IRac::strToBool(value.c_str());
+  if (oldValue(json, "econo", &value))
+    state.econo = IRac::strToBool(value.c_str());
+  if (oldValue(json, "light", &value))
+    state.light = IRac::strToBool(value.c_str());
+  if (oldValue(json, "filter", &value))
+    state.filter = IRac::strToBool(value.c_str());
+  if (oldValue(json, "clean", &value))
+    state.clean = IRac::strToBool(value.c_str());
+  if (oldValue(json, "beep", &value))
+    state.beep = IRac::strToBool(value.c_str());
+  if (oldValue(json, "sleep", &value)) state.sleep = atoi(value.c_str());
+  if (oldValue(json, "clock", &value)) state.clock = atoi(value.c_str());
+  return state;
+}
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+double nsPerLoop(const std::chrono::steady_clock::time_point begin,
+                 const uint32_t loops) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - begin).count() / loops;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  stdAc::state_t state;
+  IRac::initState(&state, decode_type_t::LG, lg_ac_remote_model_t::AKB74955603,
+                  true, stdAc::opmode_t::kCool, 21.5, true,
+                  stdAc::fanspeed_t::kMedium, stdAc::swingv_t::kAuto,
+                  stdAc::swingh_t::kOff, false, true, false, true, false,
+                  false, false, 60, 12 * 60 + 34);
+  char json[512];
+  IRtextSink sink(json, sizeof(json));
+  irjson::stateToJson(&sink, state);
+  const size_t length = sink.length();
+  const String old = oldStateToJson(state);
+  stdAc::state_t result;
+  if (!irjson::jsonToState(json, length, &result) ||
+      IRac::cmpStates(state, result) || result.clock != state.clock ||
+      IRac::cmpStates(state, oldJsonToState(old))) {
+    printf("// ROUND TRIP MISMATCH!\n%s\n", json);
+    return 1;
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    if (oldStateToJson(state).empty()) return 1;
+  const double old_write = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) {
+    IRtextSink out(json, sizeof(json));
+    irjson::stateToJson(&out, state);
+    if (out.overflowed()) return 1;
+  }
+  const double new_write = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    if (oldJsonToState(old).protocol != state.protocol) return 1;
+  const double old_read = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    if (!irjson::jsonToState(json, length, &result)) return 1;
+  const double new_read = nsPerLoop(begin, loops);
+
+  printf("// %" PRIu32 " loops of a %zu char stdAc::state_t JSON object.\n",
+         loops, length);
+  printf("%-8s %14s %14s %10s %8s\n", "// Op", "String ns", "irjson ns",
+         "MB/s", "Faster");
+  printf("%-8s %14.0f %14.0f %10.1f %7.1fx\n", "Write", old_write, new_write,
+         length * 1e3 / new_write, old_write / new_write);
+  printf("%-8s %14.0f %14.0f %10.1f %7.1fx\n", "Read", old_read, new_read,
+         length * 1e3 / new_read, old_read / new_read);
+  return 0;
+}
@@ -0,0 +1,122 @@
+// Quick and dirty tool to compare working out LG A/C codes with the IRLgAc
+// setters, against IRLgAc::encode() straight from a packed state.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Usage example:
+//   ./lg_code_bench
+//   ./lg_code_bench --loops 100000
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include "IRac.h"
+#include "IRutils.h"
+#include "ir_LG.h"
+
+const uint32_t kDefaultLoops = 200;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+double nsPerLoop(const std::chrono::steady_clock::time_point begin,
+                 const uint32_t loops) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - begin).count() / loops;
+}
+
+// The code the setters (as used by IRac::lg()) come up with for a state.
+uint32_t setterCode(IRLgAc *ac, const stdAc::state_t &state) {
+  ac->stateReset();
+  ac->setModel((lg_ac_remote_model_t)state.model);
+  ac->setPower(state.power);
+  ac->setMode(IRLgAc::convertMode(state.mode));
+  ac->setTemp(state.degrees);
+  ac->setFan(IRLgAc::convertFan(state.fanspeed));
+  return ac->getPower() ? ac->getRaw() : kLgAcOffCommand;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  // A sweep of every power, mode, whole degree, & fan speed for two models.
+  const uint16_t kStates = 2 * 2 * 6 * 15 * 7;
+  static stdAc::state_t states[kStates];
+  static stdAc::packed_state_t packed[kStates];
+  uint16_t count = 0;
+  for (uint8_t model = 0; model < 2; model++)
+    for (uint8_t power = 0; power < 2; power++)
+      for (int8_t mode = -1; mode <= (int8_t)stdAc::opmode_t::kFan; mode++)
+        for (uint8_t degrees = kLgAcMinTemp; degrees <= kLgAcMaxTemp;
+             degrees++)
+          for (uint8_t fan = 0;
+               fan <= (uint8_t)stdAc::fanspeed_t::kMediumHigh; fan++) {
+            stdAc::state_t *state = &states[count];
+            IRac::initState(state);
+            state->protocol = decode_type_t::LG2;
+            state->model = model ? lg_ac_remote_model_t::AKB75215403
+                                 : lg_ac_remote_model_t::GE6711AR2853M;
+            state->power = power;
+            state->mode = (stdAc::opmode_t)mode;
+            state->degrees = degrees;
+            state->fanspeed = (stdAc::fanspeed_t)fan;
+            packed[count++] = IRac::packState(*state);
+          }
+
+  IRLgAc ac(kGpioUnused);
+  uint32_t code;
+  decode_type_t protocol;
+  for (uint16_t i = 0; i < count; i++) {
+    if (!IRLgAc::encode(packed[i], stdAc::swingv_t::kOff, &code, &protocol) ||
+        code != setterCode(&ac, states[i])) {
+      printf("// MISMATCH for state %u!\n", i);
+      return 1;
+    }
+  }
+
+  uint32_t checksum = 0;  // Stops the compiler optimising the loops away.
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++)
+    for (uint16_t i = 0; i < count; i++) checksum += setterCode(&ac, states[i]);
+  const double setter_ns = nsPerLoop(begin, loops * count);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++)
+    for (uint16_t i = 0; i < count; i++) {
+      IRLgAc::encode(packed[i], stdAc::swingv_t::kOff, &code, &protocol);
+      checksum -= code;
+    }
+  const double encode_ns = nsPerLoop(begin, loops * count);
+
+  printf("// %" PRIu32 " loops of %u LG A/C states. (Checksum: %" PRIu32 ")\n",
+         loops, count, checksum);
+  printf("%-10s %12s %12s %8s\n", "// Method", "ns/code", "codes/s", "Faster");
+  printf("%-10s %12.1f %12.0f %8s\n", "Setters", setter_ns, 1e9 / setter_ns,
+         "");
+  printf("%-10s %12.1f %12.0f %7.1fx\n", "Encode", encode_ns, 1e9 / encode_ns,
+         setter_ns / encode_ns);
+  return 0;
+}
@@ -0,0 +1,115 @@
+// Quick and dirty tool to compare IRrecv::matchBytes() with matching the same
+// long A/C style frames a byte at a time with IRrecv::matchData().
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Usage example:
+//   ./match_bytes_bench
+//   ./match_bytes_bench --loops 100000
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include "IRrecv.h"
+#include "IRutils.h"
+
+const uint32_t kDefaultLoops = 20000;
+// BluestarHeavy like timings.
+const uint16_t kBitMark = 465;
+const uint16_t kOneSpace = 572;
+const uint16_t kZeroSpace = 1548;
+// The largest A/C state there is, whatever protocols this build decodes.
+const uint16_t kMaxBytes = kHitachiAc2StateLength;
+
+// How matchBytes() used to do it.
+uint16_t oldMatchBytes(IRrecv *irrecv, atomic_uint16_t *data_ptr,
+                       uint8_t *result_ptr, const uint16_t nbytes) {
+  uint16_t offset = 0;
+  for (uint16_t byte_pos = 0; byte_pos < nbytes; byte_pos++) {
+    match_result_t result = irrecv->matchData(data_ptr + offset, 8, kBitMark,
+                                              kOneSpace, kBitMark, kZeroSpace);
+    if (!result.success) return 0;
+    result_ptr[byte_pos] = result.data;
+    offset += result.used;
+  }
+  return offset;
+}
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+double nsPerLoop(const std::chrono::steady_clock::time_point begin,
+                 const uint32_t loops) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - begin).count() / loops;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  IRrecv irrecv(0);
+  const uint16_t kSizes[] = {12, 13, 37, kMaxBytes};
+  static uint16_t rawbuf[kMaxBytes * 16 + 1];
+  uint8_t expected[kMaxBytes];
+  uint8_t result[kMaxBytes];
+  uint32_t seed = 1;
+  printf("// %" PRIu32 " loops per frame size, with +/-10%% timing noise.\n",
+         loops);
+  printf("%-8s %6s %14s %14s %10s %8s\n", "// Bytes", "Bits", "matchData ns",
+         "matchBytes ns", "ns/bit", "Faster");
+  for (const uint16_t nbytes : kSizes) {
+    for (uint16_t i = 0; i < nbytes * 8; i++) {
+      seed = seed * 1103515245UL + 12345;
+      const uint16_t space = ((seed >> 16) & 1) ? kOneSpace : kZeroSpace;
+      rawbuf[i * 2] = kBitMark * (90 + (seed >> 17) % 21) / 100 / kRawTick;
+      rawbuf[i * 2 + 1] = space * (90 + (seed >> 22) % 21) / 100 / kRawTick;
+    }
+    rawbuf[nbytes * 16] = kBitMark / kRawTick;
+    const uint16_t remaining = nbytes * 16 + 1;
+    const uint16_t used = oldMatchBytes(&irrecv, rawbuf, expected, nbytes);
+    if (!used || used != irrecv.matchBytes(rawbuf, result, remaining, nbytes,
+                                           kBitMark, kOneSpace, kBitMark,
+                                           kZeroSpace) ||
+        memcmp(expected, result, nbytes)) {
+      printf("// %u bytes: MISMATCH!\n", nbytes);
+      return 1;
+    }
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < loops; i++)
+      if (!oldMatchBytes(&irrecv, rawbuf, result, nbytes)) return 1;
+    const double old_ns = nsPerLoop(begin, loops);
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < loops; i++)
+      if (!irrecv.matchBytes(rawbuf, result, remaining, nbytes, kBitMark,
+                             kOneSpace, kBitMark, kZeroSpace))
+        return 1;
+    const double new_ns = nsPerLoop(begin, loops);
+    printf("%-8u %6u %14.0f %14.0f %10.1f %7.1fx\n", nbytes, nbytes * 8,
+           old_ns, new_ns, new_ns / (nbytes * 8), old_ns / new_ns);
+  }
+  return 0;
+}
@@ -4,6 +4,7 @@
 
 // Usage example:
 // mode2 -H udp -d 5000 | ./mode2_decode
+// mode2 -d /dev/lirc0 | ./mode2_decode -stream -timeout 50
 
 /* Sample input (alternating space and pulse durations in microseconds):
 space 500000
@@ -17,45 +18,383 @@ pulse 427
 space 500000
 */
 
+// Streaming mode (-stream) is for piping live `mode2` output into. It:
+//  - Reads the input with read() into a fixed buffer, and tokenises it in
+//    place. Nothing is allocated per line or per frame.
+//  - Stores each duration in IRrecv's real capture buffer, the same way its
+//    interrupt handler does, instead of going via IRsendTest.
+//  - Decodes a frame as soon as there is a space (or a LIRC `timeout`) longer
+//    than the idle timeout, or no input at all arrives for that long. So each
+//    frame is reported at most the idle timeout (plus decode time) after its
+//    last edge, even though mode2 only prints a space when the next one ends.
+//  - Writes one compact line per frame. e.g. "NEC 32 0x4BB640BF", or with
+//    -binary, the IRwire binary format. (See IRwire.h)
+//  - Reports its throughput & latency on stderr when the input ends, or it is
+//    interrupted.
+
 #include <errno.h>
 #include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
+#include <chrono>  // NOLINT(build/c++11)
 #include <iostream>
 #include <sstream>
 #include <string>
+#include "IRrecv.h"
 #include "IRsend.h"
 #include "IRsend_test.h"
 #include "IRutils.h"
+#include "IRwire.h"
+
+// The streaming mode stores plain uint16_t entries in the capture buffer.
+static_assert(!ENABLE_COMPACT_CAPTURE,
+              "mode2_decode doesn't support ENABLE_COMPACT_CAPTURE.");
 
 const uint16_t kMaxGcCodeLength = 10000;
+const uint8_t kIdleTimeoutMs = 20;  // Gap that ends a message. (Default)
+const uint16_t kCaptureBufferSize = 1024;  // Same as IRrecvDumpV2.
+const uint16_t kInputBufferSize = 4096;  // Bytes.
+// Longest text line we output. Name, bits, state, & the raw timings.
+const uint32_t kOutputBufferSize = 64 + 2 * kStateSizeMax +
+                                   3 * 6 * kCaptureBufferSize;
+const uint32_t kOutputWireSize = kIrWireResultsSizeMax +
+                                 kIrWireRawSizeMax * kCaptureBufferSize;
+
+typedef std::chrono::steady_clock Clock;
+
+volatile sig_atomic_t stopping = false;  // Set by SIGINT & SIGTERM.
 
-void str_to_uint16(char *str, uint16_t *res, uint8_t base) {
+bool str_to_uint16(char *str, uint16_t *res, uint8_t base) {
   char *end;
   errno = 0;
   intmax_t val = strtoimax(str, &end, base);
   if (errno == ERANGE || val < 0 || val > UINT16_MAX || end == str ||
       *end != '\0')
-    return;
+    return false;
   *res = (uint16_t)val;
+  return true;
 }
 
 void usage_error(char *name) {
-  std::cerr << "Usage: " << name << " [-raw]" << std::endl;
+  std::cerr << "Usage: " << name << " [-raw] [-stream [-binary] [-timeout ms]]"
+            << std::endl;
+}
+
+void stop_handler(int signal __attribute__((unused))) { stopping = true; }
+
+// Splits LIRC mode2 input into pulse, space, & timeout events, in place,
+// without allocating any memory. Other lines are skipped.
+class Mode2Tokenizer {
+ public:
+  enum event_t { kNone, kPulse, kSpace, kTimeout };
+
+  Mode2Tokenizer(void) : lines(0), bytes(0), _start(0), _end(0),
+                         _skipping(false) {}
+
+  // Read whatever input is available from a file descriptor.
+  // Returns false at the end of the input, or on an error.
+  bool fill(const int fd) {
+    if (_start) {  // Move any partial line to the front.
+      memmove(_buffer, _buffer + _start, _end - _start);
+      _end -= _start;
+      _start = 0;
+    }
+    if (_end == sizeof(_buffer)) {  // A line too long to be one of ours.
+      _end = 0;
+      _skipping = true;
+    }
+    const ssize_t got = read(fd, _buffer + _end, sizeof(_buffer) - _end);
+    if (got < 0) return errno == EINTR;
+    if (got == 0) {  // Treat a last line without a newline as a line.
+      if (_end > _start && _end < sizeof(_buffer)) _buffer[_end++] = '\n';
+      return false;
+    }
+    _end += got;
+    bytes += got;
+    return true;
+  }
+
+  // Get the next event from the buffered input.
+  // Returns kNone when more input is needed.
+  event_t next(uint32_t *usecs) {
+    while (_start < _end) {
+      char *line = _buffer + _start;
+      char *eol = static_cast<char *>(memchr(line, '\n', _end - _start));
+      if (eol == NULL) return kNone;
+      _start = eol - _buffer + 1;
+      lines++;
+      if (_skipping) {
+        _skipping = false;
+        continue;
+      }
+      const event_t event = parse(line, eol, usecs);
+      if (event != kNone) return event;
+    }
+    return kNone;
+  }
+
+  uint64_t lines;  // Nr. of lines read.
+  uint64_t bytes;  // Nr. of bytes read.
+
+ private:
+  // Parse "<type> <usecs>". Durations too long for 32 bits are capped.
+  static event_t parse(const char *ptr, const char *eol, uint32_t *usecs) {
+    while (ptr < eol && *ptr == ' ') ptr++;
+    const char *word = ptr;
+    while (ptr < eol && *ptr >= 'a' && *ptr <= 'z') ptr++;
+    const size_t length = ptr - word;
+    event_t event;
+    if (length == 5 && strncmp(word, "pulse", 5) == 0)
+      event = kPulse;
+    else if (length == 5 && strncmp(word, "space", 5) == 0)
+      event = kSpace;
+    else if (length == 7 && strncmp(word, "timeout", 7) == 0)
+      event = kTimeout;
+    else
+      return kNone;
+    while (ptr < eol && *ptr == ' ') ptr++;
+    if (ptr == eol || *ptr < '0' || *ptr > '9') return kNone;
+    uint64_t value = 0;
+    for (; ptr < eol && *ptr >= '0' && *ptr <= '9'; ptr++)
+      if (value <= UINT32_MAX) value = value * 10 + (*ptr - '0');
+    *usecs = (value > UINT32_MAX) ? UINT32_MAX : value;
+    return event;
+  }
+
+  char _buffer[kInputBufferSize];
+  size_t _start;  // Where the next unread line starts.
+  size_t _end;  // Where the buffered input ends.
+  bool _skipping;  // Skip up to the next newline?
+};
+
+// Stores mode2 durations in IRrecv's capture buffer, the same way its
+// interrupt handler stores the time between edges, and decodes them from it.
+class Mode2Capture {
+ public:
+  Mode2Capture(const uint16_t bufsize, const uint8_t timeout)
+      : _irrecv(0, bufsize, timeout, true) {
+    _params = _irrecv._getParamsPtr();
+    _irrecv.enableIRIn();
+  }
+
+  // Add a pulse or space. A space at least as long as the timeout ends the
+  // message, as does filling the buffer.
+  void add(const bool mark, const uint32_t usecs) {
+    if (_params->rcvstate == kStopState) return;  // Waiting to be decoded.
+    if (_params->rcvstate == kIdleState) {
+      if (!mark) return;  // The gap between messages isn't captured.
+      _params->rcvstate = kMarkState;
+      _params->rawbuf[0] = 1;
+      _params->rawlen = 1;
+    }
+    if (!mark && usecs >= MS_TO_USEC(_params->timeout)) {
+      stop();
+      return;
+    }
+    const uint16_t ticks = std::min(usecs / kRawTick, (uint32_t)UINT16_MAX);
+    uint16_t rawlen = _params->rawlen;
+    // Odd entries are marks, even ones are spaces. Join any repeated ones.
+    if ((rawlen % 2 == 1) != mark) {
+      _params->rawbuf[rawlen - 1] = std::min(
+          (uint32_t)_params->rawbuf[rawlen - 1] + ticks, (uint32_t)UINT16_MAX);
+      return;
+    }
+    _params->rawbuf[rawlen++] = ticks;
+    _params->rawlen = rawlen;
+    // Unlike the interrupt handler, which only notices at the next edge, stop
+    // as soon as it is full. So decode() never writes past its end.
+    if (rawlen >= _params->bufsize) {
+      _params->overflow = true;
+      stop();
+    }
+  }
+
+  // End the message. e.g. Nothing has arrived for the timeout period.
+  void stop(void) {
+    if (_params->rcvstate != kIdleState) _params->rcvstate = kStopState;
+  }
+
+  bool capturing(void) const { return _params->rcvstate == kMarkState; }
+  bool ready(void) const { return _params->rcvstate == kStopState; }
+
+  // Decode the message, & start capturing the next one.
+  bool decode(decode_results *results) { return _irrecv.decode(results); }
+
+ private:
+  IRrecv _irrecv;
+  atomic_irparams_t *_params;
+};
+
+// Throughput & latency of the streaming mode.
+struct StreamStats {
+  uint64_t frames = 0;  // Nr. of messages captured.
+  uint64_t decoded = 0;  // Nr. of them that decode() reported.
+  uint64_t overflows = 0;  // Nr. of them that filled the capture buffer.
+  double decode_usecs = 0;  // Total time spent in decode().
+  double latency_sum = 0;  // Total latency. (usecs)
+  double latency_min = 0;  // Shortest latency. (usecs)
+  double latency_max = 0;  // Longest latency. (usecs)
+};
+
+// Write a decoded message as a line of text, or in the IRwire format.
+void stream_output(const decode_results *results, const bool dumpraw,
+                   const bool binary) {
+  if (binary) {
+    static uint8_t wire[kOutputWireSize];
+    const uint16_t size = irwire::encodeResults(results, wire, sizeof(wire),
+                                                dumpraw);
+    fwrite(wire, 1, size, stdout);
+  } else {
+    static char text[kOutputBufferSize];
+    IRtextSink out(text, sizeof(text));
+    typeToString(&out, results->decode_type);
+    out.add(' ');
+    out.addUint(results->bits);
+    out.add(' ');
+    resultToHexidecimal(&out, results);
+    if (results->repeat) out.add(" repeat");
+    if (results->overflow) out.add(" overflow");
+    if (dumpraw || results->decode_type == UNKNOWN) {
+      // Long entries can be split in three. See resultToRawArray().
+      static uint16_t raw[3 * kCaptureBufferSize];
+      const uint16_t length = resultToRawArray(results, raw,
+                                               3 * kCaptureBufferSize);
+      out.add(" raw ");
+      for (uint16_t i = 0; i < length && i < 3 * kCaptureBufferSize; i++) {
+        if (i) out.add(',');
+        out.addUint(raw[i]);
+      }
+    }
+    out.add('\n');
+    fwrite(text, 1, std::min(out.length(), sizeof(text) - 1), stdout);
+  }
+  fflush(stdout);
+}
+
+void stream_report(const Mode2Tokenizer &input, const StreamStats &stats,
+                   const double elapsed_usecs) {
+  const double secs = elapsed_usecs / 1e6;
+  fprintf(stderr, "Input:      %" PRIu64 " lines, %" PRIu64 " bytes\n",
+          input.lines, input.bytes);
+  fprintf(stderr, "Frames:     %" PRIu64 " (%" PRIu64 " decoded, %" PRIu64
+          " overflowed)\n", stats.frames, stats.decoded, stats.overflows);
+  fprintf(stderr, "Elapsed:    %.3f s\n", secs);
+  if (secs > 0)
+    fprintf(stderr, "Throughput: %.0f lines/s, %.0f frames/s, %.2f MB/s\n",
+            input.lines / secs, stats.frames / secs, input.bytes / secs / 1e6);
+  if (stats.frames) {
+    fprintf(stderr, "Decode:     %.2f us per frame\n",
+            stats.decode_usecs / stats.frames);
+    fprintf(stderr, "Latency:    %.2f / %.2f / %.2f ms (min / avg / max, "
+            "last edge read to output)\n", stats.latency_min / 1e3,
+            stats.latency_sum / stats.frames / 1e3, stats.latency_max / 1e3);
+  }
+}
+
+int decode_stream(const bool dumpraw, const bool binary,
+                  const uint8_t timeout) {
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = stop_handler;  // No SA_RESTART, so poll() is woken.
+  sigaction(SIGINT, &action, NULL);
+  sigaction(SIGTERM, &action, NULL);
+
+  static Mode2Tokenizer input;
+  Mode2Capture capture(kCaptureBufferSize, timeout);
+  decode_results results;
+  StreamStats stats;
+  struct pollfd fds = {STDIN_FILENO, POLLIN, 0};
+  Clock::time_point start = Clock::now();
+  Clock::time_point last_read = start;  // When we last got some input.
+  Clock::time_point last_edge = start;  // When the last edge was read.
+  bool more = true;
+
+  while (more && !stopping) {
+    // Only wait as long as the timeout if we are part way through a message.
+    const int ready = poll(&fds, 1, capture.capturing() ? timeout : -1);
+    if (ready < 0 && errno != EINTR) break;
+    if (ready > 0) {
+      more = input.fill(STDIN_FILENO);
+      last_read = Clock::now();
+    } else if (ready == 0) {
+      capture.stop();  // Nothing for the timeout period. i.e. The message end.
+    }
+    uint32_t usecs;
+    Mode2Tokenizer::event_t event;
+    do {
+      event = input.next(&usecs);
+      switch (event) {
+        case Mode2Tokenizer::kPulse:
+        case Mode2Tokenizer::kSpace:
+          capture.add(event == Mode2Tokenizer::kPulse, usecs);
+          if (capture.capturing()) last_edge = last_read;
+          break;
+        case Mode2Tokenizer::kTimeout:
+          capture.stop();
+          break;
+        default:
+          break;
+      }
+      if (!more && event == Mode2Tokenizer::kNone) capture.stop();
+      if (capture.ready()) {
+        const Clock::time_point begin = Clock::now();
+        const bool decoded = capture.decode(&results);
+        const Clock::time_point end = Clock::now();
+        stats.frames++;
+        stats.decode_usecs += std::chrono::duration<double, std::micro>(
+            end - begin).count();
+        if (results.overflow) stats.overflows++;
+        if (decoded) {
+          stats.decoded++;
+          stream_output(&results, dumpraw, binary);
+        }
+        const double latency = std::chrono::duration<double, std::micro>(
+            Clock::now() - last_edge).count();
+        stats.latency_sum += latency;
+        if (stats.frames == 1 || latency < stats.latency_min)
+          stats.latency_min = latency;
+        if (latency > stats.latency_max) stats.latency_max = latency;
+      }
+    } while (event != Mode2Tokenizer::kNone);
+  }
+
+  stream_report(input, stats, std::chrono::duration<double, std::micro>(
+      Clock::now() - start).count());
+  return 0;
 }
 
 int main(int argc, char *argv[]) {
   bool dumpraw = false;
+  bool stream = false;
+  bool binary = false;
+  uint16_t timeout = kIdleTimeoutMs;
 
   // Check the invocation/calling usage.
-  if (argc > 2) {
+  for (int i = 1; i < argc; i++) {
+    if (strncmp("-raw", argv[i], 5) == 0) {
+      dumpraw = true;
+    } else if (strncmp("-stream", argv[i], 8) == 0) {
+      stream = true;
+    } else if (strncmp("-binary", argv[i], 8) == 0) {
+      binary = true;
+    } else if (strncmp("-timeout", argv[i], 9) == 0 && i + 1 < argc &&
+               str_to_uint16(argv[++i], &timeout, 10) && timeout > 0 &&
+               timeout <= std::min(kMaxTimeoutMs, (uint16_t)UINT8_MAX)) {
+      continue;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+  if (!stream && (binary || timeout != kIdleTimeoutMs)) {
     usage_error(argv[0]);
     return 1;
   }
 
-  if (argc == 2 && strncmp("-raw", argv[1], 4) == 0) {
-    dumpraw = true;
-  }
+  if (stream) return decode_stream(dumpraw, binary, timeout);
 
   int index = 0;
   std::string line, type;
@@ -84,7 +423,8 @@ int main(int argc, char *argv[]) {
     }
     index++;
 
-    if (duration > 20000 || index >= kMaxGcCodeLength) {
+    if (duration > (int)MS_TO_USEC(kIdleTimeoutMs) ||
+        index >= kMaxGcCodeLength) {
       // Skip long spaces at beginning
       if (index > 1) {
         irsend.makeDecodeResult();
@@ -0,0 +1,73 @@
+#! /bin/bash
+MODE2_DECODE=./mode2_decode
+if [[ ! -x ${MODE2_DECODE} ]]; then
+  echo "'mode2_decode' failed to compile and produce an executable."
+  exit 1
+fi
+
+# Output mode2 lines for a NEC message.
+function nec_mode2()
+{
+  CODE=$1
+  echo "pulse 9000"
+  echo "space 4500"
+  for ((BIT = 31; BIT >= 0; BIT--)); do
+    echo "pulse 560"
+    if (( (CODE >> BIT) & 1 )); then echo "space 1690"; else echo "space 560"; fi
+  done
+  echo "pulse 560"
+}
+
+function unittest_success()
+{
+  INPUT="$1"
+  shift
+  EXPECTED="$1"
+  shift
+  echo -n "Testing: \"${MODE2_DECODE} $*\" ..."
+  OUTPUT="$(echo "${INPUT}" | ${MODE2_DECODE} "$@" 2> /dev/null)"
+  STATUS=$?
+  FAILURE=""
+  if [[ ${STATUS} -ne 0 ]]; then
+    FAILURE="Non-Zero Exit status: ${STATUS}. "
+  fi
+  if [[ "${OUTPUT}" != "${EXPECTED}" ]]; then
+    FAILURE="${FAILURE} Unexpected Output: \"${OUTPUT}\" != \"${EXPECTED}\""
+  fi
+  if [[ -z ${FAILURE} ]]; then
+    echo " ok!"
+    return 0
+  else
+    echo
+    echo "FAILED: ${FAILURE}"
+    return 1
+  fi
+}
+
+FAILED=0
+
+# Leading gaps, a LIRC timeout, junk lines, & no trailing gap on the last one.
+INPUT="$(echo "space 500000"; nec_mode2 0x4BB640BF; echo "space 40000";
+         nec_mode2 0x00FF00FF; echo "timeout 30000"; echo "not mode2 data";
+         echo "space 100000"; nec_mode2 0x20DF10EF)"
+
+read -r -d '' OUT << EOM
+NEC 32 0x4BB640BF
+NEC 32 0xFF00FF
+NEC 32 0x20DF10EF
+EOM
+
+unittest_success "${INPUT}" "${OUT}" -stream || FAILED=1
+
+# A gap shorter than the timeout doesn't split a message.
+INPUT="$(nec_mode2 0x4BB640BF; echo "space 40000"; nec_mode2 0x00FF00FF)"
+
+unittest_success "${INPUT}" "NEC 32 0x4BB640BF" -stream -timeout 50 || FAILED=1
+
+read -r -d '' OUT << EOM
+NEC 32 0x4BB640BF raw 9000,4500,560,560,560,1690,560,560,560,560,560,1690,560,560,560,1690,560,1690,560,1690,560,560,560,1690,560,1690,560,560,560,1690,560,1690,560,560,560,560,560,1690,560,560,560,560,560,560,560,560,560,560,560,560,560,1690,560,560,560,1690,560,1690,560,1690,560,1690,560,1690,560,1690,560
+EOM
+
+unittest_success "$(nec_mode2 0x4BB640BF)" "${OUT}" -stream -raw || FAILED=1
+
+exit ${FAILED}
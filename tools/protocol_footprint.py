@@ -0,0 +1,152 @@
+#!/usr/bin/python3
+"""Report the flash & RAM footprint of each protocol in the library.
+
+   The library is compiled (not linked) with nothing enabled
+   (-D_IR_ENABLE_DEFAULT_=false), then again with just one protocol's
+   DECODE_, SEND_, or both, enabled. The size of every section of every object
+   file is read back with `size -A`, and each protocol is reported as the
+   difference from the nothing enabled build.
+
+   "irtext" is how much of that is IRtext.o. i.e. The protocol's strings.
+   Being unlinked, unreferenced code is included. Use the same flags each
+   release & compare the results, rather than reading them as exact costs.
+
+   The output is CSV, so it can be tracked per release.
+   e.g. ./protocol_footprint.py > footprint.csv
+        ./protocol_footprint.py NEC RHOSS
+        ./protocol_footprint.py --compiler xtensa-lx106-elf-g++ \\
+            --size xtensa-lx106-elf-size
+"""
+#
+# Copyright 2026 IRremoteESP8266 project and others
+import argparse
+import concurrent.futures
+import csv
+import glob
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+SRC_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+                       "src")
+# UNIT_TEST builds of some headers need IRsend_test.h
+TEST_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..",
+                        "test")
+NOTHING = ["-D_IR_ENABLE_DEFAULT_=false"]
+SECTIONS = ["text", "rodata", "data", "bss"]
+FIELDS = ["protocol", "config", *SECTIONS, "irtext"]
+
+
+def get_protocols():
+  """Return the protocols with code in the library. e.g. ["LG", "NEC"]"""
+  with open(os.path.join(SRC_DIR, "IRremoteESP8266.h"),
+            encoding="utf-8") as header:
+    defined = set(re.findall(r"^#define (?:DECODE|SEND)_(\w+)\b",
+                             header.read(), re.MULTILINE))
+  found = set()
+  for source in glob.glob(os.path.join(SRC_DIR, "ir_*.cpp")):
+    with open(source, encoding="utf-8") as code:
+      found.update(re.findall(r"^#if (?:DECODE|SEND)_(\w+)\s*$", code.read(),
+                              re.MULTILINE))
+  return sorted(found & defined)
+
+
+def classify(section):
+  """Which of SECTIONS a section name counts towards, if any."""
+  # Constant tables of pointers end up in .data.rel.ro on a host build.
+  if section.startswith((".rodata", ".data.rel.ro")):
+    return "rodata"
+  for name in ("bss", "data"):
+    if section.startswith("." + name):
+      return name
+  if "text" in section or section.startswith(".iram"):
+    return "text"
+  return None
+
+
+def compile_sizes(flags, args):
+  """Compile every source file with some flags & return their sizes.
+
+  Returns:
+    The total size of each of SECTIONS, & the total size of IRtext.o.
+  """
+  totals = dict.fromkeys(SECTIONS, 0)
+  irtext = 0
+  with tempfile.TemporaryDirectory() as tmp:
+    for source in sorted(glob.glob(os.path.join(SRC_DIR, "*.cpp"))):
+      obj = os.path.join(tmp, os.path.basename(source) + ".o")
+      subprocess.run([args.compiler, "-c", f"-std={args.std}", "-DUNIT_TEST",
+                      f"-D_IR_LOCALE_={args.locale}", f"-I{SRC_DIR}",
+                      f"-I{TEST_DIR}", *args.cflags.split(), *flags, source,
+                      "-o", obj], check=True, capture_output=True, text=True)
+      output = subprocess.run([args.size, "-A", obj], check=True,
+                              capture_output=True, text=True).stdout
+      for line in output.splitlines():
+        fields = line.split()
+        if len(fields) < 2 or not fields[1].isdigit():
+          continue
+        kind = classify(fields[0])
+        if kind is None:
+          continue
+        totals[kind] += int(fields[1])
+        if os.path.basename(source) == "IRtext.cpp":
+          irtext += int(fields[1])
+  return totals, irtext
+
+
+def configs(protocols):
+  """The (protocol, config, flags) of each build to measure."""
+  yield ("", "none", NOTHING)
+  for protocol in protocols:
+    yield (protocol, "decode", NOTHING + [f"-DDECODE_{protocol}=true"])
+    yield (protocol, "send", NOTHING + [f"-DSEND_{protocol}=true"])
+    yield (protocol, "both", NOTHING + [f"-DDECODE_{protocol}=true",
+                                        f"-DSEND_{protocol}=true"])
+
+
+def main():
+  """Parse the arguments & report the footprints."""
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument("protocols", nargs="*",
+                      help="Only report these protocols. e.g. NEC LG "
+                      "(Default: Every protocol in the library)")
+  parser.add_argument("--compiler", default=os.environ.get("CXX", "g++"),
+                      help="The C++ compiler to use.")
+  parser.add_argument("--size", default="size",
+                      help="The size command to read sections with.")
+  parser.add_argument("--cflags",
+                      default="-Os -ffunction-sections -fdata-sections",
+                      help="Compiler flags for every configuration. "
+                      "(Default: %(default)s)")
+  parser.add_argument("--std", default="gnu++11",
+                      help="The C++ standard to use. (Default: %(default)s)")
+  parser.add_argument("--locale", default="en-AU",
+                      help="The locale to build with. (Default: %(default)s)")
+  parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(),
+                      help="Nr. of configurations to build at once.")
+  args = parser.parse_args()
+  protocols = args.protocols or get_protocols()
+  builds = list(configs(protocols))
+
+  with concurrent.futures.ThreadPoolExecutor(args.jobs) as pool:
+    jobs = [pool.submit(compile_sizes, flags, args) for _, _, flags in builds]
+    try:
+      results = [job.result() for job in jobs]
+    except subprocess.CalledProcessError as error:
+      sys.exit(f"{error.stderr}Unable to compile with: {' '.join(error.cmd)}")
+
+  writer = csv.writer(sys.stdout, lineterminator="\n")
+  writer.writerow(FIELDS)
+  base, base_irtext = results[0]
+  # The baseline is absolute. Everything else is relative to it.
+  writer.writerow(["", "none", *[base[s] for s in SECTIONS], base_irtext])
+  for (protocol, config, _), (sizes, irtext) in zip(builds[1:], results[1:]):
+    writer.writerow([protocol, config,
+                     *[sizes[s] - base[s] for s in SECTIONS],
+                     irtext - base_irtext])
+
+
+if __name__ == "__main__":
+  main()
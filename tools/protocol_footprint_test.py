@@ -0,0 +1,44 @@
+#!/usr/bin/python3
+"""Unit tests for protocol_footprint.py"""
+import unittest
+import protocol_footprint as footprint
+
+class TestProtocolFootprint(unittest.TestCase):
+  """Unit tests for the methods in protocol_footprint."""
+
+  def test_classify(self):
+    """Tests for the classify() function."""
+    self.assertEqual(footprint.classify(".text"), "text")
+    self.assertEqual(footprint.classify(".text._ZN6IRsend7sendNECEytt"), "text")
+    self.assertEqual(footprint.classify(".irom0.text"), "text")
+    self.assertEqual(footprint.classify(".iram.text"), "text")
+    self.assertEqual(footprint.classify(".rodata.kNecStr"), "rodata")
+    self.assertEqual(footprint.classify(".data.rel.ro._ZN11IRprotocols4kNecE"),
+                     "rodata")
+    self.assertEqual(footprint.classify(".data.kIrTextLocale"), "data")
+    self.assertEqual(footprint.classify(".bss._ZL8irparams"), "bss")
+    self.assertIsNone(footprint.classify(".comment"))
+    self.assertIsNone(footprint.classify(".debug_info"))
+
+  def test_get_protocols(self):
+    """Tests for the get_protocols() function."""
+    protocols = footprint.get_protocols()
+    self.assertIn("NEC", protocols)
+    self.assertIn("RHOSS", protocols)
+    self.assertEqual(protocols, sorted(protocols))
+    # Only things with DECODE_/SEND_ flags. Not e.g. DECODE_AC
+    self.assertNotIn("AC", protocols)
+
+  def test_configs(self):
+    """Tests for the configs() function."""
+    builds = list(footprint.configs(["NEC"]))
+    self.assertEqual(len(builds), 4)
+    self.assertEqual(builds[0], ("", "none", footprint.NOTHING))
+    self.assertEqual(
+        builds[3],
+        ("NEC", "both", footprint.NOTHING + ["-DDECODE_NEC=true",
+                                             "-DSEND_NEC=true"]))
+
+
+if __name__ == '__main__':
+  unittest.main(verbosity=2)
@@ -0,0 +1,146 @@
+// Quick and dirty tool to compare the speed of the protocol name lookups with
+// the old way of walking the list of names.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Both directions are checked against the old code for every protocol first.
+//
+// Usage example:
+//   ./protocol_name_bench
+//   ./protocol_name_bench --loops 1000
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <string>
+#include <vector>
+#include "IRrecv.h"
+#include "IRtext.h"
+#include "IRutils.h"
+
+const uint32_t kDefaultLoops = 200;
+
+// The old versions, which walk the names from the start each time.
+String oldTypeToString(const decode_type_t protocol) {
+  if (protocol > kLastDecodeType || protocol == decode_type_t::UNKNOWN)
+    return kUnknownStr;
+  auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
+  for (uint16_t i = 0; i <= protocol && strlen(ptr); i++) {
+    if (i == protocol) return ptr;
+    ptr += strlen(ptr) + 1;
+  }
+  return "";
+}
+
+decode_type_t oldStrToDecodeType(const char * const str) {
+  auto *ptr = reinterpret_cast<const char*>(kAllProtocolNamesStr);
+  uint16_t length = strlen(ptr);
+  for (uint16_t i = 0; length; i++) {
+    if (!strcasecmp(str, ptr)) return (decode_type_t)i;
+    ptr += length + 1;
+    length = strlen(ptr);
+  }
+  decode_type_t result = oldStrToDecodeType(
+      oldTypeToString((decode_type_t)atoi(str)).c_str());
+  if (result > 0)
+    return result;
+  else
+    return decode_type_t::UNKNOWN;
+}
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  // Every name, plus its nr. & a name that isn't one, as look up inputs.
+  std::vector<std::string> inputs;
+  for (uint16_t i = 0; i <= kLastDecodeType; i++) {
+    const std::string name = typeToString((decode_type_t)i);
+    if (name != oldTypeToString((decode_type_t)i)) {
+      printf("// typeToString(%d): MISMATCH!\n", i);
+      return 1;
+    }
+    inputs.push_back(name);
+    inputs.push_back(std::to_string(i));
+  }
+  inputs.push_back("NOT_A_PROTOCOL");
+  for (size_t i = 0; i < inputs.size(); i++) {
+    if (strToDecodeType(inputs[i].c_str()) !=
+        oldStrToDecodeType(inputs[i].c_str())) {
+      printf("// strToDecodeType(\"%s\"): MISMATCH!\n", inputs[i].c_str());
+      return 1;
+    }
+  }
+
+  uint64_t check = 0;  // Use the results, so the calls aren't optimised out.
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++)
+    for (uint16_t i = 0; i <= kLastDecodeType; i++)
+      check += oldTypeToString((decode_type_t)i).length();
+  auto end = std::chrono::steady_clock::now();
+  const uint32_t calls = loops * (kLastDecodeType + 1);
+  const double old_to_str = std::chrono::duration<double, std::nano>(
+      end - begin).count() / calls;
+
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++)
+    for (uint16_t i = 0; i <= kLastDecodeType; i++)
+      check += typeToString((decode_type_t)i).length();
+  end = std::chrono::steady_clock::now();
+  const double new_to_str = std::chrono::duration<double, std::nano>(
+      end - begin).count() / calls;
+
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++)
+    for (size_t i = 0; i < inputs.size(); i++)
+      check += oldStrToDecodeType(inputs[i].c_str());
+  end = std::chrono::steady_clock::now();
+  const double lookups = (double)loops * inputs.size();
+  const double old_from_str = std::chrono::duration<double, std::nano>(
+      end - begin).count() / lookups;
+
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < loops; loop++)
+    for (size_t i = 0; i < inputs.size(); i++)
+      check += strToDecodeType(inputs[i].c_str());
+  end = std::chrono::steady_clock::now();
+  const double new_from_str = std::chrono::duration<double, std::nano>(
+      end - begin).count() / lookups;
+
+  printf("// %" PRIu32 " loops over %d protocols. (check: %" PRIu64 ")\n",
+         loops, kLastDecodeType + 1, check);
+  printf("%-18s %10s %10s %8s\n", "// Function", "Old ns", "New ns",
+         "Speedup");
+  printf("%-18s %10.0f %10.0f %7.2fx\n", "typeToString", old_to_str,
+         new_to_str, new_to_str ? old_to_str / new_to_str : 0.0);
+  printf("%-18s %10.0f %10.0f %7.2fx\n", "strToDecodeType", old_from_str,
+         new_from_str, new_from_str ? old_from_str / new_from_str : 0.0);
+  return 0;
+}
@@ -0,0 +1,130 @@
+// Quick and dirty tool to pack a sendRaw() array into the compact packed raw
+// format used by IRsend::sendPackedRaw(), and check it round-trips.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Usage example:
+// echo "uint16_t rawData[3] = {9000, 4500, 560};" | ./raw_pack --freq 38
+
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <string>
+#include "IRsend.h"
+#include "IRutils.h"
+
+const uint16_t kMaxRawLength = 10000;
+const uint32_t kDecodeLoops = 1000;
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name
+            << " [--freq kHz] [--tolerance 0-100] < file_with_raw_array"
+            << std::endl;
+}
+
+bool str_to_uint16(char *str, uint16_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val < 0 || val > UINT16_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint16_t)val;
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  uint16_t freq = 38;
+  uint16_t tolerance = kPackedRawTolerance;
+
+  for (int i = 1; i < argc; i += 2) {
+    if (i + 1 >= argc) {
+      usage_error(argv[0]);
+      return 1;
+    }
+    if (strncmp("--freq", argv[i], 7) == 0) {
+      if (!str_to_uint16(argv[i + 1], &freq)) {
+        usage_error(argv[0]);
+        return 1;
+      }
+    } else if (strncmp("--tolerance", argv[i], 12) == 0) {
+      if (!str_to_uint16(argv[i + 1], &tolerance) || tolerance > 100) {
+        usage_error(argv[0]);
+        return 1;
+      }
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  // Collect the numbers. If there is a '{', only use what is inside the braces
+  // so we can accept the output of IRrecvDumpV2 etc. as-is.
+  std::string input, line;
+  while (std::getline(std::cin, line)) input += line + '\n';
+  size_t start = input.find('{');
+  size_t end = input.find('}');
+  if (start == std::string::npos) start = 0;
+  if (end == std::string::npos || end < start) end = input.length();
+  static uint16_t raw[kMaxRawLength];
+  uint16_t len = 0;
+  const char *ptr = input.c_str() + start;
+  const char *last = input.c_str() + end;
+  while (ptr < last && len < kMaxRawLength) {
+    if (isdigit(*ptr)) {
+      raw[len++] = strtoul(ptr, const_cast<char **>(&ptr), 10);
+    } else {
+      ptr++;
+    }
+  }
+  if (len == 0) {
+    std::cerr << "No raw timing values found." << std::endl;
+    return 1;
+  }
+
+  static uint8_t packed[kPackedRawHeaderSize + kPackedRawMaxDict * 2 +
+                        kMaxRawLength];
+  const uint16_t size = packRaw(raw, len, freq, packed, sizeof(packed),
+                                tolerance);
+  if (!size) {
+    std::cerr << "Unable to pack the raw data. Try a larger --tolerance."
+              << std::endl;
+    return 1;
+  }
+
+  // Round-trip it, and time how long it takes to expand.
+  static uint16_t unpacked[kMaxRawLength];
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t loop = 0; loop < kDecodeLoops; loop++)
+    unpackRaw(packed, size, unpacked, kMaxRawLength);
+  auto finish = std::chrono::steady_clock::now();
+  const double nsecs = std::chrono::duration<double, std::nano>(
+      finish - begin).count() / kDecodeLoops / len;
+  uint32_t max_error = 0;
+  for (uint16_t i = 0; i < len; i++) {
+    uint32_t error = (raw[i] > unpacked[i]) ? raw[i] - unpacked[i]
+                                            : unpacked[i] - raw[i];
+    if (error > max_error) max_error = error;
+  }
+
+  printf("const uint8_t packedData[%d] = {", size);
+  for (uint16_t i = 0; i < size; i++) {
+    if (i % 12 == 0) printf("\n    ");
+    printf("0x%02X", packed[i]);
+    if (i < size - 1) printf(", ");
+  }
+  printf("};\n");
+  printf("// Raw entries:      %d (%d bytes)\n", len, len * 2);
+  printf("// Packed size:      %d bytes\n", size);
+  printf("// Compression:      %.2f:1\n", (len * 2.0) / size);
+  printf("// Dictionary:       %d entries, %d bits per symbol\n", packed[2],
+         packed[3]);
+  printf("// Pattern:          %d symbols\n", packed[4] | (packed[5] << 8));
+  printf("// Max. error:       %" PRIu32 " usecs\n", max_error);
+  printf("// Decode cost:      %.2f ns per entry\n", nsecs);
+  return 0;
+}
@@ -0,0 +1,314 @@
+// Quick and dirty tool to measure how faithfully IRsend reproduces each
+// protocol's mark/space timings when the hardware isn't free.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// It drives the real IRsend::mark()/space() code against a simulated clock,
+// where every clock read and every LED toggle can be given a cost (in usecs),
+// and compares what was actually produced against what the protocol asked for.
+// i.e. The header, bit, footer & gap durations from the protocol's spec.
+//
+// Usage example:
+//   ./send_timing_bench --clock-cost 2 --led-cost 1
+//   ./send_timing_bench --protocol NEC --verbose
+//   ./send_timing_bench --calibrate --led-cost 3
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+
+// A single mark() or space() request, and what we actually got.
+struct TimingElement {
+  bool is_mark;
+  uint32_t spec;       // What the protocol asked for. (usecs)
+  uint32_t actual;     // How long it really took. (usecs)
+  uint32_t on_time;    // How long the LED was lit for. (usecs)
+  uint16_t pulses;     // Nr. of carrier pulses generated.
+  uint32_t freq;       // Requested carrier frequency. (Hz)
+  uint8_t duty;        // Requested duty cycle. (%)
+};
+
+// Records the requested vs. actual timing of every mark & space, using the
+// low-level LED recorder for the actual output.
+class IRsendTimingTest : public IRsendLowLevelTest {
+ public:
+  std::vector<TimingElement> elements;
+
+  explicit IRsendTimingTest(uint16_t x) : IRsendLowLevelTest(x) {
+    setCosts(0, 0);
+    clear();
+  }
+
+  // Set how many usecs it costs to read the clock, and to toggle the LED.
+  void setCosts(const uint32_t clock, const uint32_t led) {
+    _IRtimer_unittest_read_cost = clock;
+    led_cost = led;
+  }
+
+  void clear() {
+    IRsendLowLevelTest::reset();
+    elements.clear();
+    led_is_on = false;
+    on_since = 0;
+    on_total = 0;
+  }
+
+  uint16_t mark(uint16_t usec) {
+    const uint32_t start = _IRtimer_unittest_now;
+    on_total = 0;
+    const uint16_t pulses = IRsend::mark(usec);  // Always ends with ledOff().
+    record(true, usec, _IRtimer_unittest_now - start, pulses);
+    return pulses;
+  }
+
+  void space(uint32_t usec) {
+    const uint32_t start = _IRtimer_unittest_now;
+    IRsend::space(usec);
+    record(false, usec, _IRtimer_unittest_now - start, 0);
+  }
+
+ protected:
+  void ledOn() {
+    IRsendLowLevelTest::ledOn();
+    if (!led_is_on) on_since = _IRtimer_unittest_now;
+    led_is_on = true;
+  }
+
+  void ledOff() {
+    if (led_is_on) on_total += _IRtimer_unittest_now - on_since;
+    led_is_on = false;
+    IRsendLowLevelTest::ledOff();
+  }
+
+ private:
+  bool led_is_on;
+  uint32_t on_since;
+  uint32_t on_total;
+
+  void record(const bool is_mark, const uint32_t spec, const uint32_t actual,
+              const uint16_t pulses) {
+    TimingElement element;
+    element.is_mark = is_mark;
+    element.spec = spec;
+    element.actual = actual;
+    element.on_time = is_mark ? on_total : 0;
+    element.pulses = pulses;
+    element.freq = _freq_unittest;
+    element.duty = _dutycycle;
+    elements.push_back(element);
+    // The sequence string isn't needed & grows quickly, so keep it small.
+    low_level_sequence.clear();
+  }
+};
+
+// Summary of the timing errors for a single protocol.
+struct TimingReport {
+  uint32_t elements;
+  uint64_t spec_total;
+  uint64_t actual_total;
+  uint32_t max_mark_error;
+  double max_mark_pct;
+  uint32_t max_space_error;
+  double max_space_pct;
+  double max_duty_error;
+  double max_freq_pct;
+  uint32_t out_of_tolerance;
+};
+
+uint32_t abs_diff(const uint32_t a, const uint32_t b) {
+  return (a > b) ? a - b : b - a;
+}
+
+TimingReport analyse(const std::vector<TimingElement> &elements,
+                     const uint8_t tolerance, const bool verbose) {
+  TimingReport report;
+  memset(&report, 0, sizeof(report));
+  for (size_t i = 0; i < elements.size(); i++) {
+    const TimingElement &e = elements[i];
+    if (!e.spec) continue;  // Zero-length requests don't produce anything.
+    report.elements++;
+    report.spec_total += e.spec;
+    report.actual_total += e.actual;
+    const uint32_t error = abs_diff(e.spec, e.actual);
+    const double pct = 100.0 * error / e.spec;
+    // Would a receiver, using the default matching tolerance, still accept it?
+    const bool ok = error <= (e.spec * tolerance) / 100;
+    if (!ok) report.out_of_tolerance++;
+    double duty_error = 0.0;
+    double freq_pct = 0.0;
+    if (e.is_mark) {
+      report.max_mark_error = std::max(report.max_mark_error, error);
+      report.max_mark_pct = std::max(report.max_mark_pct, pct);
+      if (e.actual && e.pulses) {
+        duty_error = 100.0 * e.on_time / e.actual - e.duty;
+        if (duty_error < 0) duty_error = -duty_error;
+        const double freq = 1000000.0 * e.pulses / e.actual;
+        freq_pct = 100.0 * (freq - e.freq) / e.freq;
+        if (freq_pct < 0) freq_pct = -freq_pct;
+        report.max_duty_error = std::max(report.max_duty_error, duty_error);
+        report.max_freq_pct = std::max(report.max_freq_pct, freq_pct);
+      }
+    } else {
+      report.max_space_error = std::max(report.max_space_error, error);
+      report.max_space_pct = std::max(report.max_space_pct, pct);
+    }
+    if (verbose) {
+      printf("  %c %6" PRIu32 " -> %6" PRIu32 "  err %5" PRIu32 "us %6.2f%%",
+             e.is_mark ? 'm' : 's', e.spec, e.actual, error, pct);
+      if (e.is_mark)
+        printf("  pulses %4d duty err %5.2f%% carrier err %5.2f%%", e.pulses,
+               duty_error, freq_pct);
+      printf("%s\n", ok ? "" : "  <-- OUT OF TOLERANCE");
+    }
+  }
+  return report;
+}
+
+// Replace what was asked for with the protocol's spec durations. i.e. What it
+// asks for when every mark & space is exact. Otherwise a gap that was shortened
+// to make up for earlier overruns would hide them. Returns false if the two
+// messages aren't the same shape, leaving the elements as they were.
+bool use_spec(std::vector<TimingElement> *elements,
+              const std::vector<TimingElement> &spec) {
+  if (elements->size() != spec.size()) return false;
+  for (size_t i = 0; i < spec.size(); i++)
+    if (elements->at(i).is_mark != spec[i].is_mark) return false;
+  for (size_t i = 0; i < spec.size(); i++)
+    elements->at(i).spec = spec[i].spec;
+  return true;
+}
+
+// Send a sample message for the given protocol. Returns false if we can't.
+bool send_protocol(IRsendTimingTest *irsend, const decode_type_t protocol) {
+  const uint16_t bits = IRsend::defaultBits(protocol);
+  if (!bits) return false;
+  irsend->clear();
+  bool sent;
+  if (hasACState(protocol)) {
+    uint8_t state[kStateSizeMax];
+    for (uint16_t i = 0; i < kStateSizeMax; i++) state[i] = 0xA5 ^ i;
+    sent = irsend->send(protocol, state,
+                        std::min((uint16_t)(bits / 8), kStateSizeMax));
+  } else {
+    uint64_t data = 0xA5A5A5A5A5A5A5A5ULL;
+    if (bits < 64) data &= (1ULL << bits) - 1;
+    sent = irsend->send(protocol, data, bits);
+  }
+  return sent && !irsend->elements.empty();
+}
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name
+            << " [--clock-cost usecs] [--led-cost usecs] [--protocol name]"
+               " [--tolerance percent] [--calibrate] [--verbose]"
+            << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val < 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t clock_cost = 0;
+  uint32_t led_cost = 0;
+  uint32_t tolerance = kTolerance;
+  bool calibrate = false;
+  bool verbose = false;
+  decode_type_t only = decode_type_t::UNKNOWN;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--calibrate", argv[i]) == 0) {
+      calibrate = true;
+      continue;
+    }
+    if (strcmp("--verbose", argv[i]) == 0) {
+      verbose = true;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      usage_error(argv[0]);
+      return 1;
+    }
+    bool valid = true;
+    if (strcmp("--clock-cost", argv[i]) == 0) {
+      valid = str_to_uint32(argv[++i], &clock_cost);
+    } else if (strcmp("--led-cost", argv[i]) == 0) {
+      valid = str_to_uint32(argv[++i], &led_cost);
+    } else if (strcmp("--tolerance", argv[i]) == 0) {
+      valid = str_to_uint32(argv[++i], &tolerance) && tolerance <= 100;
+    } else if (strcmp("--protocol", argv[i]) == 0) {
+      only = strToDecodeType(argv[++i]);
+      valid = only != decode_type_t::UNKNOWN;
+    } else {
+      valid = false;
+    }
+    if (!valid) {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  // A separate, cost free, sender gives each protocol's spec durations.
+  // Its own object, so it doesn't change what the measured one has learnt.
+  IRsendTimingTest spec_irsend(0);
+  spec_irsend.begin();
+  IRsendTimingTest irsend(0);
+  irsend.begin();
+  irsend.setCosts(clock_cost, led_cost);
+  if (calibrate) irsend.calibrate();
+
+  printf("// Clock read cost: %" PRIu32 "us, LED toggle cost: %" PRIu32
+         "us, period offset: %d, tolerance: %" PRIu32 "%%\n",
+         clock_cost, led_cost, irsend.getPeriodOffset(), tolerance);
+  printf("%-24s %5s %9s %9s %7s %13s %13s %6s %7s %5s\n", "// Protocol",
+         "Elems", "Spec(us)", "Real(us)", "Total%", "Mark max err",
+         "Space max err", "Duty", "Carrier", "Bad");
+
+  uint32_t protocols = 0;
+  uint32_t failures = 0;
+  for (int i = 1; i <= kLastDecodeType; i++) {
+    const decode_type_t protocol = (decode_type_t)i;
+    if (only != decode_type_t::UNKNOWN && protocol != only) continue;
+    spec_irsend.setCosts(0, 0);
+    if (!send_protocol(&spec_irsend, protocol)) continue;
+    irsend.setCosts(clock_cost, led_cost);
+    if (!send_protocol(&irsend, protocol)) continue;
+    if (!use_spec(&irsend.elements, spec_irsend.elements))
+      printf("// %s: Message differs from its spec. Using what it asked for.\n",
+             typeToString(protocol).c_str());
+    protocols++;
+
+    if (verbose) printf("// %s\n", typeToString(protocol).c_str());
+    const TimingReport r = analyse(irsend.elements, tolerance, verbose);
+    if (r.out_of_tolerance) failures++;
+    // How far off the whole message is, vs. the sum of its spec'ed durations.
+    const double total_pct = r.spec_total ?
+        100.0 * ((double)r.actual_total - r.spec_total) / r.spec_total : 0.0;
+    printf("%-24s %5" PRIu32 " %9" PRIu64 " %9" PRIu64 " %6.2f%%"
+           " %5" PRIu32 "/%6.2f%% %5" PRIu32 "/%6.2f%% %5.2f%% %6.2f%% %5"
+           PRIu32 "\n",
+           typeToString(protocol).c_str(), r.elements, r.spec_total,
+           r.actual_total, total_pct, r.max_mark_error, r.max_mark_pct,
+           r.max_space_error, r.max_space_pct, r.max_duty_error,
+           r.max_freq_pct, r.out_of_tolerance);
+  }
+  printf("// %" PRIu32 " protocol(s) measured, %" PRIu32
+         " with timings outside of a %" PRIu32 "%% tolerance.\n",
+         protocols, failures, tolerance);
+  return failures ? 2 : 0;
+}
@@ -0,0 +1,206 @@
+// Quick and dirty tool to compare the size & speed of the compact binary wire
+// format with the same information as JSON text built with Strings.
+// Copyright 2026 IRremoteESP8266 project and others
+
+// Usage example:
+//   ./wire_bench
+//   ./wire_bench --loops 100000
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>  // NOLINT(build/c++11)
+#include <iostream>
+#include <string>
+#include "IRac.h"
+#include "IRrecv.h"
+#include "IRsend.h"
+#include "IRsend_test.h"
+#include "IRutils.h"
+#include "IRwire.h"
+
+const uint32_t kDefaultLoops = 20000;
+
+// How a decode_results is typically sent as JSON.
+String resultsToJson(const decode_results * const results, const bool raw) {
+  String json = "{\"protocol\":\"" + typeToString(results->decode_type) +
+      "\",\"bits\":" + uint64ToString(results->bits);
+  if (hasACState(results->decode_type)) {
+    json += ",\"state\":\"";
+    for (uint16_t i = 0; i < results->bits / 8; i++) {
+      if (results->state[i] < 0x10) json += '0';
+      json += uint64ToString(results->state[i], 16);
+    }
+    json += '"';
+  } else {
+    json += ",\"value\":\"0x" + uint64ToString(results->value, 16) +
+        "\",\"address\":" + uint64ToString(results->address) +
+        ",\"command\":" + uint64ToString(results->command);
+  }
+  json += ",\"repeat\":";
+  json += results->repeat ? "true" : "false";
+  if (raw) {
+    json += ",\"raw\":[";
+    for (uint16_t i = 1; i < results->rawlen; i++) {
+      if (i > 1) json += ',';
+      json += uint64ToString(results->rawbuf[i] * kRawTick);
+    }
+    json += ']';
+  }
+  return json + '}';
+}
+
+// How a stdAc::state_t is typically sent as JSON.
+String stateToJson(const stdAc::state_t &state) {
+  return "{\"protocol\":\"" + typeToString(state.protocol) +
+      "\",\"model\":" + String(std::to_string(state.model)) +
+      ",\"power\":\"" + IRac::boolToString(state.power) +
+      "\",\"mode\":\"" + IRac::opmodeToString(state.mode) +
+      "\",\"degrees\":" + String(std::to_string(state.degrees)) +
+      ",\"celsius\":\"" + IRac::boolToString(state.celsius) +
+      "\",\"fanspeed\":\"" + IRac::fanspeedToString(state.fanspeed) +
+      "\",\"swingv\":\"" + IRac::swingvToString(state.swingv) +
+      "\",\"swingh\":\"" + IRac::swinghToString(state.swingh) +
+      "\",\"quiet\":\"" + IRac::boolToString(state.quiet) +
+      "\",\"turbo\":\"" + IRac::boolToString(state.turbo) +
+      "\",\"econo\":\"" + IRac::boolToString(state.econo) +
+      "\",\"light\":\"" + IRac::boolToString(state.light) +
+      "\",\"filter\":\"" + IRac::boolToString(state.filter) +
+      "\",\"clean\":\"" + IRac::boolToString(state.clean) +
+      "\",\"beep\":\"" + IRac::boolToString(state.beep) +
+      "\",\"sleep\":" + String(std::to_string(state.sleep)) +
+      ",\"clock\":" + String(std::to_string(state.clock)) +
+      ",\"command\":\"" + IRac::commandTypeToString(state.command) +
+      "\",\"iFeel\":\"" + IRac::boolToString(state.iFeel) +
+      "\",\"sensorTemperature\":" +
+      String(std::to_string(state.sensorTemperature)) + "}";
+}
+
+void usage_error(char *name) {
+  std::cerr << "Usage: " << name << " [--loops nr]" << std::endl;
+}
+
+bool str_to_uint32(char *str, uint32_t *res) {
+  char *end;
+  errno = 0;
+  intmax_t val = strtoimax(str, &end, 10);
+  if (errno == ERANGE || val <= 0 || val > UINT32_MAX || end == str ||
+      *end != '\0')
+    return false;
+  *res = (uint32_t)val;
+  return true;
+}
+
+double nsPerLoop(const std::chrono::steady_clock::time_point begin,
+                 const uint32_t loops) {
+  return std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - begin).count() / loops;
+}
+
+void measureResults(const char *name, const decode_results * const results,
+                    const bool raw, const uint32_t loops) {
+  static uint8_t buffer[kIrWireResultsSizeMax + kIrWireRawSizeMax * RAW_BUF];
+  static uint16_t rawbuf[RAW_BUF];
+  const String json = resultsToJson(results, raw);
+  const uint16_t length = irwire::encodeResults(results, buffer,
+                                                sizeof(buffer), raw);
+  IRwireResults view;
+  decode_results copy;
+  if (!length || irwire::decodeResults(buffer, length, &view) != length ||
+      !irwire::copyResults(view, &copy, rawbuf, RAW_BUF) ||
+      resultsToJson(&copy, raw) != json) {
+    printf("// %s: ROUND TRIP MISMATCH!\n", name);
+    exit(1);
+  }
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    if (resultsToJson(results, raw).empty()) exit(1);
+  const double json_ns = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    if (!irwire::encodeResults(results, buffer, sizeof(buffer), raw)) exit(1);
+  const double encode_ns = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++) {
+    if (!irwire::decodeResults(buffer, length, &view)) exit(1);
+    irwire::copyResults(view, &copy, rawbuf, RAW_BUF);
+  }
+  const double decode_ns = nsPerLoop(begin, loops);
+  printf("%-16s %6zu %10.0f %6u %10.0f %10.0f %7.1fx\n", name, json.length(),
+         json_ns, length, encode_ns, decode_ns, (double)json.length() / length);
+}
+
+void measureState(const char *name, const stdAc::state_t &state,
+                  const uint32_t loops) {
+  uint8_t buffer[kIrWireStateSizeMax];
+  const String json = stateToJson(state);
+  const uint16_t length = irwire::encodeState(state, buffer, sizeof(buffer));
+  stdAc::state_t copy;
+  if (!length || irwire::decodeState(buffer, length, &copy) != length ||
+      stateToJson(copy) != json) {
+    printf("// %s: ROUND TRIP MISMATCH!\n", name);
+    exit(1);
+  }
+  auto begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    if (stateToJson(state).empty()) exit(1);
+  const double json_ns = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    if (!irwire::encodeState(state, buffer, sizeof(buffer))) exit(1);
+  const double encode_ns = nsPerLoop(begin, loops);
+  begin = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < loops; i++)
+    if (!irwire::decodeState(buffer, length, &copy)) exit(1);
+  const double decode_ns = nsPerLoop(begin, loops);
+  printf("%-16s %6zu %10.0f %6u %10.0f %10.0f %7.1fx\n", name, json.length(),
+         json_ns, length, encode_ns, decode_ns, (double)json.length() / length);
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t loops = kDefaultLoops;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp("--loops", argv[i]) == 0 && i + 1 < argc &&
+        str_to_uint32(argv[i + 1], &loops)) {
+      i++;
+    } else {
+      usage_error(argv[0]);
+      return 1;
+    }
+  }
+
+  IRsendTest irsend(kGpioUnused);
+  IRrecv irrecv(kGpioUnused);
+  irsend.begin();
+
+  printf("// %" PRIu32 " loops per message.\n", loops);
+  printf("%-16s %6s %10s %6s %10s %10s %8s\n", "// Message", "JSON", "JSON ns",
+         "Wire", "Encode ns", "Decode ns", "Smaller");
+
+  irsend.reset();
+  irsend.sendNEC(0x4BB640BF);
+  irsend.makeDecodeResult();
+  irrecv.decode(&irsend.capture);
+  measureResults("NEC", &irsend.capture, false, loops);
+  measureResults("NEC + raw", &irsend.capture, true, loops);
+
+  const uint8_t state[kRhossStateLength] = {
+      0xAA, 0x05, 0x60, 0x00, 0x50, 0x80, 0x54, 0x00, 0x00, 0x00, 0x00, 0x33};
+  irsend.reset();
+  irsend.sendRhoss(state);
+  irsend.makeDecodeResult();
+  irrecv.decode(&irsend.capture);
+  measureResults("RHOSS", &irsend.capture, false, loops);
+  measureResults("RHOSS + raw", &irsend.capture, true, loops);
+
+  stdAc::state_t ac;
+  IRac::initState(&ac, decode_type_t::LG, lg_ac_remote_model_t::AKB74955603,
+                  true, stdAc::opmode_t::kCool, 21.5, true,
+                  stdAc::fanspeed_t::kMedium, stdAc::swingv_t::kAuto,
+                  stdAc::swingh_t::kOff, false, false, false, true, false,
+                  false, false, -1, 12 * 60 + 34);
+  measureState("stdAc::state_t", ac, loops);
+  return 0;
+}